@@ -73,7 +73,62 @@ MAYBE_INLINE void irq_restore(unsigned state);
  */
 MAYBE_INLINE int irq_is_in(void);
 
-#ifdef IRQ_API_INLINED
+#if defined(MODULE_SCHEDSTATISTICS_IRQ) || defined(DOXYGEN)
+/**
+ * @brief   Hook called by irq_disable() after disabling interrupts
+ *
+ * Implemented by module `schedstatistics_irq` to account the time spent with
+ * interrupts disabled.
+ *
+ * @param[in]   state   State returned by irq_disable()
+ */
+void irq_hook_disabled(unsigned state);
+
+/**
+ * @brief   Hook called by irq_restore() before restoring @p state
+ *
+ * @param[in]   state   State to restore
+ */
+void irq_hook_restore(unsigned state);
+
+/**
+ * @brief   Hook called by irq_enable() before enabling interrupts
+ */
+void irq_hook_enable(void);
+#endif
+
+#if defined(IRQ_API_INLINED) && defined(MODULE_SCHEDSTATISTICS_IRQ)
+/* the architecture's inline functions are wrapped to account the time spent
+ * with interrupts disabled, otherwise the linker does this (see
+ * sys/schedstatistics) */
+#define irq_disable irq_arch_disable
+#define irq_enable irq_arch_enable
+#define irq_restore irq_arch_restore
+#include "irq_arch.h"
+#undef irq_disable
+#undef irq_enable
+#undef irq_restore
+
+MAYBE_INLINE unsigned irq_disable(void)
+{
+    unsigned state = irq_arch_disable();
+
+    irq_hook_disabled(state);
+    return state;
+}
+
+MAYBE_INLINE unsigned irq_enable(void)
+{
+    irq_hook_enable();
+    return irq_arch_enable();
+}
+
+MAYBE_INLINE void irq_restore(unsigned state)
+{
+    irq_hook_restore(state);
+    irq_arch_restore(state);
+}
+#elif defined(IRQ_API_INLINED)
 #include "irq_arch.h"
 #endif /* IRQ_API_INLINED */
 
@@ -309,6 +309,46 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive multiple messages at once.
+ *
+ * This function blocks until at least one message was received. Then, up to
+ * @p max messages that are already queued or that are waiting to be sent are
+ * received within a single critical section. Senders blocked on the calling
+ * thread are woken up, but at most one context switch occurs.
+ *
+ * Messages are received in the same order as they would by successive calls
+ * to @ref msg_receive().
+ *
+ * @param[out] out  Pointer to an array of at least @p max preallocated
+ *                  ``msg_t`` structures, must not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must not be 0.
+ *
+ * @return  Number of messages received (at least 1)
+ */
+int msg_receive_bulk(msg_t *out, unsigned max);
+
+/**
+ * @brief Send multiple messages to a thread at once, non-blocking.
+ *
+ * If the target thread is waiting for a message, the first message is
+ * delivered directly. The other messages are put into the target's message
+ * queue within the same critical section, until it is full. At most one
+ * context switch occurs.
+ *
+ * Can be called from an interrupt service routine, in which case
+ * ``sender_pid`` is set to @ref KERNEL_PID_ISR for all messages.
+ *
+ * @param[in] m             Pointer to an array of @p num messages, must not
+ *                          be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread.
+ *
+ * @return  Number of messages delivered, starting with the first one in @p m
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message, block until reply received.
  *
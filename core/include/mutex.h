@@ -11,6 +11,24 @@
  * @defgroup    core_sync_mutex Mutex
  * @ingroup     core_sync
  * @brief       Mutex for thread synchronization
+ *
+ * Priority inheritance
+ * ====================
+ *
+ * By default, threads waiting for a mutex are queued by priority, but the
+ * thread currently holding the mutex keeps running at its own priority. A
+ * medium priority thread may then preempt a low priority owner indefinitely,
+ * delaying a high priority waiter (priority inversion).
+ *
+ * Using the pseudomodule `core_mutex_priority_inheritance` the owner of a
+ * mutex is temporarily raised to the priority of the highest priority waiter
+ * while it holds the mutex. The original priority is restored in
+ * @ref mutex_unlock and @ref mutex_unlock_and_sleep.
+ *
+ * @note    The priority restored on unlock is the one the owner had when it
+ *          acquired the mutex. When holding several mutexes at once, unlock
+ *          them in reverse order of locking. Inheritance is not propagated
+ *          transitively to an owner that itself is blocked on another mutex.
  * @{
  *
  * @file
@@ -25,6 +43,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "kernel_types.h"
 #include "list.h"
 
 #ifdef __cplusplus
@@ -41,18 +60,34 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex or `KERNEL_PID_UNDEF`
+     * @note    Only available if module `core_mutex_priority_inheritance`
+     *          is used.
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Original priority of the owner, restored on unlock
+     * @note    Only available if module `core_mutex_priority_inheritance`
+     *          is used.
+     * @internal
+     */
+    uint8_t owner_original_priority;
+#endif
 } mutex_t;
 
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { .queue = { .next = NULL } }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
-#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#define MUTEX_INIT_LOCKED { .queue = { .next = MUTEX_LOCKED } }
 
 /**
  * @cond INTERNAL
@@ -73,6 +108,9 @@ typedef struct {
 static inline void mutex_init(mutex_t *mutex)
 {
     mutex->queue.next = NULL;
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    mutex->owner = KERNEL_PID_UNDEF;
+#endif
 }
 
 /**
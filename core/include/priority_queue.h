@@ -13,6 +13,19 @@
  * @file
  * @brief       A simple priority queue
  *
+ * By default, the queue is a sorted singly linked list: adding and removing
+ * a specific node is O(n), removing the head is O(1), and nodes of the same
+ * priority are kept in FIFO order.
+ *
+ * With the pseudomodule `core_priority_queue_heap`, the queue is an
+ * intrusive pairing heap instead: adding is O(1), removing the head or a
+ * specific node is O(log n) amortized. The API stays the same,
+ * priority_queue_t::first is still the node with the lowest priority value
+ * and nodes of the same priority are still kept in FIFO order, but
+ * priority_queue_node_t::next no longer links the nodes in order, so code
+ * must not walk the queue through it (use priority_queue_count() to get the
+ * number of queued nodes).
+ *
  * @author      Kaspar Schleiser <kaspar@schleiser.de>
  */
 
@@ -30,9 +43,17 @@ extern "C" {
  * @brief data type for priority queue nodes
  */
 typedef struct priority_queue_node {
-    struct priority_queue_node *next;   /**< next queue node */
+    struct priority_queue_node *next;   /**< next queue node (next sibling
+                                             in the heap) */
     uint32_t priority;                  /**< queue node priority */
     unsigned int data;                  /**< queue node data */
+#if defined(MODULE_CORE_PRIORITY_QUEUE_HEAP) || defined(DOXYGEN)
+    struct priority_queue_node *child;  /**< first child in the heap */
+    struct priority_queue_node *prev;   /**< previous sibling, or parent for
+                                             the first child in the heap */
+    uint32_t seq;                       /**< insertion order among nodes of
+                                             the same priority */
+#endif
 } priority_queue_node_t;
 
 /**
@@ -40,12 +61,16 @@ typedef struct priority_queue_node {
  */
 typedef struct {
     priority_queue_node_t *first;        /**< first queue node */
+#if defined(MODULE_CORE_PRIORITY_QUEUE_HEAP) || defined(DOXYGEN)
+    uint32_t seq;                        /**< sequence number of the next
+                                              node added */
+#endif
 } priority_queue_t;
 
 /**
  * @brief Static initializer for priority_queue_node_t.
  */
-#define PRIORITY_QUEUE_NODE_INIT { NULL, 0, 0 }
+#define PRIORITY_QUEUE_NODE_INIT { .next = NULL, .priority = 0, .data = 0 }
 
 /**
  * @brief   Initialize a priority queue node object.
@@ -66,7 +91,7 @@ static inline void priority_queue_node_init(
 /**
  * @brief Static initializer for priority_queue_t.
  */
-#define PRIORITY_QUEUE_INIT { NULL }
+#define PRIORITY_QUEUE_INIT { .first = NULL }
 
 /**
  * @brief   Initialize a priority queue object.
@@ -113,6 +138,13 @@ void priority_queue_add(priority_queue_t *root, priority_queue_node_t *new_obj);
  */
 void priority_queue_remove(priority_queue_t *root, priority_queue_node_t *node);
 
+/**
+ * @brief get the number of nodes in `root`
+ * @param[in]       root    the priority queue's root
+ * @return                  the number of queued nodes
+ */
+unsigned priority_queue_count(const priority_queue_t *root);
+
 #if ENABLE_DEBUG
 /**
  * @brief print the data and priority of every node in the given priority queue
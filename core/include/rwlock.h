@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_sync_rwlock Reader-Writer Lock
+ * @ingroup     core_sync
+ * @brief       Reader-writer lock with writer preference
+ *
+ * Any number of readers can hold the lock at the same time, writers get
+ * exclusive access. As soon as a writer is waiting, new readers block, so
+ * that a steady stream of readers cannot starve writers.
+ *
+ * Blocked threads are woken in the order of their priority. When a writer
+ * releases the lock, the next waiting writer (if any) gets it, otherwise all
+ * waiting readers are woken at once.
+ *
+ * Unlike @ref pthread_rwlock_t, this lock is built directly on the scheduler
+ * and needs no mutex or priority queue.
+ *
+ * @note    There is no priority inheritance and the lock is not recursive.
+ *          Locking is not allowed in interrupt context.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Reader-writer lock structure. Must never be modified by the user.
+ */
+typedef struct {
+    /**
+     * @brief   Threads waiting for read access, sorted by priority
+     * @internal
+     */
+    list_node_t readers_queue;
+    /**
+     * @brief   Threads waiting for write access, sorted by priority
+     * @internal
+     */
+    list_node_t writers_queue;
+    /**
+     * @brief   Number of readers holding the lock
+     * @internal
+     */
+    uint16_t readers;
+    /**
+     * @brief   Whether a writer holds the lock
+     * @internal
+     */
+    bool writer;
+} rwlock_t;
+
+/**
+ * @brief   Static initializer for rwlock_t
+ */
+#define RWLOCK_INIT { .readers_queue = { NULL }, .writers_queue = { NULL }, \
+                      .readers = 0, .writer = false }
+
+/**
+ * @brief   Initializes a reader-writer lock
+ *
+ * For initialization of variables use RWLOCK_INIT instead.
+ *
+ * @param[out]  rwlock  pre-allocated lock, must not be NULL
+ */
+static inline void rwlock_init(rwlock_t *rwlock)
+{
+    rwlock_t empty = RWLOCK_INIT;
+
+    *rwlock = empty;
+}
+
+/**
+ * @brief   Acquire read access, blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ */
+void rwlock_read_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Try to acquire read access without blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @return  true, if read access was acquired
+ */
+bool rwlock_read_trylock(rwlock_t *rwlock);
+
+/**
+ * @brief   Release read access
+ *
+ * @param[in,out]   rwlock  lock to release
+ */
+void rwlock_read_unlock(rwlock_t *rwlock);
+
+/**
+ * @brief   Acquire write access, blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ */
+void rwlock_write_lock(rwlock_t *rwlock);
+
+/**
+ * @brief   Try to acquire write access without blocking
+ *
+ * @param[in,out]   rwlock  lock to acquire
+ *
+ * @return  true, if write access was acquired
+ */
+bool rwlock_write_trylock(rwlock_t *rwlock);
+
+/**
+ * @brief   Release write access
+ *
+ * @param[in,out]   rwlock  lock to release
+ */
+void rwlock_write_unlock(rwlock_t *rwlock);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RWLOCK_H */
+/** @} */
@@ -167,6 +167,22 @@ void sched_set_status(thread_t *process, thread_status_t status);
  */
 void sched_switch(uint16_t other_prio);
 
+/**
+ * @brief       Change the priority of the given thread
+ *
+ * @details     If the thread is on the runqueue, it is moved to the runqueue
+ *              of the new priority. The active thread stays at the head of
+ *              its runqueue. This function does not yield, the caller has to
+ *              call @ref sched_switch or thread_yield_higher() if the change
+ *              should take effect immediately.
+ *
+ * @pre         @p thread is not NULL and @p prio is a valid priority
+ *
+ * @param[in,out]   thread  Thread to change the priority of
+ * @param[in]       prio    New priority to assign to @p thread
+ */
+void sched_change_priority(thread_t *thread, uint8_t prio);
+
 /**
  * @brief   Call context switching at thread exit
  */
@@ -213,6 +229,59 @@ NORETURN void sched_task_exit(void);
  */
 void sched_arch_idle(void);
 
+/**
+ * @brief   Advance a runqueue
+ *
+ * Rotates the runqueue of @p prio, so that its current head is moved to the
+ * end of the queue. This does not trigger a context switch.
+ *
+ * @note    Must be called with interrupts disabled.
+ *
+ * @param[in]   prio    The priority of the runqueue to advance
+ */
+static inline void sched_runq_advance(uint8_t prio)
+{
+    clist_lpoprpush(&sched_runqueues[prio]);
+}
+
+/**
+ * @brief   Check whether more than one thread is runnable at a priority
+ *
+ * @param[in]   prio    The priority of the runqueue to check
+ *
+ * @return  true, if at least two threads are in the runqueue of @p prio
+ */
+static inline int sched_runq_more_than_one(uint8_t prio)
+{
+    clist_node_t *last = sched_runqueues[prio].next;
+
+    return (last != NULL) && (last->next != last);
+}
+
+/**
+ * @brief   Get the highest priority that has a runnable thread
+ *
+ * @note    Must be called with interrupts disabled.
+ *
+ * @return  The priority of the runqueue the scheduler will pick next,
+ *          SCHED_PRIO_LEVELS if there is no runnable thread
+ */
+uint8_t sched_runq_highest_prio(void);
+
+#if IS_USED(MODULE_SCHED_RUNQ_CALLBACK) || defined(DOXYGEN)
+/**
+ * @brief   Callback that is called whenever a thread is added to or removed
+ *          from a runqueue
+ *
+ * Must be implemented by the module that pulls in `sched_runq_callback`.
+ * Called with interrupts disabled from within the scheduler, so it must be
+ * short and must not (directly) cause a context switch.
+ *
+ * @param[in]   prio    The priority of the runqueue that changed
+ */
+void sched_runq_callback(uint8_t prio);
+#endif /* MODULE_SCHED_RUNQ_CALLBACK */
+
 #if IS_USED(MODULE_SCHED_CB) || defined(DOXYGEN)
 /**
  * @brief   Scheduler run callback
@@ -231,6 +300,23 @@ typedef void (*sched_callback_t)(kernel_pid_t active, kernel_pid_t next);
  * @param[in] callback The callback functions that will be called
  */
 void sched_register_cb(sched_callback_t callback);
+
+/**
+ * @brief   Scheduler wakeup callback
+ *
+ * @param   pid         Pid of the thread that was put on the runqueue
+ */
+typedef void (*sched_wakeup_callback_t)(kernel_pid_t pid);
+
+/**
+ * @brief  Register a callback that will be called whenever a thread that was
+ *         not runnable is put on the runqueue
+ *
+ * @note   The callback is called with interrupts disabled and must be short.
+ *
+ * @param[in] callback The callback functions that will be called
+ */
+void sched_register_wakeup_cb(sched_wakeup_callback_t callback);
 #endif /* MODULE_SCHED_CB */
 
 #ifdef __cplusplus
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    core_sync_seqlock Sequence Lock
+ * @ingroup     core_sync
+ * @brief       Sequence lock for small, frequently read data
+ *
+ * Readers of a sequence lock never block and never disable interrupts.
+ * Instead, they read the protected data optimistically and retry if a writer
+ * modified it in the meantime:
+ *
+ * ```
+ * unsigned seq;
+ * do {
+ *     seq = seqlock_read_begin(&lock);
+ *     copy = shared;
+ * } while (seqlock_read_retry(&lock, seq));
+ * ```
+ *
+ * Writers are serialized by disabling interrupts for the duration of the
+ * write section, which must thus be short (e.g. copying a few words):
+ *
+ * ```
+ * unsigned state = seqlock_write_begin(&lock);
+ * shared = update;
+ * seqlock_write_end(&lock, state);
+ * ```
+ *
+ * As a write section cannot be preempted, readers only ever have to retry
+ * if they were preempted by a writer (thread or ISR) themselves. Reading is
+ * allowed in interrupt context, as is writing.
+ *
+ * @note    Readers must not follow pointers read inside the read section
+ *          before seqlock_read_retry() validated them, and must cope with
+ *          reading inconsistent values before the retry.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Sequence lock
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdbool.h>
+
+#include "irq.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Sequence lock structure
+ */
+typedef struct {
+    unsigned seq;       /**< sequence number, odd while being written */
+} seqlock_t;
+
+/**
+ * @brief   Static initializer for seqlock_t
+ */
+#define SEQLOCK_INIT { .seq = 0 }
+
+/**
+ * @brief   Initializes a sequence lock
+ *
+ * @param[out]  lock    pre-allocated lock, must not be NULL
+ */
+static inline void seqlock_init(seqlock_t *lock)
+{
+    lock->seq = 0;
+}
+
+/**
+ * @brief   Begin a read section
+ *
+ * @param[in]   lock    lock protecting the data to read
+ *
+ * @return  sequence number to pass to seqlock_read_retry()
+ */
+static inline unsigned seqlock_read_begin(const seqlock_t *lock)
+{
+    /* an odd number (write in progress) makes seqlock_read_retry() fail */
+    return __atomic_load_n(&lock->seq, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief   End a read section
+ *
+ * @param[in]   lock    lock protecting the data read
+ * @param[in]   seq     return value of seqlock_read_begin()
+ *
+ * @return  true, if the data read may be inconsistent and the read section
+ *          needs to be repeated
+ */
+static inline bool seqlock_read_retry(const seqlock_t *lock, unsigned seq)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return (seq & 1) || (__atomic_load_n(&lock->seq, __ATOMIC_RELAXED) != seq);
+}
+
+/**
+ * @brief   Begin a write section
+ *
+ * Disables interrupts until seqlock_write_end() is called.
+ *
+ * @param[in,out]   lock    lock protecting the data to write
+ *
+ * @return  interrupt state to pass to seqlock_write_end()
+ */
+static inline unsigned seqlock_write_begin(seqlock_t *lock)
+{
+    unsigned state = irq_disable();
+
+    __atomic_store_n(&lock->seq, lock->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return state;
+}
+
+/**
+ * @brief   End a write section
+ *
+ * @param[in,out]   lock    lock protecting the data written
+ * @param[in]       state   return value of seqlock_write_begin()
+ */
+static inline void seqlock_write_end(seqlock_t *lock, unsigned state)
+{
+    __atomic_store_n(&lock->seq, lock->seq + 1, __ATOMIC_RELEASE);
+    irq_restore(state);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQLOCK_H */
+/** @} */
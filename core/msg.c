@@ -33,6 +33,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_TRACE_KERNEL
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -101,6 +104,10 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+#ifdef MODULE_TRACE_KERNEL
+    trace_kernel(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+#endif
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -181,6 +188,9 @@ int msg_send_to_self(msg_t *m)
     unsigned state = irq_disable();
 
     m->sender_pid = thread_getpid();
+#ifdef MODULE_TRACE_KERNEL
+    trace_kernel(TRACE_EVENT_MSG_SEND, m->sender_pid, m->type);
+#endif
     int res = queue_msg(thread_get_active(), m);
 
     irq_restore(state);
@@ -202,6 +212,10 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+#ifdef MODULE_TRACE_KERNEL
+    trace_kernel(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+#endif
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -328,14 +342,26 @@ int msg_reply_int(msg_t *m, msg_t *reply)
     return 1;
 }
 
+static inline int _trace_receive(msg_t *m, int res)
+{
+#ifdef MODULE_TRACE_KERNEL
+    if (res == 1) {
+        trace_kernel(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    }
+#else
+    (void)m;
+#endif
+    return res;
+}
+
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    return _trace_receive(m, _msg_receive(m, 0));
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    return _trace_receive(m, _msg_receive(m, 1));
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -427,6 +453,122 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_bulk(msg_t *out, unsigned max)
+{
+    assert(max);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = 0;
+
+    while (n < max) {
+        int queue_index = -1;
+
+        if (thread_has_msg_queue(me)) {
+            queue_index = cib_get(&(me->msg_queue));
+        }
+
+        list_node_t *next = list_remove_head(&me->msg_waiters);
+
+        if ((queue_index < 0) && (next == NULL)) {
+            break;
+        }
+
+        if (queue_index >= 0) {
+            out[n++] = me->msg_array[queue_index];
+        }
+
+        if (next != NULL) {
+            thread_t *sender =
+                container_of((clist_node_t *)next, thread_t, rq_entry);
+            msg_t *sender_msg = (msg_t *)sender->wait_data;
+
+            if (queue_index >= 0) {
+                /* keep the order: the waiter's message goes to the end of
+                 * the just freed queue space */
+                me->msg_array[cib_put(&(me->msg_queue))] = *sender_msg;
+            }
+            else {
+                out[n++] = *sender_msg;
+            }
+
+            if (sender->status != STATUS_REPLY_BLOCKED) {
+                sender->wait_data = NULL;
+                sched_set_status(sender, STATUS_PENDING);
+                if (sender->priority < sender_prio) {
+                    sender_prio = sender->priority;
+                }
+            }
+        }
+    }
+
+    DEBUG("msg_receive_bulk: %" PRIkernel_pid ": got %u messages\n",
+          thread_getpid(), n);
+
+    if (n == 0) {
+        /* nothing queued and nobody waiting, block for a single message */
+        me->wait_data = (void *)out;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        return 1;
+    }
+
+    irq_restore(state);
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+
+    return n;
+}
+
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    const bool in_irq = irq_is_in();
+    kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+    bool woken = false;
+    unsigned n = 0;
+
+    if (target == NULL) {
+        DEBUG("msg_send_bulk: target thread %d does not exist\n", target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        /* copy first msg to target */
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        woken = true;
+        n++;
+    }
+
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+
+    DEBUG("msg_send_bulk: delivered %u of %u messages to %" PRIkernel_pid
+          "\n", n, num, target_pid);
+
+    uint16_t target_prio = target->priority;
+    irq_restore(state);
+    if (woken) {
+        sched_switch(target_prio);
+    }
+
+    return n;
+}
+
 int msg_avail(void)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
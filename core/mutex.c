@@ -20,6 +20,7 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <inttypes.h>
 
@@ -28,10 +29,68 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#ifdef MODULE_TRACE_KERNEL
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    /* the mutex may be locked before the scheduler is started */
+    if (owner) {
+        mutex->owner = owner->pid;
+        mutex->owner_original_priority = owner->priority;
+    }
+    else {
+        mutex->owner = KERNEL_PID_UNDEF;
+    }
+#else
+    (void)mutex;
+    (void)owner;
+#endif
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *waiter)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = thread_get(mutex->owner);
+
+    if (owner && (owner->priority > waiter->priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: raising prio of owner %" PRIkernel_pid
+              " to %u\n", waiter->pid, owner->pid,
+              (unsigned)waiter->priority);
+        sched_change_priority(owner, waiter->priority);
+    }
+#else
+    (void)mutex;
+    (void)waiter;
+#endif
+}
+
+/* returns true if the owner's priority was lowered again */
+static inline bool _restore_priority(mutex_t *mutex)
+{
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread_t *owner = thread_get(mutex->owner);
+    bool restored = false;
+
+    if (owner && (owner->priority != mutex->owner_original_priority)) {
+        DEBUG("PID[%" PRIkernel_pid "]: restoring prio %u\n", owner->pid,
+              (unsigned)mutex->owner_original_priority);
+        sched_change_priority(owner, mutex->owner_original_priority);
+        restored = true;
+    }
+    mutex->owner = KERNEL_PID_UNDEF;
+    return restored;
+#else
+    (void)mutex;
+    return false;
+#endif
+}
+
 int _mutex_lock(mutex_t *mutex, volatile uint8_t *blocking)
 {
     unsigned irqstate = irq_disable();
@@ -41,6 +100,8 @@ int _mutex_lock(mutex_t *mutex, volatile uint8_t *blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        /* in an ISR, the active thread is just the interrupted one */
+        _set_owner(mutex, irq_is_in() ? NULL : thread_get_active());
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               thread_getpid());
         irq_restore(irqstate);
@@ -51,6 +112,9 @@ int _mutex_lock(mutex_t *mutex, volatile uint8_t *blocking)
         DEBUG("PID[%" PRIkernel_pid "]: Adding node to mutex queue: prio: %"
               PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
         sched_set_status(me, STATUS_MUTEX_BLOCKED);
+#ifdef MODULE_TRACE_KERNEL
+        trace_kernel(TRACE_EVENT_MUTEX_BLOCK, 0, (uintptr_t)mutex);
+#endif
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = (list_node_t *)&me->rq_entry;
             mutex->queue.next->next = NULL;
@@ -58,6 +122,7 @@ int _mutex_lock(mutex_t *mutex, volatile uint8_t *blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _inherit_priority(mutex, me);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -83,10 +148,17 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    bool restored = _restore_priority(mutex);
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
+        if (restored) {
+            /* threads the owner only preceded due to the inherited priority
+             * run now */
+            thread_yield_higher();
+        }
         return;
     }
 
@@ -97,6 +169,10 @@ void mutex_unlock(mutex_t *mutex)
     DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
           process->pid);
     sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_TRACE_KERNEL
+    trace_kernel(TRACE_EVENT_MUTEX_UNBLOCK, process->pid, (uintptr_t)mutex);
+#endif
+    _set_owner(mutex, process);
 
     if (!mutex->queue.next) {
         mutex->queue.next = MUTEX_LOCKED;
@@ -114,6 +190,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        _restore_priority(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -123,6 +200,11 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
             sched_set_status(process, STATUS_PENDING);
+#ifdef MODULE_TRACE_KERNEL
+            trace_kernel(TRACE_EVENT_MUTEX_UNBLOCK, process->pid,
+                         (uintptr_t)mutex);
+#endif
+            _set_owner(mutex, process);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
             }
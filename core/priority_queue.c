@@ -19,12 +19,161 @@
 
 #include <inttypes.h>
 #include <assert.h>
+#include <stdbool.h>
 
 #include "priority_queue.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#ifdef MODULE_CORE_PRIORITY_QUEUE_HEAP
+/* Pairing heap: every node links to its first child, siblings are linked
+ * through next. prev points to the previous sibling, or to the parent for
+ * the first child, and is NULL for the root (and for nodes not queued).
+ * Nodes of the same priority are ordered by their sequence number, so they
+ * leave the queue in the order they were added. */
+
+static inline bool _before(const priority_queue_node_t *a,
+                           const priority_queue_node_t *b)
+{
+    if (a->priority != b->priority) {
+        return a->priority < b->priority;
+    }
+    /* the sequence numbers may wrap around */
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static priority_queue_node_t *_meld(priority_queue_node_t *a,
+                                    priority_queue_node_t *b)
+{
+    if (!a) {
+        a = b;
+    }
+    else if (b) {
+        if (_before(b, a)) {
+            priority_queue_node_t *tmp = a;
+            a = b;
+            b = tmp;
+        }
+        b->next = a->child;
+        if (b->next) {
+            b->next->prev = b;
+        }
+        b->prev = a;
+        a->child = b;
+    }
+    if (a) {
+        a->next = NULL;
+    }
+    return a;
+}
+
+static priority_queue_node_t *_merge_pairs(priority_queue_node_t *first)
+{
+    priority_queue_node_t *pairs = NULL;
+
+    /* first pass: meld pairs left to right, keep them in a reversed list */
+    while (first) {
+        priority_queue_node_t *a = first;
+        priority_queue_node_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a = _meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the pairs right to left */
+    priority_queue_node_t *root = NULL;
+    while (pairs) {
+        priority_queue_node_t *next = pairs->next;
+        root = _meld(root, pairs);
+        pairs = next;
+    }
+    return root;
+}
+
+static void _set_first(priority_queue_t *root, priority_queue_node_t *node)
+{
+    root->first = node;
+    if (node) {
+        node->prev = NULL;
+    }
+}
+
+static priority_queue_node_t *_parent(priority_queue_node_t *node)
+{
+    while (node->prev && (node->prev->child != node)) {
+        node = node->prev;
+    }
+    return node->prev;
+}
+
+void priority_queue_remove(priority_queue_t *root, priority_queue_node_t *node)
+{
+    if (node == root->first) {
+        priority_queue_remove_head(root);
+        return;
+    }
+    if (!node->prev) {
+        /* not queued */
+        return;
+    }
+
+    /* cut the subtree of node ... */
+    if (node->prev->child == node) {
+        node->prev->child = node->next;
+    }
+    else {
+        node->prev->next = node->next;
+    }
+    if (node->next) {
+        node->next->prev = node->prev;
+    }
+
+    /* ... and meld its children back in */
+    priority_queue_node_t *subtree = _merge_pairs(node->child);
+    node->next = NULL;
+    node->child = NULL;
+    node->prev = NULL;
+    _set_first(root, _meld(root->first, subtree));
+}
+
+priority_queue_node_t *priority_queue_remove_head(priority_queue_t *root)
+{
+    priority_queue_node_t *head = root->first;
+
+    if (head) {
+        _set_first(root, _merge_pairs(head->child));
+        head->child = NULL;
+        head->next = NULL;
+    }
+    return head;
+}
+
+void priority_queue_add(priority_queue_t *root, priority_queue_node_t *new_obj)
+{
+    /* not trying to add the same node twice */
+    assert(root->first != new_obj);
+
+    new_obj->child = NULL;
+    new_obj->prev = NULL;
+    new_obj->seq = root->seq++;
+    _set_first(root, _meld(root->first, new_obj));
+}
+
+/* pre-order walk of the heap without recursion */
+static priority_queue_node_t *_walk_next(priority_queue_node_t *node)
+{
+    if (node->child) {
+        return node->child;
+    }
+    while (node && !node->next) {
+        node = _parent(node);
+    }
+    return node ? node->next : NULL;
+}
+#else
 void priority_queue_remove(priority_queue_t *root_, priority_queue_node_t *node)
 {
     /* The strict aliasing rules allow this assignment. */
@@ -72,12 +221,30 @@ void priority_queue_add(priority_queue_t *root, priority_queue_node_t *new_obj)
     new_obj->next = NULL;
 }
 
+static priority_queue_node_t *_walk_next(priority_queue_node_t *node)
+{
+    return node->next;
+}
+#endif
+
+unsigned priority_queue_count(const priority_queue_t *root)
+{
+    unsigned count = 0;
+
+    for (priority_queue_node_t *node = root->first; node;
+         node = _walk_next(node)) {
+        count++;
+    }
+    return count;
+}
+
 #if ENABLE_DEBUG
 void priority_queue_print(priority_queue_t *root)
 {
     printf("queue:\n");
 
-    for (priority_queue_node_t *node = root->first; node; node = node->next) {
+    for (priority_queue_node_t *node = root->first; node;
+         node = _walk_next(node)) {
         printf("Data: %u Priority: %lu\n", node->data,
                (unsigned long)node->priority);
     }
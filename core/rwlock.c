@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     core_sync_rwlock
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "rwlock.h"
+#include "sched.h"
+#include "thread.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline bool _read_possible(const rwlock_t *rwlock)
+{
+    return !rwlock->writer && !rwlock->writers_queue.next;
+}
+
+static inline bool _write_possible(const rwlock_t *rwlock)
+{
+    return !rwlock->writer && !rwlock->readers;
+}
+
+/* must be called with interrupts disabled, restores them */
+static void _block(list_node_t *queue, unsigned irqstate)
+{
+    thread_t *me = thread_get_active();
+
+    sched_set_status(me, STATUS_MUTEX_BLOCKED);
+    thread_add_to_list(queue, me);
+    irq_restore(irqstate);
+    thread_yield_higher();
+    /* the waker handed the lock over to us */
+}
+
+static thread_t *_wake_one(list_node_t *queue)
+{
+    list_node_t *next = list_remove_head(queue);
+    thread_t *thread = container_of((clist_node_t *)next, thread_t, rq_entry);
+
+    sched_set_status(thread, STATUS_PENDING);
+    return thread;
+}
+
+/* hand the lock over to waiting threads, must be called with interrupts
+ * disabled, restores them */
+static void _wake_waiters(rwlock_t *rwlock, unsigned irqstate)
+{
+    uint16_t prio = THREAD_PRIORITY_MIN + 1;
+
+    if (rwlock->writers_queue.next) {
+        if (!rwlock->readers) {
+            rwlock->writer = true;
+            prio = _wake_one(&rwlock->writers_queue)->priority;
+            DEBUG("rwlock: handing over to writer\n");
+        }
+    }
+    else {
+        while (rwlock->readers_queue.next) {
+            thread_t *thread = _wake_one(&rwlock->readers_queue);
+            rwlock->readers++;
+            if (thread->priority < prio) {
+                prio = thread->priority;
+            }
+            DEBUG("rwlock: handing over to reader\n");
+        }
+    }
+
+    irq_restore(irqstate);
+    if (prio <= THREAD_PRIORITY_MIN) {
+        sched_switch(prio);
+    }
+}
+
+bool rwlock_read_trylock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+    bool res = _read_possible(rwlock);
+
+    if (res) {
+        rwlock->readers++;
+    }
+    irq_restore(irqstate);
+    return res;
+}
+
+void rwlock_read_lock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+
+    if (_read_possible(rwlock)) {
+        rwlock->readers++;
+        irq_restore(irqstate);
+        return;
+    }
+    _block(&rwlock->readers_queue, irqstate);
+}
+
+void rwlock_read_unlock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+
+    assert(rwlock->readers > 0);
+    rwlock->readers--;
+    if (!rwlock->readers && rwlock->writers_queue.next) {
+        _wake_waiters(rwlock, irqstate);
+        return;
+    }
+    irq_restore(irqstate);
+}
+
+bool rwlock_write_trylock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+    bool res = _write_possible(rwlock);
+
+    if (res) {
+        rwlock->writer = true;
+    }
+    irq_restore(irqstate);
+    return res;
+}
+
+void rwlock_write_lock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+
+    if (_write_possible(rwlock)) {
+        rwlock->writer = true;
+        irq_restore(irqstate);
+        return;
+    }
+    _block(&rwlock->writers_queue, irqstate);
+}
+
+void rwlock_write_unlock(rwlock_t *rwlock)
+{
+    unsigned irqstate = irq_disable();
+
+    assert(rwlock->writer);
+    rwlock->writer = false;
+    _wake_waiters(rwlock, irqstate);
+}
@@ -21,12 +21,16 @@
 
 #include <stdint.h>
 
+#include "assert.h"
 #include "sched.h"
 #include "clist.h"
 #include "bitarithm.h"
 #include "irq.h"
 #include "thread.h"
 #include "log.h"
+#ifdef MODULE_TRACE_KERNEL
+#include "trace.h"
+#endif
 
 #ifdef MODULE_MPU_STACK_GUARD
 #include "mpu.h"
@@ -81,6 +85,7 @@ static uint32_t runqueue_bitcache = 0;
 #ifdef MODULE_SCHED_CB
 static void (*sched_cb) (kernel_pid_t active_thread,
                          kernel_pid_t next_thread) = NULL;
+static void (*sched_wakeup_cb) (kernel_pid_t pid) = NULL;
 #endif
 
 /* Depending on whether the CLZ instruction is available, the order of the
@@ -191,6 +196,11 @@ thread_t *__attribute__((used)) sched_run(void)
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
+#ifdef MODULE_TRACE_KERNEL
+        trace_kernel(TRACE_EVENT_SWITCH, next_thread->pid,
+                     previous_thread ? previous_thread->pid : KERNEL_PID_UNDEF);
+#endif
+
 #ifdef MODULE_SCHED_CB
         if (sched_cb) {
             sched_cb(KERNEL_PID_UNDEF, next_thread->pid);
@@ -224,6 +234,14 @@ void sched_set_status(thread_t *process, thread_status_t status)
             clist_rpush(&sched_runqueues[process->priority],
                         &(process->rq_entry));
             _set_runqueue_bit(process);
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+            sched_runq_callback(process->priority);
+#endif
+#ifdef MODULE_SCHED_CB
+            if (sched_wakeup_cb) {
+                sched_wakeup_cb(process->pid);
+            }
+#endif
         }
     }
     else {
@@ -236,12 +254,68 @@ void sched_set_status(thread_t *process, thread_status_t status)
             if (!sched_runqueues[process->priority].next) {
                 _clear_runqueue_bit(process);
             }
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+            sched_runq_callback(process->priority);
+#endif
         }
     }
 
     process->status = status;
 }
 
+uint8_t sched_runq_highest_prio(void)
+{
+    if (!runqueue_bitcache) {
+        return SCHED_PRIO_LEVELS;
+    }
+    return _get_prio_queue_from_runqueue();
+}
+
+void sched_change_priority(thread_t *thread, uint8_t prio)
+{
+    assert(thread && (prio < SCHED_PRIO_LEVELS));
+
+    unsigned irqstate = irq_disable();
+
+    if (thread->priority == prio) {
+        irq_restore(irqstate);
+        return;
+    }
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid " prio %" PRIu8
+          " --> %" PRIu8 "\n", thread->pid, thread->priority, prio);
+
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            _clear_runqueue_bit(thread);
+        }
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+        sched_runq_callback(thread->priority);
+#endif
+
+        thread->priority = prio;
+
+        /* the active thread must stay the head of its runqueue, as
+         * sched_set_status() removes it from there using clist_lpop() */
+        if (thread == thread_get_active()) {
+            clist_lpush(&sched_runqueues[prio], &thread->rq_entry);
+        }
+        else {
+            clist_rpush(&sched_runqueues[prio], &thread->rq_entry);
+        }
+        _set_runqueue_bit(thread);
+#ifdef MODULE_SCHED_RUNQ_CALLBACK
+        sched_runq_callback(prio);
+#endif
+    }
+    else {
+        thread->priority = prio;
+    }
+
+    irq_restore(irqstate);
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = thread_get_active();
@@ -288,4 +362,9 @@ void sched_register_cb(void (*callback)(kernel_pid_t, kernel_pid_t))
 {
     sched_cb = callback;
 }
+
+void sched_register_wakeup_cb(void (*callback)(kernel_pid_t))
+{
+    sched_wakeup_cb = callback;
+}
 #endif
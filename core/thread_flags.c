@@ -22,6 +22,9 @@
 #include "thread_flags.h"
 #include "irq.h"
 #include "thread.h"
+#ifdef MODULE_TRACE_KERNEL
+#include "trace.h"
+#endif
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -48,6 +51,9 @@ static inline int __attribute__((always_inline)) _thread_flags_wake(thread_t *th
               thread->pid);
         sched_set_status(thread, STATUS_PENDING);
         sched_context_switch_request = 1;
+#ifdef MODULE_TRACE_KERNEL
+        trace_kernel(TRACE_EVENT_FLAGS_WAKE, thread->pid, thread->flags);
+#endif
     }
 
     return wakeup;
@@ -39,6 +39,7 @@
 #include "periph/pm.h"
 
 #include "native_internal.h"
+#include "trace.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -260,7 +261,9 @@ void native_irq_handler(void)
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
+            trace_kernel(TRACE_EVENT_ISR_ENTER, sig, 0);
             native_irq_handlers[sig]();
+            trace_kernel(TRACE_EVENT_ISR_EXIT, sig, 0);
         }
         else if (sig == SIGUSR1) {
             warnx("native_irq_handler: ignoring SIGUSR1");
@@ -0,0 +1,167 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Convert the output of `trace_dump_binary()` (module `trace`, kernel events
+with `trace_kernel`) to the Chrome trace event format, which can be viewed
+with chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import re
+import sys
+
+EVENT_TYPES = [
+    "user",
+    "switch",
+    "isr_enter",
+    "isr_exit",
+    "msg_send",
+    "msg_recv",
+    "mutex_block",
+    "mutex_unblock",
+    "flags_wake",
+]
+# type of entries that were still being written when the buffer was dumped
+TYPE_PENDING = 0xff
+
+BEGIN_RE = re.compile(r"trace: begin (\d+)")
+ENTRY_RE = re.compile(r"^([0-9a-f]{8})([0-9a-f]{8})([0-9a-f]{4})"
+                      r"([0-9a-f]{2})([0-9a-f]{2})$")
+END_RE = re.compile(r"trace: end")
+
+PID_RIOT = 1
+TID_ISR = 0xffff
+KERNEL_PID_UNDEF = 0
+
+
+def parse(lines):
+    """
+    Return the entries of the last complete dump in `lines` as list of
+    (time, val, arg, type, pid) tuples, with time unwrapped to 64 bit
+    """
+    entries = None
+    current = None
+    for line in lines:
+        # strip pyterm / timestamp prefixes
+        line = line.strip()
+        if BEGIN_RE.search(line):
+            current = []
+            continue
+        if current is None:
+            continue
+        if END_RE.search(line):
+            entries = current
+            current = None
+            continue
+        match = ENTRY_RE.search(line.split()[-1] if line else "")
+        if match:
+            current.append(tuple(int(g, 16) for g in match.groups()))
+
+    if entries is None:
+        return []
+
+    res = []
+    offset = 0
+    last = None
+    for time, val, arg, type_, pid in entries:
+        if type_ == TYPE_PENDING:
+            continue
+        if last is not None and time + offset < last:
+            offset += 1 << 32
+        last = time + offset
+        res.append((last, val, arg, type_, pid))
+    return res
+
+
+def _event_name(type_):
+    if type_ < len(EVENT_TYPES):
+        return EVENT_TYPES[type_]
+    return "unknown({})".format(type_)
+
+
+def convert(entries):
+    events = []
+    running = None
+    isr_depth = 0
+
+    def begin(tid, name, time, args=None):
+        event = {"ph": "B", "pid": PID_RIOT, "tid": tid, "name": name,
+                 "ts": time}
+        if args:
+            event["args"] = args
+        events.append(event)
+
+    def end(tid, time):
+        events.append({"ph": "E", "pid": PID_RIOT, "tid": tid, "ts": time})
+
+    if entries:
+        # the thread active at the first entry is running from then on
+        running = entries[0][4] or None
+        if running is not None:
+            begin(running, "running", entries[0][0])
+
+    for time, val, arg, type_, pid in entries:
+        name = _event_name(type_)
+        if type_ == 1:      # switch
+            if running is not None:
+                end(running, time)
+            running = arg if arg != KERNEL_PID_UNDEF else None
+            if running is not None:
+                begin(running, "running", time, {"prev": val})
+        elif type_ == 2:    # isr_enter
+            isr_depth += 1
+            begin(TID_ISR, "isr {}".format(arg), time)
+        elif type_ == 3:    # isr_exit
+            if isr_depth:
+                isr_depth -= 1
+                end(TID_ISR, time)
+        else:
+            events.append({"ph": "i", "s": "t", "pid": PID_RIOT,
+                           "tid": pid, "name": name, "ts": time,
+                           "args": {"arg": arg, "val": "0x%08x" % val}})
+
+    if entries:
+        last = entries[-1][0]
+        if running is not None:
+            end(running, last)
+        for _ in range(isr_depth):
+            end(TID_ISR, last)
+
+    # name the tracks
+    tids = sorted({e["tid"] for e in events})
+    for tid in tids:
+        events.append({"ph": "M", "pid": PID_RIOT, "tid": tid,
+                       "name": "thread_name",
+                       "args": {"name": "isr" if tid == TID_ISR
+                                else "pid {}".format(tid)}})
+
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+                        default=sys.stdin,
+                        help="terminal output containing the trace dump "
+                             "(default: stdin)")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout,
+                        help="output file (default: stdout)")
+    args = parser.parse_args()
+
+    entries = parse(args.log)
+    if not entries:
+        sys.exit("no complete trace dump found")
+    json.dump(convert(entries), args.output, indent=1)
+    args.output.write("\n")
+
+
+if __name__ == "__main__":
+    main()
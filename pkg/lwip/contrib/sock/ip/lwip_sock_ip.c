@@ -212,6 +212,14 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_RAW);
 }
 
+ssize_t sock_ip_sendv(sock_ip_t *sock, const iolist_t *snips, uint8_t proto,
+                      const sock_ip_ep_t *remote)
+{
+    assert((sock != NULL) || (remote != NULL));
+    return lwip_sock_sendv(sock ? sock->base.conn : NULL, snips, proto,
+                           (struct _sock_tl_ep *)remote, NETCONN_RAW);
+}
+
 #ifdef SOCK_HAS_ASYNC
 void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb, void *arg)
 {
@@ -160,6 +160,37 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
 }
 
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote)
+{
+    assert((sock != NULL) || (remote != NULL));
+
+    if ((remote != NULL) && (remote->port == 0)) {
+        return -EINVAL;
+    }
+    return lwip_sock_sendv((sock) ? sock->base.conn : NULL, snips, 0,
+                           (struct _sock_tl_ep *)remote, NETCONN_UDP);
+}
+
+#ifdef MODULE_SOCK_UDP_BATCH
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                        unsigned dgrams_numof)
+{
+    unsigned numof;
+    ssize_t res = 0;
+
+    assert((dgrams != NULL) && (dgrams_numof > 0));
+    for (numof = 0; numof < dgrams_numof; numof++) {
+        res = sock_udp_send(sock, dgrams[numof].data, dgrams[numof].len,
+                            dgrams[numof].remote);
+        if (res < 0) {
+            break;
+        }
+    }
+    return (numof > 0) ? (int)numof : (int)res;
+}
+#endif  /* MODULE_SOCK_UDP_BATCH */
+
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
 {
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event deadline implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event/deadline.h"
+
+static inline uint32_t _deadline(clist_node_t *node)
+{
+    return container_of(node, event_deadline_t, super.list_node)->deadline;
+}
+
+static inline int _before(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b) < 0;
+}
+
+void _event_deadline_insert(clist_node_t *list, event_deadline_t *event)
+{
+    clist_node_t *node = &event->super.list_node;
+    clist_node_t *last = list->next;
+
+    /* common case: empty list or latest deadline, append in O(1) */
+    if (!last || !_before(event->deadline, _deadline(last))) {
+        clist_rpush(list, node);
+        return;
+    }
+
+    /* the last entry has a later deadline, so this terminates before
+     * wrapping around */
+    clist_node_t *prev = last;
+    clist_node_t *cur = last->next;
+    while (!_before(event->deadline, _deadline(cur))) {
+        prev = cur;
+        cur = cur->next;
+    }
+    node->next = cur;
+    prev->next = node;
+}
+
+void event_post_deadline(event_queue_t *queue, event_deadline_t *event,
+                         uint32_t deadline)
+{
+    assert(queue && event);
+
+    unsigned state = irq_disable();
+    if (!event->super.list_node.next) {
+        event->deadline = deadline;
+        _event_deadline_insert(&queue->event_list, event);
+    }
+    thread_t *waiter = queue->waiter;
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Event multi-queue implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "bitarithm.h"
+#include "event/mqueue.h"
+
+void event_mqueue_init(event_mqueue_t *mqueue, event_queue_t *queues,
+                       size_t n_queues)
+{
+    assert(mqueue && queues && n_queues);
+    assert(n_queues <= EVENT_MQUEUE_NUMOF_MAX);
+
+    event_queues_init(queues, n_queues);
+    mqueue->queues = queues;
+    mqueue->pending = 0;
+    mqueue->numof = n_queues;
+}
+
+static void _notify(event_queue_t *queue)
+{
+    if (queue->waiter) {
+        thread_flags_set(queue->waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_mqueue_post(event_mqueue_t *mqueue, unsigned prio, event_t *event)
+{
+    assert(mqueue && event && (prio < mqueue->numof));
+    event_queue_t *queue = &mqueue->queues[prio];
+
+    /* queue and bitmap must be updated atomically, otherwise the waiter
+     * could clear the bit of a queue that just got an event */
+    unsigned state = irq_disable();
+    if (!event->list_node.next) {
+        clist_rpush(&queue->event_list, &event->list_node);
+    }
+    mqueue->pending |= 1U << prio;
+    irq_restore(state);
+
+    _notify(queue);
+}
+
+#ifdef MODULE_EVENT_DEADLINE
+void event_mqueue_post_deadline(event_mqueue_t *mqueue, unsigned prio,
+                                event_deadline_t *event, uint32_t deadline)
+{
+    assert(mqueue && event && (prio < mqueue->numof));
+    event_queue_t *queue = &mqueue->queues[prio];
+
+    unsigned state = irq_disable();
+    if (!event->super.list_node.next) {
+        event->deadline = deadline;
+        _event_deadline_insert(&queue->event_list, event);
+    }
+    mqueue->pending |= 1U << prio;
+    irq_restore(state);
+
+    _notify(queue);
+}
+#endif
+
+event_t *event_mqueue_get(event_mqueue_t *mqueue)
+{
+    assert(mqueue);
+    event_t *result = NULL;
+
+    unsigned state = irq_disable();
+    while (mqueue->pending) {
+        unsigned prio = bitarithm_lsb(mqueue->pending);
+        clist_node_t *list = &mqueue->queues[prio].event_list;
+
+        result = container_of(clist_lpop(list), event_t, list_node);
+        if (!list->next) {
+            /* queue drained (or the event got canceled) */
+            mqueue->pending &= ~(1U << prio);
+        }
+        if (result) {
+            break;
+        }
+    }
+    irq_restore(state);
+
+    if (result) {
+        result->list_node.next = NULL;
+    }
+    return result;
+}
+
+event_t *event_mqueue_wait(event_mqueue_t *mqueue)
+{
+    event_t *result;
+
+    while ((result = event_mqueue_get(mqueue)) == NULL) {
+        thread_flags_wait_any(THREAD_FLAG_EVENT);
+    }
+
+    return result;
+}
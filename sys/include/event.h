@@ -305,6 +305,9 @@ event_t *event_get(event_queue_t *queue);
  *          sources of latency) that is acceptable to the real-time event with
  *          the strictest requirements.
  *
+ * @note    The queues are checked one after the other. For a large number of
+ *          queues, consider using @ref event_mqueue_t instead.
+ *
  * @param[in]   queues      Array of event queues to get event from
  * @param[in]   n_queues    Number of event queues passed in @p queues
  *
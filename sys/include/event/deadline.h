@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides earliest deadline first ordered event queues
+ *
+ * Events posted using event_post_deadline() are not appended to the queue,
+ * but inserted in the order of their deadline. Thus, event_get(),
+ * event_wait() and friends return the queued event with the earliest
+ * deadline. Events with the same deadline are kept in FIFO order.
+ *
+ * Deadlines are absolute 32 bit timestamps of any monotonic clock, e.g.
+ * `ztimer_now(ZTIMER_MSEC) + 10`. They are compared wrap around safe, so
+ * all deadlines within a queue must be less than 2^31 ticks apart. All
+ * events of a queue must be posted using event_post_deadline(), the same
+ * clock must be used for all of them.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_deadline_t event = { .super.handler = handler };
+ *
+ * [...]
+ * event_post_deadline(&queue, &event, ztimer_now(ZTIMER_MSEC) + 10);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    Posting is O(n) in the number of queued events, getting the next
+ *          event and canceling stay as they are.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event Deadline API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef EVENT_DEADLINE_H
+#define EVENT_DEADLINE_H
+
+#include <stdint.h>
+
+#include "event.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Deadline event structure
+ */
+typedef struct {
+    event_t super;              /**< event_t structure that gets extended   */
+    uint32_t deadline;          /**< absolute deadline of the event         */
+} event_deadline_t;
+
+/**
+ * @brief   Queue an event ordered by its deadline
+ *
+ * If the event is already queued when calling this function, neither the
+ * event nor its deadline will be touched.
+ *
+ * @param[in]   queue       event queue to queue event in
+ * @param[in]   event       event to queue in event queue
+ * @param[in]   deadline    absolute deadline of the event
+ */
+void event_post_deadline(event_queue_t *queue, event_deadline_t *event,
+                         uint32_t deadline);
+
+/**
+ * @brief   Insert a deadline event into an event list (used internally)
+ *
+ * @internal
+ *
+ * @pre     interrupts are disabled and @p event is not queued
+ *
+ * @param[in]   list        event list sorted by deadline
+ * @param[in]   event       event to insert, its deadline must already be set
+ */
+void _event_deadline_insert(clist_node_t *list, event_deadline_t *event);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_DEADLINE_H */
+/** @} */
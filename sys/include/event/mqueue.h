@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides prioritized sets of event queues
+ *
+ * event_wait_multi() checks the given queues one after the other, which
+ * becomes costly with many queues. An event multi-queue additionally keeps a
+ * bitmap of the queues that have events pending (similar to the runqueue
+ * bitmap of the scheduler), so that the highest priority non-empty queue is
+ * found in O(1).
+ *
+ * The queue with index 0 has the highest priority. Events must be posted
+ * using event_mqueue_post() (or event_mqueue_post_deadline()) for the bitmap
+ * to be updated. Canceling events using event_cancel() on one of the queues
+ * is fine, the bitmap is cleaned up lazily.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static event_queue_t queues[3];
+ * static event_mqueue_t mqueue;
+ *
+ * [...]
+ * event_mqueue_init(&mqueue, queues, ARRAY_SIZE(queues));
+ * event_mqueue_loop(&mqueue);
+ *
+ * [...]
+ * event_mqueue_post(&mqueue, 0, &urgent_event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event Multi-Queue API
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef EVENT_MQUEUE_H
+#define EVENT_MQUEUE_H
+
+#include <stdint.h>
+
+#include "event.h"
+#ifdef MODULE_EVENT_DEADLINE
+#include "event/deadline.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of queues in a multi-queue
+ */
+#define EVENT_MQUEUE_NUMOF_MAX  (sizeof(unsigned) * 8)
+
+/**
+ * @brief   Event multi-queue structure
+ */
+typedef struct {
+    event_queue_t *queues;      /**< queues, ordered by priority            */
+    unsigned pending;           /**< bitmap of (possibly) non-empty queues  */
+    uint8_t numof;              /**< number of queues in @ref queues        */
+} event_mqueue_t;
+
+/**
+ * @brief   Initialize an event multi-queue
+ *
+ * This will initialize all queues in @p queues and set the calling thread as
+ * their owner.
+ *
+ * @param[out]  mqueue      multi-queue to initialize
+ * @param[out]  queues      event queue objects to use, highest priority first
+ * @param[in]   n_queues    number of queues in @p queues, at most
+ *                          @ref EVENT_MQUEUE_NUMOF_MAX
+ */
+void event_mqueue_init(event_mqueue_t *mqueue, event_queue_t *queues,
+                       size_t n_queues);
+
+/**
+ * @brief   Queue an event in one of the queues of a multi-queue
+ *
+ * @param[in]   mqueue  multi-queue to queue event in
+ * @param[in]   prio    index of the queue to use
+ * @param[in]   event   event to queue
+ */
+void event_mqueue_post(event_mqueue_t *mqueue, unsigned prio, event_t *event);
+
+#if defined(MODULE_EVENT_DEADLINE) || defined(DOXYGEN)
+/**
+ * @brief   Queue an event ordered by deadline in one of the queues of a
+ *          multi-queue
+ *
+ * @see     event_post_deadline()
+ *
+ * @param[in]   mqueue      multi-queue to queue event in
+ * @param[in]   prio        index of the queue to use
+ * @param[in]   event       event to queue
+ * @param[in]   deadline    absolute deadline of the event
+ */
+void event_mqueue_post_deadline(event_mqueue_t *mqueue, unsigned prio,
+                                event_deadline_t *event, uint32_t deadline);
+#endif
+
+/**
+ * @brief   Get the next event of the highest priority non-empty queue,
+ *          non-blocking
+ *
+ * @param[in]   mqueue  multi-queue to get event from
+ *
+ * @returns     pointer to next event
+ * @returns     NULL if no event available
+ */
+event_t *event_mqueue_get(event_mqueue_t *mqueue);
+
+/**
+ * @brief   Get the next event of the highest priority non-empty queue,
+ *          blocking
+ *
+ * @warning There can only be a single waiter on a queue!
+ *
+ * @param[in]   mqueue  multi-queue to get event from
+ *
+ * @returns     pointer to next event
+ */
+event_t *event_mqueue_wait(event_mqueue_t *mqueue);
+
+/**
+ * @brief   Simple event loop for a multi-queue
+ *
+ * @param[in]   mqueue  multi-queue to process
+ */
+static inline void event_mqueue_loop(event_mqueue_t *mqueue)
+{
+    event_t *event;
+
+    while ((event = event_mqueue_wait(mqueue))) {
+        event->handler(event);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_MQUEUE_H */
+/** @} */
@@ -65,6 +65,34 @@ void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize);
  */
 int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c);
 
+/**
+ * @brief   Put multiple characters into the isrpipe's buffer
+ *
+ * @param[in]   isrpipe     isrpipe object to operate on
+ * @param[in]   buf         characters to add to isrpipe buffer
+ * @param[in]   count       number of characters in @p buf
+ *
+ * @returns     number of characters added, less than @p count if the buffer
+ *              was full
+ */
+int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t count);
+
+/**
+ * @brief   Read data from isrpipe (non-blocking)
+ *
+ * The data is copied out of the ringbuffer using @ref tsrb_peek_contiguous
+ * and @ref tsrb_commit, so interrupts are not disabled while copying.
+ *
+ * @note    Only safe to be used by a single reader
+ *
+ * @param[in]   isrpipe    isrpipe object to operate on
+ * @param[in]   buf        buffer to write to
+ * @param[in]   count      number of bytes to read
+ *
+ * @returns     number of bytes read, 0 if the isrpipe is empty
+ */
+int isrpipe_try_read(isrpipe_t *isrpipe, uint8_t *buf, size_t count);
+
 /**
  * @brief   Read data from isrpipe (blocking)
  *
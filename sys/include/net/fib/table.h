@@ -24,6 +24,9 @@
 #include "kernel_types.h"
 #include "universal_address.h"
 #include "mutex.h"
+#ifdef MODULE_FIB_RADIX
+#include "prefix_trie.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,6 +95,23 @@ typedef struct {
     size_t entry_pool_size;
 } fib_sr_meta_t;
 
+#if defined(MODULE_FIB_RADIX) || defined(DOXYGEN)
+/**
+ * @brief Node of the radix tree over the entries of a FIB table
+ *
+ * @note    Only available with module `fib_radix`.
+ */
+typedef prefix_trie_node_t fib_radix_node_t;
+
+/**
+ * @brief Number of radix tree nodes required for a FIB table of @p size
+ *        single hop entries
+ *
+ * @note    Only available with module `fib_radix`.
+ */
+#define FIB_RADIX_NODES_NUMOF(size) PREFIX_TRIE_NODES_NUMOF(size)
+#endif
+
 /**
 * @brief FIB table type for single hop entries
 */
@@ -133,6 +153,18 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if defined(MODULE_FIB_RADIX) || defined(DOXYGEN)
+    /** radix tree over the single hop entries of this table with
+    *   @ref FIB_RADIX_NODES_NUMOF(size) nodes. Lookups only visit the
+    *   entries whose prefix matches the destination.
+    *   Not used for source route tables.
+    *
+    *   @note Only available with module `fib_radix`.
+    */
+    fib_radix_node_t *radix;
+    /** the radix tree, set up by fib_init() */
+    prefix_trie_t radix_trie;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
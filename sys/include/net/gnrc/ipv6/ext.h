@@ -68,15 +68,17 @@ extern "C" {
 #endif
 
 /**
- * @brief   The number of total allocatable @ref gnrc_ipv6_ext_frag_limits_t objects
+ * @brief   The number of @ref gnrc_ipv6_ext_frag_limits_t objects per
+ *          reassembly buffer entry
  *
- * This is the maximum number of receivable fragments, shared between all
- * fragmented datagrams
+ * Adjacent fragments are merged into one object, so this is the maximum
+ * number of gaps in a datagram that is still being reassembled, not the
+ * number of its fragments.
  *
  * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
  */
-#ifndef CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE
-#define CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE (CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE * 2U)
+#ifndef CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_NUMOF
+#define CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_NUMOF     (4U)
 #endif
 
 /**
@@ -23,7 +23,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "clist.h"
+#include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/ipv6/hdr.h"
@@ -53,14 +53,15 @@ extern "C" {
 #define GNRC_IPV6_EXT_FRAG_SEND         (0xfe02U)
 
 /**
- * @brief   Data type to describe limits of a single fragment in the reassembly
- *          buffer
+ * @brief   Data type to describe limits of contiguously received fragments in
+ *          the reassembly buffer
+ *
+ * Both values are in units of 8 bytes.
  */
-typedef struct gnrc_ipv6_ext_frag_limits {
-    struct gnrc_ipv6_ext_frag_limits *next; /**< limits of next fragment */
-    uint16_t start;                         /**< the start (= offset) of the fragment */
+typedef struct {
+    uint16_t start;                         /**< the start (= offset) of the first fragment */
     uint16_t end;                           /**< the exclusive end (= offset + length) of the
-                                             *   fragment */
+                                             *   last fragment */
 } gnrc_ipv6_ext_frag_limits_t;
 
 /**
@@ -84,13 +85,18 @@ typedef struct {
     /**
      * @brief   The limits of the fragments in the reassembled packet
      *
-     * @note    Members of this list can be cast to gnrc_ipv6_ext_frag_limits_t.
+     * Sorted by gnrc_ipv6_ext_frag_limits_t::start. Adjacent fragments are
+     * merged into one entry, so the packet is complete when there is only
+     * one entry starting at 0 and the last fragment was received.
      */
-    clist_node_t limits;
+    gnrc_ipv6_ext_frag_limits_t limits[CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_NUMOF];
     uint32_t id;            /**< the identification from the fragment headers */
     uint32_t arrival;       /**< arrival time of last received fragment */
     uint16_t pkt_len;       /**< length of gnrc_ipv6_ext_frag_rbuf_t::pkt */
     uint8_t last;           /**< received last fragment */
+    uint8_t limits_numof;   /**< number of used entries in
+                             *   gnrc_ipv6_ext_frag_rbuf_t::limits */
+    uint8_t frags;          /**< number of fragments received */
 } gnrc_ipv6_ext_frag_rbuf_t;
 
 /**
@@ -103,6 +109,11 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    unsigned limits_full;   /**< counts the number of datagrams dropped
+                             *   because their reassembly buffer entry ran
+                             *   out of @ref gnrc_ipv6_ext_frag_limits_t */
+    unsigned rbuf_max_used; /**< maximum number of reassembly buffer entries
+                             *   used at the same time */
 } gnrc_ipv6_ext_frag_stats_t;
 
 /**
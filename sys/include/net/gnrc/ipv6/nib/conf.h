@@ -261,6 +261,19 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Use a hash table to look up neighbors by IPv6 address
+ *
+ * By default, every neighbor lookup, e.g. when resolving the link-layer
+ * address of the next hop of a packet, compares the address with all
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF entries. With this option, a hash table of
+ * 4 bytes per entry is kept, so a lookup takes constant time on average.
+ * Useful for routers with a large @ref CONFIG_GNRC_IPV6_NIB_NUMOF.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_ONL_HASH
+#define CONFIG_GNRC_IPV6_NIB_ONL_HASH                0
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -271,6 +284,19 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Use a trie for longest-prefix matching in the off-link entries
+ *
+ * By default, every route lookup compares the destination with the prefixes
+ * of all @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries. With this
+ * option, an index of 16 bytes per off-link entry is kept, so a lookup only
+ * visits the entries whose prefix is a prefix of the destination. Useful for
+ * border routers with many downstream routes.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE               0
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -54,6 +54,32 @@
  * USEMODULE += gnrc_netapi_callbacks
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
  * @}
+ *
+ * @defgroup    net_gnrc_netapi_train   Packet train extension
+ * @ingroup     net_gnrc_netapi
+ * @brief       Dispatch of multiple packets with one message
+ * @{
+ * @details The submodule `gnrc_netapi_train` allows to dispatch a burst of
+ *          packets with gnrc_netapi_dispatch_train(). Subscribers that set
+ *          gnrc_netreg_entry_t::train get all packets with a single
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN or
+ *          @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN message, all other subscribers
+ *          get one message per packet as before.
+ *
+ * Up the stack, @ref net_gnrc_netif collects the frames a device received
+ * back to back into a train (see @ref gnrc_netapi_rx_train_t), IPv6 and UDP
+ * handle a train in a loop and pass the packets for the same receiver on as
+ * a train again, and @ref net_gnrc_sock takes all packets of a train from its
+ * mailbox with a single message. Down the stack, sock_udp_send_batch() sends
+ * trains that UDP passes on to IPv6 as a train.
+ *
+ * To use, add the module `gnrc_netapi_train` to the `USEMODULE` macro in
+ * your application's Makefile:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.mk}
+ * USEMODULE += gnrc_netapi_train
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * @}
  */
 
 #ifndef NET_GNRC_NETAPI_H
@@ -93,6 +119,40 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a train of @ref net_gnrc_pkt up the
+ *          network stack
+ *
+ * @details The message content is a packet snip holding the packets of the
+ *          train, see gnrc_netapi_train_len() and gnrc_netapi_train_pkt().
+ *          The receiver takes ownership of every packet and has to release
+ *          the train snip itself when done.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_TRAIN  (0x0207)
+
+/**
+ * @brief   @ref core_msg type for passing a train of @ref net_gnrc_pkt down
+ *          the network stack
+ *
+ * @see     @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN
+ */
+#define GNRC_NETAPI_MSG_TYPE_SND_TRAIN  (0x0208)
+
+/**
+ * @defgroup net_gnrc_netapi_conf  GNRC netapi compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Maximum number of packets in a @ref gnrc_netapi_rx_train_t
+ *
+ * @note    Only used with @ref net_gnrc_netapi_train.
+ */
+#ifndef CONFIG_GNRC_NETAPI_RX_TRAIN_LEN
+#define CONFIG_GNRC_NETAPI_RX_TRAIN_LEN     (8U)
+#endif
+/** @} */
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -215,6 +275,169 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+#if defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+/**
+ * @brief   Dispatch statistics
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ */
+typedef struct {
+    uint32_t msgs;      /**< messages sent by the dispatch functions */
+    uint32_t pkts;      /**< packets delivered by the dispatch functions */
+} gnrc_netapi_train_stats_t;
+
+/**
+ * @brief   Received packets to be dispatched as one train
+ *
+ * Collects consecutive packets for the same receivers, see
+ * gnrc_netapi_rx_train_add().
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ */
+typedef struct {
+    gnrc_nettype_t type;        /**< protocol type of the receivers */
+    uint32_t demux_ctx;         /**< demultiplexing context of the receivers */
+    unsigned numof;             /**< number of packets in gnrc_netapi_rx_train_t::pkts */
+    gnrc_pktsnip_t *pkts[CONFIG_GNRC_NETAPI_RX_TRAIN_LEN]; /**< the packets */
+} gnrc_netapi_rx_train_t;
+
+/**
+ * @brief   Sends @p cmd for all packets in @p pkts to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * Subscribers that accept trains get all packets with one
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN or @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN
+ * message, all others get @p cmd for every packet as with
+ * gnrc_netapi_dispatch(). If the train can't be allocated from the packet
+ * buffer, all subscribers get @p cmd for every packet.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] cmd       either @ref GNRC_NETAPI_MSG_TYPE_RCV or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND
+ * @param[in] pkts      packets to send
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+int gnrc_netapi_dispatch_train(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *const *pkts,
+                               unsigned numof);
+
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV command for all packets in
+ *          @p pkts to all subscribers to (@p type, @p demux_ctx).
+ *
+ * @see     gnrc_netapi_dispatch_train()
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      packets to send
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+static inline int gnrc_netapi_dispatch_receive_train(gnrc_nettype_t type,
+                                                     uint32_t demux_ctx,
+                                                     gnrc_pktsnip_t *const *pkts,
+                                                     unsigned numof)
+{
+    return gnrc_netapi_dispatch_train(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV,
+                                      pkts, numof);
+}
+
+/**
+ * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_SND command for all packets in
+ *          @p pkts to all subscribers to (@p type, @p demux_ctx).
+ *
+ * @see     gnrc_netapi_dispatch_train()
+ *
+ * @param[in] type      protocol type of the targeted network module.
+ * @param[in] demux_ctx demultiplexing context for @p type.
+ * @param[in] pkts      packets to send
+ * @param[in] numof     number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx).
+ */
+static inline int gnrc_netapi_dispatch_send_train(gnrc_nettype_t type,
+                                                  uint32_t demux_ctx,
+                                                  gnrc_pktsnip_t *const *pkts,
+                                                  unsigned numof)
+{
+    return gnrc_netapi_dispatch_train(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_SND,
+                                      pkts, numof);
+}
+
+/**
+ * @brief   Adds a received packet to a train
+ *
+ * The train is dispatched first with gnrc_netapi_rx_train_flush(), if it is
+ * full or its packets are for other receivers than (@p type, @p demux_ctx).
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in,out] train     the train, zero-initialized before first use
+ * @param[in] type          protocol type of the receivers of @p pkt
+ * @param[in] demux_ctx     demultiplexing context of the receivers of @p pkt
+ * @param[in] pkt           the packet
+ */
+void gnrc_netapi_rx_train_add(gnrc_netapi_rx_train_t *train,
+                              gnrc_nettype_t type, uint32_t demux_ctx,
+                              gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Dispatches the packets of a train with
+ *          gnrc_netapi_dispatch_receive_train()
+ *
+ * The packets are released, if no one is interested in them.
+ *
+ * @note    Only available with @ref net_gnrc_netapi_train.
+ *
+ * @param[in,out] train     the train, empty afterwards
+ *
+ * @return Number of subscribers the packets were dispatched to
+ */
+int gnrc_netapi_rx_train_flush(gnrc_netapi_rx_train_t *train);
+
+/**
+ * @brief   Gets the number of packets in a train
+ *
+ * @param[in] train     content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN message
+ *
+ * @return  Number of packets in @p train
+ */
+static inline unsigned gnrc_netapi_train_len(const gnrc_pktsnip_t *train)
+{
+    return train->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet of a train
+ *
+ * @param[in] train     content of a @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN message
+ * @param[in] idx       index of the packet, must be less than
+ *                      gnrc_netapi_train_len()
+ *
+ * @return  The packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_train_pkt(const gnrc_pktsnip_t *train,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)train->data)[idx];
+}
+
+/**
+ * @brief   Gets the dispatch statistics
+ *
+ * @param[out] stats    the statistics since boot
+ */
+void gnrc_netapi_train_stats(gnrc_netapi_train_stats_t *stats);
+#endif
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
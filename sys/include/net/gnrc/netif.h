@@ -182,6 +182,15 @@ typedef struct {
      * @note    Only available with @ref net_gnrc_netif_pktq.
      */
     gnrc_netif_pktq_t send_queue;
+#endif
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+    /**
+     * @brief   Frames received back to back, passed on as one train when the
+     *          interface becomes idle
+     *
+     * @note    Only available with @ref net_gnrc_netapi_train.
+     */
+    gnrc_netapi_rx_train_t rx_train;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
@@ -24,6 +24,21 @@
 extern "C" {
 #endif
 
+/**
+ * @name    Local 6LoWPAN capability flags
+ * @anchor  net_gnrc_netif_6lo_local_flags
+ * @see     gnrc_netif_6lo_t::local_flags
+ * @{
+ */
+/**
+ * @brief   Selective Fragment Recovery enabled
+ *
+ * Datagrams sent over this interface are fragmented using
+ * @ref net_gnrc_sixlowpan_frag_sfr instead of classic 6LoWPAN fragmentation.
+ */
+#define GNRC_NETIF_6LO_LOCAL_FLAGS_SFR      (0x01)
+/** @} */
+
 /**
  * @brief   6Lo component of @ref gnrc_netif_t
  */
@@ -35,6 +50,13 @@ typedef struct {
      *          @ref net_gnrc_sixlowpan_frag "gnrc_sixlowpan_frag".
      */
     uint16_t max_frag_size;
+    /**
+     * @brief   6LoWPAN capability flags beyond the ones advertised in
+     *          6LoWPAN Capability Indication Option (6CIO)
+     *
+     * @see [local flags](@ref net_gnrc_netif_6lo_local_flags)
+     */
+    uint8_t local_flags;
 } gnrc_netif_6lo_t;
 
 #ifdef __cplusplus
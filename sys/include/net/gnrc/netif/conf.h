@@ -78,6 +78,37 @@ extern "C" {
 #define CONFIG_GNRC_NETIF_PKTQ_TIMER_US       (5000U)
 #endif
 
+/**
+ * @brief       Target sojourn time in microseconds of a packet in the send
+ *              queue
+ *
+ * When the sojourn time of the packets in a queue stays above this target
+ * for at least @ref CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US, CoDel starts to
+ * drop packets from that queue.
+ *
+ * The defaults are larger than those of RFC 8289 to account for the
+ * transmission times of slow radios.
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_codel`
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US
+#define CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US    (20000U)
+#endif
+
+/**
+ * @brief       Interval in microseconds for CoDel in the send queue
+ *
+ * Should be in the order of the worst-case round-trip time through the
+ * interface.
+ *
+ * @note        Only applicable with module `gnrc_netif_pktq_codel`
+ * @see         net_gnrc_netif_pktq
+ */
+#ifndef CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US
+#define CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US  (200000U)
+#endif
+
 /**
  * @brief   Number of multicast addresses needed for @ref net_gnrc_rpl "RPL".
  *
@@ -9,7 +9,25 @@
 /**
  * @defgroup    net_gnrc_netif_pktq Send queue for @ref net_gnrc_netif
  * @ingroup     net_gnrc_netif
- * @brief
+ * @brief       Send queue for @ref net_gnrc_netif
+ *
+ * Packets that can not be sent right away, because the device is busy, are
+ * kept in the send queue of the interface. By default the send queue is a
+ * single FIFO queue. Its discipline can be extended with the following
+ * modules, which can also be combined:
+ *
+ * - `gnrc_netif_pktq_prio`: Packets are sorted into strict priority classes
+ *   (see @ref GNRC_NETIF_PKTQ_PRIO_CONTROL) by their DSCP or when they are
+ *   ICMPv6, so e.g. NDP and RPL messages are not stuck behind bulk traffic.
+ *   When the pool is depleted, a packet of a higher class replaces the
+ *   last packet of the lowest non-empty class below it.
+ * - `gnrc_netif_pktq_codel`: Every class is managed with
+ *   [CoDel](https://tools.ietf.org/html/rfc8289), which drops packets when
+ *   their sojourn time in the queue stays above
+ *   @ref CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US for more than
+ *   @ref CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US.
+ *
+ * Per class statistics are kept in gnrc_netif_pktq_t::stats.
  * @{
  *
  * @file
@@ -42,13 +60,18 @@ extern "C" {
  *
  * @return  0 on success
  * @return  -1 when the pool of available gnrc_pktqueue_t entries (of size
- *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted
+ *          @ref CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE) is depleted and no packet
+ *          of a lower priority class could be dropped instead
  */
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
 
 /**
  * @brief   Gets a packet from the packet send queue of a network interface
  *
+ * The packet is taken from the highest priority class that is not empty.
+ * With module `gnrc_netif_pktq_codel`, packets dropped by CoDel are released
+ * before the next packet is returned.
+ *
  * @pre `netif != NULL`
  *
  * @param[in] netif A network interface. May not be NULL.
@@ -56,26 +79,24 @@ int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt);
  * @return  A packet on success
  * @return  NULL when the queue is empty
  */
-static inline gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
-{
-#if IS_USED(MODULE_GNRC_NETIF_PKTQ)
-    assert(netif != NULL);
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif);
 
-    gnrc_pktsnip_t *pkt = NULL;
-    gnrc_pktqueue_t *entry = gnrc_pktqueue_remove_head(
-        &netif->send_queue.queue
-    );
-
-    if (entry != NULL) {
-        pkt = entry->pkt;
-        entry->pkt = NULL;
-    }
-    return pkt;
-#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-    (void)netif;
-    return NULL;
-#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
-}
+/**
+ * @brief   Gets the priority class of a packet
+ *
+ * The class is decided by the first IPv6 header in @p pkt, which may also be
+ * compressed with 6LoWPAN IPHC. Packets without any IPv6 header are in class
+ * @ref GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT.
+ *
+ * @pre `pkt != NULL`
+ *
+ * @param[in] pkt   A packet. May not be NULL.
+ *
+ * @return  The priority class of @p pkt, always
+ *          @ref GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT without module
+ *          `gnrc_netif_pktq_prio`.
+ */
+unsigned gnrc_netif_pktq_prio_class(const gnrc_pktsnip_t *pkt);
 
 /**
  * @brief   Schedule a dequeue notification to network interface
@@ -123,7 +144,12 @@ static inline bool gnrc_netif_pktq_empty(gnrc_netif_t *netif)
 #if IS_USED(MODULE_GNRC_NETIF_PKTQ)
     assert(netif != NULL);
 
-    return (netif->send_queue.queue == NULL);
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_PRIO_NUMOF; i++) {
+        if (netif->send_queue.queue[i] != NULL) {
+            return false;
+        }
+    }
+    return true;
 #else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ) */
     (void)netif;
     return false;
@@ -23,6 +23,10 @@
 #ifndef NET_GNRC_NETIF_PKTQ_TYPE_H
 #define NET_GNRC_NETIF_PKTQ_TYPE_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "kernel_defines.h"
 #include "net/gnrc/pktqueue.h"
 #include "xtimer.h"
 
@@ -30,11 +34,111 @@
 extern "C" {
 #endif
 
+/**
+ * @name    Priority classes
+ * @brief   Classes of the send queue, in order of decreasing priority
+ *
+ * @note    Only with module `gnrc_netif_pktq_prio` there are several
+ *          classes. Otherwise, all packets are in class
+ *          @ref GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT.
+ * @{
+ */
+/**
+ * @brief   Network control traffic
+ *
+ * ICMPv6 (e.g. NDP and RPL messages) and packets with DSCP CS6 or CS7.
+ */
+#define GNRC_NETIF_PKTQ_PRIO_CONTROL        (0U)
+/**
+ * @brief   Expedited traffic
+ *
+ * Packets with a DSCP of class selector CS4 and above, e.g. EF.
+ */
+#define GNRC_NETIF_PKTQ_PRIO_EXPEDITED      (1U)
+/**
+ * @brief   All other traffic
+ */
+#define GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT    (2U)
+/** @} */
+
+/**
+ * @brief   Number of priority classes of a send queue
+ */
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) || defined(DOXYGEN)
+#define GNRC_NETIF_PKTQ_PRIO_NUMOF          (3U)
+#else
+#define GNRC_NETIF_PKTQ_PRIO_NUMOF          (1U)
+#endif
+
+/**
+ * @brief   Statistics of a priority class of a send queue
+ */
+typedef struct {
+    uint16_t len;               /**< current number of queued packets */
+    uint16_t max_len;           /**< maximum number of queued packets */
+    uint32_t full;              /**< number of packets that could not be
+                                 *   queued, because the pool was depleted */
+    uint32_t evicted;           /**< number of packets dropped in favor of a
+                                 *   packet of a higher priority class */
+    uint32_t aqm_drops;         /**< number of packets dropped by CoDel */
+} gnrc_netif_pktq_stats_t;
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL) || defined(DOXYGEN)
+/**
+ * @brief   CoDel state of a priority class of a send queue
+ *
+ * @see [RFC 8289](https://tools.ietf.org/html/rfc8289)
+ *
+ * @note    Only available with module `gnrc_netif_pktq_codel`
+ */
+typedef struct {
+    uint32_t first_above_time;  /**< time the sojourn time will have been
+                                 *   above target for an interval, 0 if it
+                                 *   is below target */
+    uint32_t drop_next;         /**< time to drop the next packet */
+    uint32_t count;             /**< packets dropped since entering the
+                                 *   dropping state, saturates at
+                                 *   UINT32_MAX */
+    uint32_t lastcount;         /**< gnrc_netif_pktq_codel_t::count when
+                                 *   the dropping state was entered last */
+    bool dropping;              /**< in dropping state */
+} gnrc_netif_pktq_codel_t;
+#endif
+
 /**
  * @brief   A packet queue for @ref net_gnrc_netif with a de-queue timer
  */
 typedef struct {
-    gnrc_pktqueue_t *queue;     /**< the actual packet queue class */
+    /**
+     * @brief   The actual packet queues, one per priority class
+     */
+    gnrc_pktqueue_t *queue[GNRC_NETIF_PKTQ_PRIO_NUMOF];
+    /**
+     * @brief   Statistics, one per priority class
+     */
+    gnrc_netif_pktq_stats_t stats[GNRC_NETIF_PKTQ_PRIO_NUMOF];
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL) || defined(DOXYGEN)
+    /**
+     * @brief   CoDel state, one per priority class
+     *
+     * @note    Only available with module `gnrc_netif_pktq_codel`
+     */
+    gnrc_netif_pktq_codel_t codel[GNRC_NETIF_PKTQ_PRIO_NUMOF];
+    /**
+     * @brief   Packet last returned by gnrc_netif_pktq_get()
+     *
+     * If it is pushed back, it keeps the time it was queued originally.
+     *
+     * @note    Only available with module `gnrc_netif_pktq_codel`
+     */
+    gnrc_pktsnip_t *last_pkt;
+    /**
+     * @brief   Time gnrc_netif_pktq_t::last_pkt was queued
+     *
+     * @note    Only available with module `gnrc_netif_pktq_codel`
+     */
+    uint32_t last_enqueued;
+#endif
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
     msg_t dequeue_msg;          /**< message for gnrc_netif_pktq_t::dequeue_timer to send */
     xtimer_t dequeue_timer;     /**< timer to schedule next sending of
@@ -10,6 +10,12 @@
  * @defgroup    net_gnrc_netreg  Network protocol registry
  * @ingroup     net_gnrc
  * @brief       Registry to receive messages of a specified protocol type by GNRC.
+ *
+ * By default, the entries of every @ref gnrc_nettype_t are kept in a list
+ * that is searched linearly for the demultiplexing context on every packet.
+ * With many registrations for one type, e.g. lots of bound UDP ports, use the
+ * `gnrc_netreg_hash` module to distribute the entries of every type over
+ * @ref CONFIG_GNRC_NETREG_HASH_BUCKETS lists by their demultiplexing context.
  * @{
  *
  * @file
@@ -22,6 +28,7 @@
 #define NET_GNRC_NETREG_H
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 #include "kernel_types.h"
 #include "net/gnrc/nettype.h"
@@ -79,6 +86,35 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC network protocol registry compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per @ref gnrc_nettype_t
+ *
+ * @note    Only used with `gnrc_netreg_hash`.
+ *
+ * @attention   Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_BUCKETS
+#define CONFIG_GNRC_NETREG_HASH_BUCKETS     (8U)
+#endif
+/** @} */
+
+/**
+ * @brief   Initializer for gnrc_netreg_entry_t::train in the static
+ *          initialization macros
+ *
+ * @internal
+ */
+#if defined(MODULE_GNRC_NETAPI_TRAIN)
+#define GNRC_NETREG_ENTRY_INIT_TRAIN    , false
+#else
+#define GNRC_NETREG_ENTRY_INIT_TRAIN
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -96,9 +132,11 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid } \
+                                                      GNRC_NETREG_ENTRY_INIT_TRAIN }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } \
+                                                      GNRC_NETREG_ENTRY_INIT_TRAIN }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -115,7 +153,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+                                                       { .mbox = _mbox } \
+                                                       GNRC_NETREG_ENTRY_INIT_TRAIN }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -132,7 +171,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+                                                      { .cbd = _cbd } \
+                                                      GNRC_NETREG_ENTRY_INIT_TRAIN }
 /** @} */
 
 /**
@@ -210,6 +250,17 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+    /**
+     * @brief   The registering thread accepts
+     *          @ref GNRC_NETAPI_MSG_TYPE_RCV_TRAIN and
+     *          @ref GNRC_NETAPI_MSG_TYPE_SND_TRAIN messages
+     *
+     * @note    Only available with @ref net_gnrc_netapi_train. Ignored for
+     *          other targets than threads and mailboxes.
+     */
+    bool train;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -241,6 +292,9 @@ static inline void gnrc_netreg_entry_init_pid(gnrc_netreg_entry_t *entry,
     entry->type = GNRC_NETREG_TYPE_DEFAULT;
 #endif
     entry->target.pid = pid;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    entry->train = false;
+#endif
 }
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -262,6 +316,9 @@ static inline void gnrc_netreg_entry_init_mbox(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_MBOX;
     entry->target.mbox = mbox;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    entry->train = false;
+#endif
 }
 #endif
 
@@ -284,6 +341,9 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
     entry->demux_ctx = demux_ctx;
     entry->type = GNRC_NETREG_TYPE_CB;
     entry->target.cbd = cbd;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    entry->train = false;
+#endif
 }
 #endif
 /** @} */
@@ -120,7 +120,9 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
  * @param[in] type  The type of the new packet snip.
  *
  * @note    It's not guaranteed that `result->data` points to the same address
- *          as the original `pkt->data`.
+ *          as the original `pkt->data`. If the data can not be split in
+ *          place, only the smaller of both parts is copied, so marking a
+ *          header in front of a large payload does not copy the payload.
  *
  * @return  The new packet snip in @p pkt on success.
  * @return  NULL, if pkt == NULL or size == 0 or size > pkt->size or pkt->data == NULL.
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_pktbuf_slab    Size-class packet buffer
+ * @ingroup     net_gnrc_pktbuf
+ * @brief       Packet buffer backend with fixed size classes
+ *
+ * This backend of @ref net_gnrc_pktbuf splits its memory into three pools of
+ * equally sized blocks:
+ *
+ * - @ref GNRC_PKTBUF_SLAB_SNIP: blocks for @ref gnrc_pktsnip_t descriptors
+ * - @ref GNRC_PKTBUF_SLAB_SMALL: blocks for small headers
+ * - @ref GNRC_PKTBUF_SLAB_LARGE: blocks for MTU-sized payloads
+ *
+ * Each pool keeps a free list, so allocating and freeing is done in constant
+ * time and the buffer does not fragment. If the pool of the smallest fitting
+ * class is exhausted, the next larger one is used.
+ *
+ * Data that is larger than @ref CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE can not be
+ * allocated. Increase it for link layers with a larger MTU, e.g. to 1536
+ * for Ethernet.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Size-class packet buffer definitions
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_PKTBUF_SLAB_H
+#define NET_GNRC_PKTBUF_SLAB_H
+
+#include <stdint.h>
+
+#ifdef MODULE_NETDEV_ETH
+#include "net/ethernet.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_pktbuf_slab_conf GNRC size-class packet buffer compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of blocks for packet snip descriptors
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32U)
+#endif
+
+/**
+ * @brief   Size of a block for small headers in bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64U)
+#endif
+
+/**
+ * @brief   Number of blocks for small headers
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (16U)
+#endif
+
+/**
+ * @brief   Size of a block for payloads in bytes
+ *
+ * @details This is the largest packet snip that can be allocated. Network
+ *          interfaces receive a whole frame into one snip, so with Ethernet
+ *          (`netdev_eth`) this defaults to @ref ETHERNET_FRAME_LEN and to a
+ *          full-MTU IPv6 packet otherwise.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#if defined(MODULE_NETDEV_ETH)
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (ETHERNET_FRAME_LEN)
+#else
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1280U)
+#endif
+#endif
+
+/**
+ * @brief   Number of blocks for payloads
+ *
+ * @details The rational here is the same as for @ref CONFIG_GNRC_PKTBUF_SIZE:
+ *          2 incoming and 2 outgoing full-MTU IPv6 packets.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Size classes of the packet buffer
+ */
+typedef enum {
+    GNRC_PKTBUF_SLAB_SNIP,          /**< packet snip descriptors */
+    GNRC_PKTBUF_SLAB_SMALL,         /**< small headers */
+    GNRC_PKTBUF_SLAB_LARGE,         /**< payloads */
+    GNRC_PKTBUF_SLAB_NUMOF,         /**< number of size classes */
+} gnrc_pktbuf_slab_class_t;
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    uint16_t size;                  /**< size of a block in bytes */
+    uint16_t numof;                 /**< number of blocks */
+    uint16_t used;                  /**< number of blocks currently in use */
+    uint16_t max_used;              /**< maximum number of blocks in use */
+    uint16_t failed;                /**< allocations of this class that
+                                     *   could not be served by it or any
+                                     *   larger class */
+} gnrc_pktbuf_slab_stats_t;
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * @param[in] cls       A size class
+ * @param[out] stats    The statistics of @p cls
+ */
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_t cls,
+                                gnrc_pktbuf_slab_stats_t *stats);
+
+/**
+ * @brief   Resets the high-water marks and failure counters of all size
+ *          classes
+ */
+void gnrc_pktbuf_slab_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_PKTBUF_SLAB_H */
+/** @} */
@@ -39,6 +39,13 @@ typedef struct gnrc_priority_pktqueue_node {
     struct gnrc_priority_pktqueue_node *next;   /**< next queue node */
     uint32_t priority;                          /**< queue node priority */
     gnrc_pktsnip_t *pkt;                        /**< queue node data */
+#if defined(MODULE_CORE_PRIORITY_QUEUE_HEAP) || defined(DOXYGEN)
+    /* must mirror the layout of priority_queue_node_t */
+    struct gnrc_priority_pktqueue_node *child;  /**< first child in the heap */
+    struct gnrc_priority_pktqueue_node *prev;   /**< previous sibling or
+                                                     parent in the heap */
+    uint32_t seq;                               /**< insertion order */
+#endif
 } gnrc_priority_pktqueue_node_t;
 
 /**
@@ -49,7 +56,8 @@ typedef priority_queue_t gnrc_priority_pktqueue_t;
 /**
  * @brief Static initializer for gnrc_priority_pktqueue_node_t.
  */
-#define PRIORITY_PKTQUEUE_NODE_INIT(priority, pkt) { NULL, priority, pkt }
+#define PRIORITY_PKTQUEUE_NODE_INIT(_priority, _pkt) \
+    { .next = NULL, .priority = (_priority), .pkt = (_pkt) }
 
 /**
  * @brief Static initializer for gnrc_priority_pktqueue_t.
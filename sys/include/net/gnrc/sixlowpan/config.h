@@ -86,6 +86,20 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US (3U * US_PER_SEC)
 #endif
 
+/**
+ * @brief   Number of byte intervals a reassembly buffer entry can track
+ *
+ * Adjacent fragments are merged into one interval, so this limits the number
+ * of gaps in a datagram that is still being reassembled, not the number of
+ * its fragments. A datagram that would need more intervals is dropped.
+ *
+ * @note    Only applicable with
+ *          [gnrc_sixlowpan_frag_rb](@ref net_gnrc_sixlowpan_frag_rb) module
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INTS_NUMOF
+#define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INTS_NUMOF (8U)
+#endif
+
 /**
  * @brief   Do not override oldest datagram when reassembly buffer is full
  *
@@ -164,9 +178,7 @@ extern "C" {
  * @see     https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  *
  * @note    Only applicable with
- *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module,
- *          but has also a direct influence on the number of available
- *          gnrc_sixlowpan_frag_rb_int_t entries.
+ *          [gnrc_sixlowpan_frag_vrb](@ref net_gnrc_sixlowpan_frag_vrb) module.
  */
 #ifndef CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE        (16U)
@@ -309,6 +321,17 @@ extern "C" {
 #ifndef GNRC_SIXLOWPAN_SFR_DG_RETRIES
 #define GNRC_SIXLOWPAN_SFR_DG_RETRIES       (0U)
 #endif
+
+/**
+ * @brief   Enable selective fragment recovery on all fragmenting interfaces
+ *          when they are initialized
+ *
+ * When 0, selective fragment recovery needs to be enabled per interface with
+ * @ref gnrc_sixlowpan_frag_sfr_netif_enable().
+ */
+#ifndef GNRC_SIXLOWPAN_SFR_NETIF_DEFAULT
+#define GNRC_SIXLOWPAN_SFR_NETIF_DEFAULT    (0U)
+#endif
 /** @} */
 
 /**
@@ -25,6 +25,10 @@
 
 #include "net/gnrc/netif/hdr.h"
 #include "net/gnrc/pkt.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "bitfield.h"
+#include "net/sixlowpan/sfr.h"
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 
 #include "net/gnrc/sixlowpan/config.h"
 
@@ -39,6 +43,9 @@ extern "C" {
 /**
  * @brief   Fragment intervals to identify limits of fragments and duplicates.
  *
+ * Adjacent fragments are merged into a single interval, so an interval
+ * describes a contiguous range of already received bytes of a datagram.
+ *
  * @note    Fragments MUST NOT overlap and overlapping fragments are to be
  *          discarded
  *
@@ -46,13 +53,10 @@ extern "C" {
  *          RFC 4944, section 5.3
  *      </a>
  */
-typedef struct gnrc_sixlowpan_frag_rb_int {
-    /**
-     * @brief   next element in fragment interval list
-     */
-    struct gnrc_sixlowpan_frag_rb_int *next;
+typedef struct {
     uint16_t start;             /**< start byte of the fragment interval */
-    uint16_t end;               /**< end byte of the fragment interval */
+    uint16_t end;               /**< end byte of the fragment interval
+                                 *   (inclusive) */
 } gnrc_sixlowpan_frag_rb_int_t;
 
 /**
@@ -69,7 +73,6 @@ typedef struct gnrc_sixlowpan_frag_rb_int {
  * @see https://tools.ietf.org/html/draft-ietf-lwig-6lowpan-virtual-reassembly-01
  */
 typedef struct {
-    gnrc_sixlowpan_frag_rb_int_t *ints;         /**< intervals of already received fragments */
     uint8_t src[IEEE802154_LONG_ADDRESS_LEN];   /**< source address */
     uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];   /**< destination address */
     uint8_t src_len;                            /**< length of gnrc_sixlowpan_frag_rb_t::src */
@@ -82,6 +85,17 @@ typedef struct {
     uint16_t current_size;
     uint32_t arrival;                           /**< time in microseconds of arrival of
                                                  *   last received fragment */
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
+    /**
+     * @brief   Sequence numbers of the received recoverable fragments
+     *
+     * In the format of sixlowpan_sfr_ack_t::bitmap, so it can be copied
+     * directly into an RFRAG acknowledgment.
+     *
+     * @note    Only available with module `gnrc_sixlowpan_frag_sfr`
+     */
+    BITFIELD(received, SIXLOWPAN_SFR_ACK_BITMAP_SIZE);
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 } gnrc_sixlowpan_frag_rb_base_t;
 
 /**
@@ -96,6 +110,13 @@ typedef struct {
      * @brief   The reassembled packet in the packet buffer
      */
     gnrc_pktsnip_t *pkt;
+    /**
+     * @brief   Intervals of already received bytes, sorted by
+     *          gnrc_sixlowpan_frag_rb_int_t::start
+     */
+    gnrc_sixlowpan_frag_rb_int_t ints[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INTS_NUMOF];
+    uint8_t ints_numof;     /**< number of used entries in gnrc_sixlowpan_frag_rb_t::ints */
+    uint8_t frags;          /**< number of fragments received for the datagram */
 } gnrc_sixlowpan_frag_rb_t;
 
 /**
@@ -240,6 +261,8 @@ static inline void gnrc_sixlowpan_frag_rb_remove(gnrc_sixlowpan_frag_rb_t *rbuf)
     assert(rbuf != NULL);
     gnrc_sixlowpan_frag_rb_base_rm(&rbuf->super);
     rbuf->pkt = NULL;
+    rbuf->ints_numof = 0;
+    rbuf->frags = 0;
 }
 #else
 /* NOPs to be used with gnrc_sixlowpan_iphc if gnrc_sixlowpan_frag_rb is not
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_sixlowpan_frag_sfr 6LoWPAN selective fragment recovery
+ * @ingroup     net_gnrc_sixlowpan_frag
+ * @brief       6LoWPAN selective fragment recovery implementation for GNRC
+ * @see         [RFC 8931](https://tools.ietf.org/html/rfc8931)
+ *
+ * With selective fragment recovery (SFR) every fragment carries a sequence
+ * number and the reassembling endpoint reports which fragments it received
+ * in an RFRAG acknowledgment (RFRAG-ACK). Only the fragments missing in that
+ * report are resent, instead of the whole datagram.
+ *
+ * Include the module with
+ *
+ * ```Makefile
+ * USEMODULE += gnrc_sixlowpan_frag_sfr
+ * ```
+ *
+ * and enable it for the interfaces that should send recoverable fragments
+ * with @ref gnrc_sixlowpan_frag_sfr_netif_enable() (see @ref
+ * GNRC_NETIF_6LO_LOCAL_FLAGS_SFR). To enable it on all interfaces that
+ * fragment 6LoWPAN datagrams set @ref GNRC_SIXLOWPAN_SFR_NETIF_DEFAULT to 1.
+ * All other interfaces keep using classic 6LoWPAN fragmentation. Both
+ * classic and recoverable fragments are always received and reassembled.
+ *
+ * The sender keeps a window of up to @ref GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE
+ * unacknowledged fragments and requests an acknowledgment with the last
+ * fragment of each window. The window is halved (down to @ref
+ * GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) whenever fragments are lost or, with
+ * @ref GNRC_SIXLOWPAN_SFR_USE_ECN, congestion is reported. It grows by one
+ * fragment (up to @ref GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE) for every window that
+ * was acknowledged completely. If no acknowledgment arrives within @ref
+ * GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS the last fragment of the window is
+ * resent. Fragments are resent at most @ref GNRC_SIXLOWPAN_SFR_FRAG_RETRIES
+ * times before the datagram is aborted.
+ *
+ * Intermediate nodes forward recoverable fragments using the @ref
+ * net_gnrc_sixlowpan_frag_vrb "virtual reassembly buffer" if module
+ * `gnrc_sixlowpan_frag_vrb` is included and relay the acknowledgments back
+ * to the sender. With module `gnrc_sixlowpan_frag_stats` the number of resent
+ * fragments and datagrams, of aborted datagrams, and of received
+ * acknowledgments is counted in @ref gnrc_sixlowpan_frag_stats_t.
+ *
+ * To try it out on `native`, build an application using GNRC, e.g.
+ * `examples/gnrc_networking`, with `USEMODULE += socket_zep
+ * gnrc_sixlowpan_frag_sfr` and `CFLAGS += -DGNRC_SIXLOWPAN_SFR_NETIF_DEFAULT=1`
+ * and start two instances connected to each other:
+ *
+ *     $ make -C examples/gnrc_networking term TERMFLAGS="-z [::1]:17754,[::1]:17755"
+ *     $ make -C examples/gnrc_networking term TERMFLAGS="-z [::1]:17755,[::1]:17754"
+ *
+ * Pinging one node from the other with a payload larger than a fragment
+ * (e.g. `ping6 -s 500 <addr>`) then uses selective fragment recovery.
+ *
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN selective fragment recovery definitions for GNRC
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_H
+
+#include <stdbool.h>
+
+#include "net/gnrc/netif.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/fb.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/sixlowpan/sfr.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Message type for an ARQ timeout of a fragmentation buffer entry
+ *
+ * `msg_t::content::value` is the datagram tag of the
+ * @ref gnrc_sixlowpan_frag_fb_t the timeout occurred for.
+ */
+#define GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG     (0x0227)
+
+/**
+ * @brief   Message type for sending the next fragment after the inter-frame
+ *          gap passed
+ */
+#define GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_MSG (0x0228)
+
+/**
+ * @brief   Initializes selective fragment recovery
+ *
+ * Must be called from the 6LoWPAN thread before any other function of this
+ * module.
+ */
+void gnrc_sixlowpan_frag_sfr_init(void);
+
+/**
+ * @brief   Checks if an interface uses selective fragment recovery
+ *
+ * @param[in] netif A network interface
+ *
+ * @return  true, if @p netif uses selective fragment recovery
+ * @return  false, if @p netif uses classic 6LoWPAN fragmentation
+ */
+static inline bool gnrc_sixlowpan_frag_sfr_netif(const gnrc_netif_t *netif)
+{
+    return (netif->sixlo.local_flags & GNRC_NETIF_6LO_LOCAL_FLAGS_SFR);
+}
+
+/**
+ * @brief   Enables or disables selective fragment recovery for an interface
+ *
+ * Datagrams that are already being fragmented are not affected.
+ *
+ * @param[in] netif     A 6LoWPAN network interface
+ * @param[in] enable    true, to send recoverable fragments over @p netif,
+ *                      false, to use classic 6LoWPAN fragmentation
+ */
+void gnrc_sixlowpan_frag_sfr_netif_enable(gnrc_netif_t *netif, bool enable);
+
+/**
+ * @brief   Sends a packet via selective fragment recovery
+ *
+ * @pre `ctx != NULL`
+ * @pre gnrc_sixlowpan_frag_fb_t::pkt of @p ctx is equal to @p pkt or
+ *      `pkt == NULL`.
+ *
+ * @param[in] pkt       A packet. May be NULL.
+ * @param[in] ctx       A fragmentation buffer entry. Expected to be of type
+ *                      @ref gnrc_sixlowpan_frag_fb_t, with
+ *                      gnrc_sixlowpan_frag_fb_t::pkt set to @p pkt. Must not
+ *                      be NULL.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ */
+void gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page);
+
+/**
+ * @brief   Handles a packet containing a selective fragment recovery header
+ *          (either an RFRAG or an RFRAG-ACK)
+ *
+ * @param[in] pkt       The packet to handle
+ * @param[in] ctx       Context for the packet. May be NULL.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ */
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page);
+
+/**
+ * @brief   Forwards a recoverable fragment using a VRB entry
+ *
+ * @pre `rfrag != NULL`
+ * @pre `vrbe != NULL`
+ *
+ * @param[in] pkt       The payload of the fragment without the link-layer
+ *                      header and the RFRAG header. Will be released by this
+ *                      function.
+ * @param[in] rfrag     The RFRAG header of the received fragment.
+ * @param[in] vrbe      VRB entry to forward the fragment along.
+ * @param[in] page      Current 6Lo dispatch parsing page.
+ *
+ * @return  0 on success.
+ * @return  -ENOMEM, when the packet buffer is full.
+ */
+int gnrc_sixlowpan_frag_sfr_forward(gnrc_pktsnip_t *pkt,
+                                    const sixlowpan_sfr_rfrag_t *rfrag,
+                                    gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    unsigned page);
+
+/**
+ * @brief   Handles an ARQ timeout of a fragmentation buffer entry
+ *
+ * @see GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG
+ *
+ * Timeouts for datagrams that are already completed or aborted are ignored.
+ *
+ * @param[in] tag   The datagram tag of the fragmentation buffer entry the
+ *                  timeout occurred for.
+ */
+void gnrc_sixlowpan_frag_sfr_arq_timeout(uint16_t tag);
+
+/**
+ * @brief   Sends the next queued fragment after the inter-frame gap passed
+ *
+ * @see GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_MSG
+ */
+void gnrc_sixlowpan_frag_sfr_inter_frame_gap(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_H */
+/** @} */
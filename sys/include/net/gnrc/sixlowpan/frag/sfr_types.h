@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_sixlowpan_frag_sfr
+ * @{
+ *
+ * @file
+ * @brief   6LoWPAN selective fragment recovery type definitions
+ *
+ * Separated from @ref net/gnrc/sixlowpan/frag/sfr.h, so they can be used in
+ * @ref net/gnrc/sixlowpan/frag/fb.h without a cyclical include.
+ *
+ * @author  agent <agent@local>
+ */
+#ifndef NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+#define NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H
+
+#include <stdint.h>
+
+#include "clist.h"
+#include "msg.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Extension for @ref net_gnrc_sixlowpan_frag_fb for selective
+ *          fragment recovery
+ */
+typedef struct {
+    /**
+     * @brief   Fragments sent but not acknowledged yet
+     *
+     * Sorted by sequence number. Empty when the fragmentation buffer entry is
+     * not used for selective fragment recovery.
+     */
+    clist_node_t window;
+    xtimer_t arq_timer;             /**< timer for the ARQ timeout */
+    msg_t arq_msg;                  /**< message for the ARQ timer */
+    uint8_t cur_seq;                /**< sequence number of the next new fragment */
+    uint8_t frags_sent;             /**< number of fragments in the window */
+    uint8_t window_size;            /**< current congestion window size */
+    uint8_t dg_retries;             /**< number of times the datagram was
+                                     *   resent from scratch */
+} gnrc_sixlowpan_frag_sfr_fb_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_SIXLOWPAN_FRAG_SFR_TYPES_H */
+/** @} */
@@ -33,6 +33,11 @@ extern "C" {
 typedef struct {
     unsigned rbuf_full;     /**< counts the number of events where the
                              *   reassembly buffer is full */
+    unsigned rbuf_ints_full;    /**< counts the number of datagrams dropped
+                                 *   because their reassembly buffer entry
+                                 *   ran out of byte intervals */
+    unsigned rbuf_max_used;     /**< maximum number of reassembly buffer
+                                 *   entries used at the same time */
     unsigned frag_full;     /**< counts the number of events that there where
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
@@ -41,6 +46,16 @@ typedef struct {
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
 #endif
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || DOXYGEN
+    unsigned sfr_resends_nack;      /**< fragments resent because they were
+                                     *   missing in an RFRAG acknowledgment */
+    unsigned sfr_resends_timeout;   /**< fragments resent because no RFRAG
+                                     *   acknowledgment arrived in time */
+    unsigned sfr_dg_resends;        /**< datagrams resent from scratch */
+    unsigned sfr_aborts;            /**< datagrams aborted by either end */
+    unsigned sfr_acks;              /**< RFRAG acknowledgments received as
+                                     *   fragment sender */
+#endif
 } gnrc_sixlowpan_frag_stats_t;
 
 /**
@@ -117,6 +117,31 @@ void gnrc_sixlowpan_frag_vrb_gc(void);
 gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
         const uint8_t *src, size_t src_len, unsigned src_tag);
 
+#if defined(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) || defined(DOXYGEN)
+/**
+ * @brief   Reverse VRB lookup
+ *
+ * Used to relay acknowledgments back to the original sender of a datagram.
+ *
+ * @param[in] netif     Network interface the reverse path starts on.
+ *                      May be NULL for any interface.
+ * @param[in] src       Link-layer source address of the reverse path, i.e.
+ *                      gnrc_sixlowpan_frag_rb_base_t::dst of the VRB entry.
+ * @param[in] src_len   Length of @p src.
+ * @param[in] tag       Tag of the reverse path, i.e.
+ *                      gnrc_sixlowpan_frag_vrb_t::out_tag of the VRB entry.
+ *
+ * @note    Only available with module `gnrc_sixlowpan_frag_sfr`
+ *
+ * @return  The VRB entry identified by the given parameters.
+ * @return  NULL, if there is no entry in the VRB that could be identified
+ *          by the given parameters.
+ */
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
+        const gnrc_netif_t *netif, const uint8_t *src, size_t src_len,
+        unsigned tag);
+#endif /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
+
 /**
  * @brief   Removes an entry from the VRB
  *
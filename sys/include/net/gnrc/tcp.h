@@ -154,6 +154,92 @@ int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
  */
 int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
 
+/**
+ * @brief Initialize a TCB queue.
+ *
+ * @pre @p queue must not be NULL.
+ *
+ * @param[out] queue   TCB queue to initialize.
+ */
+void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue);
+
+/**
+ * @brief Listen for incoming connections on a local endpoint.
+ *
+ * Every TCB in @p tcbs is initialized and waits passively for a connection
+ * request to @p local. The TCBs complete their handshakes independently of
+ * each other and of the caller. Established connections are handed out with
+ * gnrc_tcp_accept(). If all TCBs are in use, further connection requests are
+ * dropped silently, so that the peer retries later.
+ *
+ * After an accepted connection was closed with gnrc_tcp_close() or
+ * gnrc_tcp_abort(), its TCB waits for the next connection request.
+ *
+ * @pre @p queue must have been initialized with gnrc_tcp_tcb_queue_init().
+ * @pre @p tcbs must not be NULL.
+ * @pre @p tcbs_len must not be zero.
+ * @pre @p local must not be NULL.
+ * @pre port in @p local must not be zero.
+ *
+ * @note Each TCB holds a receive buffer while listening, so
+ *       @ref CONFIG_GNRC_TCP_RCV_BUFFERS must be at least @p tcbs_len.
+ *
+ * @param[in,out] queue      TCB queue to listen with.
+ * @param[in]     tcbs       TCBs handling the connections of @p queue.
+ * @param[in]     tcbs_len   Number of TCBs in @p tcbs.
+ * @param[in]     local      Endpoint specifying the port and address used to wait
+ *                           for incoming connections.
+ *
+ * @return   0 on success.
+ * @return   -EAFNOSUPPORT if the address family of @p local is not supported.
+ * @return   -EINVAL if the address in @p local is invalid.
+ * @return   -EISCONN if @p queue is already listening.
+ * @return   -ENOMEM if the receive buffers for @p tcbs could not be allocated.
+ *            Hint: Increase "CONFIG_GNRC_TCP_RCV_BUFFERS".
+ */
+int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                    const gnrc_tcp_ep_t *local);
+
+/**
+ * @brief Accept an established connection from a listening TCB queue.
+ *
+ * @pre gnrc_tcp_listen() must have been successfully called on @p queue.
+ * @pre @p tcb must not be NULL.
+ *
+ * @note Function blocks if user_timeout_duration_ms is not zero. Only one
+ *       thread may wait for connections of @p queue at a time.
+ *
+ * @param[in,out] queue                      TCB queue to accept a connection from.
+ * @param[out]    tcb                        TCB of the accepted connection.
+ * @param[in]     user_timeout_duration_ms   Timeout for accept in milliseconds.
+ *                                           If zero and no connection is established,
+ *                                           the function returns immediately. If not
+ *                                           zero the function blocks until a connection
+ *                                           is established or @p user_timeout_duration_ms
+ *                                           milliseconds passed.
+ *
+ * @return   0 on success.
+ * @return   -EINVAL if @p queue is not listening.
+ * @return   -EALREADY if another thread waits for connections of @p queue.
+ * @return   -EAGAIN if user_timeout_duration_ms is zero and no connection is established.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ */
+int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
+                    const uint32_t user_timeout_duration_ms);
+
+/**
+ * @brief Stop listening for incoming connections.
+ *
+ * Connections that were not accepted yet are aborted. Accepted connections
+ * remain open and must be closed by the user as usual.
+ *
+ * @pre @p queue must not be NULL.
+ * @pre No thread may wait in gnrc_tcp_accept() on @p queue.
+ *
+ * @param[in,out] queue   TCB queue to stop listening with.
+ */
+void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue);
+
 /**
  * @brief Transmit data to connected peer.
  *
@@ -162,6 +248,9 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local);
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       Up to @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE segments are in flight
+ *       at a time, as far as the peers receive window and the congestion
+ *       window (see [RFC 5681](https://tools.ietf.org/html/rfc5681)) allow.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -103,11 +103,48 @@ extern "C" {
 
 /**
  * @brief Default receive buffer size
+ *
+ * Receive buffers larger than 65535 bytes are announced to the peer with the
+ * window scale option (see RFC 7323).
  */
 #ifndef GNRC_TCP_RCV_BUF_SIZE
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Maximum number of unacknowledged segments per connection
+ *
+ * Segments stay in the packet buffer until they are acknowledged, so this
+ * value limits how much of the packet buffer a single connection can occupy.
+ * A value of 1 results in stop-and-wait behavior.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Maximum number of out of order data blocks tracked per connection
+ *
+ * Out of order data is kept in the receive buffer and reported to the peer
+ * with the SACK option (see RFC 2018), if the peer supports it. If more
+ * blocks are received, the data of the oldest block is discarded.
+ * At most 4 blocks fit into a TCP header.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_BLOCKS
+#define CONFIG_GNRC_TCP_SACK_BLOCKS (3U)
+#endif
+
+/**
+ * @brief Number of SYN+ACK retransmissions of a listen queue TCB
+ *
+ * If the handshake of a connection in a listen queue isn't completed after
+ * this number of retransmissions, the TCB returns to listening for the next
+ * connection attempt. See gnrc_tcp_listen().
+ */
+#ifndef CONFIG_GNRC_TCP_SYNACK_RETRIES
+#define CONFIG_GNRC_TCP_SYNACK_RETRIES (5U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
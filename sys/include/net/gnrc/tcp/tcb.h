@@ -20,6 +20,7 @@
 #ifndef NET_GNRC_TCP_TCB_H
 #define NET_GNRC_TCP_TCB_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "kernel_types.h"
 #include "ringbuffer.h"
@@ -39,6 +40,19 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Block of received out of order data (see RFC 2018).
+ */
+typedef struct {
+    uint32_t left;   /**< First sequence number of the block */
+    uint32_t right;  /**< Sequence number following the last byte of the block */
+} gnrc_tcp_sack_block_t;
+
+/**
+ * @brief Forward declaration of the listen queue.
+ */
+struct _gnrc_tcp_tcb_queue;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -52,33 +66,69 @@ typedef struct _transmission_control_block {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wscale;    /**< Window scale shift count of the peer */
+    uint8_t rcv_wscale;    /**< Window scale shift count announced to the peer */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
-    uint8_t retries;       /**< Number of retransmissions */
+    uint32_t rtt_seq;      /**< Sequence number that acknowledges the timed segment */
+    uint8_t retries;       /**< Number of retransmissions on timeout */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< snd_nxt when loss recovery was entered last */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged segments, oldest first. Empty if the first
+     *        element is NULL.
+     */
+    gnrc_pktsnip_t *pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    /**
+     * @brief Flags of the segments in pkt_retransmit.
+     */
+    uint8_t pkt_retransmit_flags[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    /**
+     * @brief Received out of order data, most recently changed block first.
+     */
+    gnrc_tcp_sack_block_t rcv_sack[CONFIG_GNRC_TCP_SACK_BLOCKS];
+    uint8_t rcv_sack_num;    /**< Number of valid blocks in rcv_sack */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
+    struct _gnrc_tcp_tcb_queue *queue;          /**< Listen queue the TCB belongs to */
     struct _transmission_control_block *next;   /**< Pointer next TCB */
 } gnrc_tcp_tcb_t;
 
+/**
+ * @brief Queue of TCBs listening for connections on the same local endpoint.
+ */
+typedef struct _gnrc_tcp_tcb_queue {
+    mutex_t lock;           /**< Mutex for queue access synchronization */
+    gnrc_tcp_tcb_t *tcbs;   /**< TCBs handling the connections, NULL if not listening */
+    size_t tcbs_len;        /**< Number of TCBs in tcbs */
+    mbox_t *mbox;           /**< mbox of the thread waiting in gnrc_tcp_accept() */
+} gnrc_tcp_tcb_queue_t;
+
+/**
+ * @brief Static initializer for a @ref gnrc_tcp_tcb_queue_t.
+ */
+#define GNRC_TCP_TCB_QUEUE_INIT { MUTEX_INIT, NULL, 0, NULL }
+
 #ifdef __cplusplus
 }
 #endif
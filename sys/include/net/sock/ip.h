@@ -272,6 +272,8 @@
 #include <stdlib.h>
 #include <sys/types.h>
 
+#include "iolist.h"
+
 /* net/sock/async/types.h included by net/sock.h needs to re-typedef the
  * `sock_ip_t` to prevent cyclic includes */
 #if defined (__clang__)
@@ -505,6 +507,35 @@ ssize_t sock_ip_recv_buf(sock_ip_t *sock, void **data, void **buf_ctx,
 ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
                      uint8_t proto, const sock_ip_ep_t *remote);
 
+/**
+ * @brief   Sends a message made up of several chunks over IPv4/IPv6 to
+ *          remote end point
+ *
+ * @pre `((sock != NULL || remote != NULL))`
+ *
+ * Behaves like @ref sock_ip_send(), but the payload is gathered from
+ * @p snips, so e.g. a header and payload in separate buffers don't need to
+ * be concatenated before sending.
+ *
+ * @param[in] sock      A raw IPv4/IPv6 sock object. May be NULL.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] snips     List of payload chunks, sent in order. May be `NULL`
+ *                      for an empty payload.
+ * @param[in] proto     Protocol to use in the packet sent, in case
+ *                      `sock == NULL`. If `sock != NULL` this parameter will be
+ *                      ignored.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_ip_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  The errors of @ref sock_ip_send() on error.
+ */
+ssize_t sock_ip_sendv(sock_ip_t *sock, const iolist_t *snips, uint8_t proto,
+                      const sock_ip_ep_t *remote);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
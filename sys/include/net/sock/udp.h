@@ -272,6 +272,8 @@
 #include <stdlib.h>
 #include <sys/types.h>
 
+#include "iolist.h"
+
 /* net/sock/async/types.h included by net/sock.h needs to re-typedef the
  * `sock_ip_t` to prevent cyclic includes */
 #if defined (__clang__)
@@ -299,6 +301,28 @@ typedef struct sock_udp sock_udp_t;
 # pragma clang diagnostic pop
 #endif
 
+/**
+ * @brief   A datagram for @ref sock_udp_recv_batch() and
+ *          @ref sock_udp_send_batch()
+ */
+typedef struct {
+    void *data;             /**< Payload of the datagram */
+    /**
+     * @brief   Length of sock_udp_dgram_t::data
+     *
+     * When receiving, this is the space available at sock_udp_dgram_t::data
+     * and is set to the length of the received payload.
+     */
+    size_t len;
+    /**
+     * @brief   Remote end point of the datagram
+     *
+     * Same semantics as the `remote` parameter of @ref sock_udp_recv() or
+     * @ref sock_udp_send() respectively.
+     */
+    sock_udp_ep_t *remote;
+} sock_udp_dgram_t;
+
 /**
  * @brief   Creates a new UDP sock object
  *
@@ -457,6 +481,36 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
 ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
                           uint32_t timeout, sock_udp_ep_t *remote);
 
+/**
+ * @brief   Receives multiple UDP messages from remote end points
+ *
+ * @pre `(sock != NULL) && (dgrams != NULL) && (dgrams_numof > 0)`
+ *
+ * Waits like @ref sock_udp_recv() for the first datagram. Further datagrams
+ * are only received if they are already waiting, so a single call drains
+ * a burst of datagrams without blocking again.
+ *
+ * @note    Only available with module `sock_udp_batch`.
+ *
+ * @param[in] sock          A UDP sock object.
+ * @param[in,out] dgrams    Datagrams to receive into. sock_udp_dgram_t::len
+ *                          is set to the length of each received datagram.
+ * @param[in] dgrams_numof  Number of datagrams in @p dgrams.
+ * @param[in] timeout       Timeout for the first datagram in microseconds.
+ *                          If 0 and no data is available, the function
+ *                          returns immediately.
+ *                          May be @ref SOCK_NO_TIMEOUT for no timeout (wait
+ *                          until data is available).
+ *
+ * @note    Waiting datagrams that would cause an -ENOBUFS or -EPROTO error
+ *          after the first datagram are dropped silently.
+ *
+ * @return  The number of datagrams received on success.
+ * @return  The errors of @ref sock_udp_recv() for the first datagram.
+ */
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_dgram_t *dgrams,
+                        unsigned dgrams_numof, uint32_t timeout);
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
@@ -493,6 +547,54 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote);
 
+/**
+ * @brief   Sends a UDP message made up of several chunks to remote end point
+ *
+ * @pre `((sock != NULL || remote != NULL))`
+ *
+ * Behaves like @ref sock_udp_send(), but the payload is gathered from
+ * @p snips, so e.g. a header, payload and trailer in separate buffers don't
+ * need to be concatenated before sending.
+ *
+ * @param[in] sock      A UDP sock object. May be `NULL`.
+ *                      A sensible local end point should be selected by the
+ *                      implementation in that case.
+ * @param[in] snips     List of payload chunks, sent in order. May be `NULL`
+ *                      for an empty payload.
+ * @param[in] remote    Remote end point for the sent data.
+ *                      May be `NULL`, if @p sock has a remote end point.
+ *                      sock_udp_ep_t::family may be AF_UNSPEC, if local
+ *                      end point of @p sock provides this information.
+ *                      sock_udp_ep_t::port may not be 0.
+ *
+ * @return  The number of bytes sent on success.
+ * @return  The errors of @ref sock_udp_send() on error.
+ */
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote);
+
+/**
+ * @brief   Sends multiple UDP messages to remote end points
+ *
+ * @pre `(dgrams != NULL) && (dgrams_numof > 0)`
+ * @pre The preconditions of @ref sock_udp_send() for each datagram
+ *
+ * Sends the datagrams in order and stops at the first error.
+ *
+ * @note    Only available with module `sock_udp_batch`.
+ *
+ * @param[in] sock          A UDP sock object. May be `NULL`.
+ *                          A sensible local end point should be selected by
+ *                          the implementation in that case.
+ * @param[in] dgrams        Datagrams to send.
+ * @param[in] dgrams_numof  Number of datagrams in @p dgrams.
+ *
+ * @return  The number of datagrams sent on success.
+ * @return  The errors of @ref sock_udp_send() for the first datagram.
+ */
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                        unsigned dgrams_numof);
+
 #include "sock_types.h"
 
 #ifdef __cplusplus
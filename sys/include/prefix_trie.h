@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_prefix_trie Prefix trie
+ * @ingroup     sys
+ * @brief       Index for longest-prefix matching over a static array of
+ *              entries
+ *
+ * A path-compressed binary trie over the keys of the entries of an array
+ * owned by the user, e.g. a routing table. Each entry has a key (e.g. an
+ * address) and a prefix length, the trie itself stores neither but gets the
+ * key of an entry from the user by its index in the array.
+ *
+ * The trie needs @ref PREFIX_TRIE_NODES_NUMOF nodes for an array with
+ * `numof` entries: the first `numof` nodes stand for the entries with the
+ * same index, the others are branching nodes that join two sub-tries that
+ * differ in the bit after their common prefix. So no dynamic allocation is
+ * needed.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Prefix trie definitions
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef PREFIX_TRIE_H
+#define PREFIX_TRIE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum size of a key in bytes
+ *
+ * Sets the size of the stack used by prefix_trie_foreach().
+ */
+#ifndef CONFIG_PREFIX_TRIE_KEY_SIZE_MAX
+#define CONFIG_PREFIX_TRIE_KEY_SIZE_MAX     (16U)
+#endif
+
+/**
+ * @brief   Number of nodes required for a trie over @p numof entries
+ */
+#define PREFIX_TRIE_NODES_NUMOF(numof)      (2 * (numof))
+
+/**
+ * @brief   Node of a prefix trie
+ *
+ * Nodes are referenced by their index + 1, so 0 means "no node" and a
+ * zero-initialized node is unused.
+ */
+typedef struct {
+    uint16_t child[2];  /**< sub-tries by the bit following the prefix */
+    uint16_t dup;       /**< next entry with the same prefix (by index) */
+    uint8_t len;        /**< prefix length in bits */
+} prefix_trie_node_t;
+
+/**
+ * @brief   Forward declaration of the trie type
+ */
+typedef struct prefix_trie prefix_trie_t;
+
+/**
+ * @brief   Gets the key of an entry
+ *
+ * Bits beyond @p size are treated as 0.
+ *
+ * @param[in] trie  the trie
+ * @param[in] idx   index of the entry
+ * @param[out] size size of the key in bytes
+ *
+ * @return  the key of the entry at @p idx
+ */
+typedef const uint8_t *(*prefix_trie_key_t)(const prefix_trie_t *trie,
+                                            unsigned idx, size_t *size);
+
+/**
+ * @brief   Callback for prefix_trie_foreach()
+ *
+ * @param[in] idx   index of the entry
+ * @param[in] arg   user argument
+ */
+typedef void (*prefix_trie_cb_t)(unsigned idx, void *arg);
+
+/**
+ * @brief   Prefix trie
+ */
+struct prefix_trie {
+    prefix_trie_node_t *nodes;  /**< @ref PREFIX_TRIE_NODES_NUMOF(numof) nodes */
+    prefix_trie_key_t key;      /**< gets the key of an entry */
+    uint16_t numof;             /**< number of entries */
+    uint16_t root;              /**< root node */
+};
+
+/**
+ * @brief   Iterator for prefix_trie_match()
+ */
+typedef struct {
+    uint16_t next;              /**< next node on the path */
+    uint16_t dup;               /**< next entry with the same prefix */
+} prefix_trie_iter_t;
+
+/**
+ * @brief   Initializes an empty trie
+ *
+ * @param[out] trie     the trie
+ * @param[in] nodes     @ref PREFIX_TRIE_NODES_NUMOF(@p numof) nodes
+ * @param[in] numof     number of entries, must be less than
+ *                      `UINT16_MAX / 2`
+ * @param[in] key       gets the key of an entry
+ */
+void prefix_trie_init(prefix_trie_t *trie, prefix_trie_node_t *nodes,
+                      unsigned numof, prefix_trie_key_t key);
+
+/**
+ * @brief   Adds an entry to the trie
+ *
+ * @pre The entry is not in the trie and its key is set
+ *
+ * @param[in,out] trie  the trie
+ * @param[in] idx       index of the entry
+ * @param[in] len       prefix length of the entry in bits
+ */
+void prefix_trie_add(prefix_trie_t *trie, unsigned idx, unsigned len);
+
+/**
+ * @brief   Removes an entry from the trie
+ *
+ * Does nothing if the entry is not in the trie.
+ *
+ * @pre The key of the entry did not change since it was added
+ *
+ * @param[in,out] trie  the trie
+ * @param[in] idx       index of the entry
+ */
+void prefix_trie_remove(prefix_trie_t *trie, unsigned idx);
+
+/**
+ * @brief   Gets the prefix length of an entry
+ *
+ * @param[in] trie  the trie
+ * @param[in] idx   index of an entry in the trie
+ *
+ * @return  the prefix length of the entry at @p idx in bits
+ */
+static inline unsigned prefix_trie_len(const prefix_trie_t *trie, unsigned idx)
+{
+    return trie->nodes[idx].len;
+}
+
+/**
+ * @brief   Starts a longest-prefix match
+ *
+ * @param[in] trie  the trie
+ * @param[out] iter iterator for prefix_trie_match()
+ */
+static inline void prefix_trie_match_init(const prefix_trie_t *trie,
+                                          prefix_trie_iter_t *iter)
+{
+    iter->next = trie->root;
+    iter->dup = 0;
+}
+
+/**
+ * @brief   Gets the next entry whose prefix matches @p key
+ *
+ * The entries are returned with ascending prefix length, entries with the
+ * same prefix by ascending index. So the longest match is the last one
+ * returned.
+ *
+ * @param[in] trie      the trie
+ * @param[in] key       the key to match
+ * @param[in] size      size of @p key in bytes
+ * @param[in,out] iter  iterator initialized with prefix_trie_match_init()
+ *
+ * @return  index of the next matching entry
+ * @return  -1 if there are no more matching entries
+ */
+int prefix_trie_match(const prefix_trie_t *trie, const uint8_t *key,
+                      size_t size, prefix_trie_iter_t *iter);
+
+/**
+ * @brief   Calls @p cb for all entries whose key starts with the first
+ *          @p len bits of @p key
+ *
+ * @pre `size <= CONFIG_PREFIX_TRIE_KEY_SIZE_MAX`
+ *
+ * @param[in] trie  the trie
+ * @param[in] key   the prefix
+ * @param[in] size  size of @p key in bytes
+ * @param[in] len   length of the prefix in bits
+ * @param[in] cb    called with the index of every entry
+ * @param[in] arg   passed to @p cb
+ */
+void prefix_trie_foreach(const prefix_trie_t *trie, const uint8_t *key,
+                         size_t size, unsigned len, prefix_trie_cb_t cb,
+                         void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PREFIX_TRIE_H */
+/** @} */
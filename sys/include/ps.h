@@ -32,6 +32,13 @@ extern "C" {
  */
 void ps(void);
 
+/**
+ * @brief Print the wakeup latency histogram of all active threads to stdout.
+ *
+ * @note  Only available with module `schedstatistics`
+ */
+void ps_latency(void);
+
 #ifdef __cplusplus
 }
 #endif
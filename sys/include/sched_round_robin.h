@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round robin scheduling
+ * @ingroup     sys
+ * @brief       Time sliced round robin scheduling of equal priority threads
+ *
+ * The RIOT scheduler is strictly priority driven: threads of the same
+ * priority only take turns when the running one blocks or calls
+ * @ref thread_yield(). A compute bound thread can thus starve all other
+ * threads of its priority.
+ *
+ * With this module, the runqueue of the highest runnable priority is rotated
+ * every @ref SCHED_RR_TIMEOUT, so that all runnable threads of that priority
+ * get the CPU in turn. The timer is only armed while more than one thread is
+ * runnable at that priority, so this module costs nothing while the system
+ * is idle or while only one thread per priority is busy.
+ *
+ * Priorities can be excluded from time slicing using @ref SCHED_RR_MASK.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   ztimer clock used for the time slices
+ */
+#ifndef SCHED_RR_TIMERBASE
+#define SCHED_RR_TIMERBASE  ZTIMER_USEC
+#endif
+
+/**
+ * @brief   Length of a time slice in ticks of @ref SCHED_RR_TIMERBASE
+ */
+#ifndef SCHED_RR_TIMEOUT
+#define SCHED_RR_TIMEOUT    (10000U)
+#endif
+
+/**
+ * @brief   Bitmask of the priorities to apply time slicing to
+ *
+ * Bit `n` enables time slicing for priority `n`. Defaults to all priorities.
+ */
+#ifndef SCHED_RR_MASK
+#define SCHED_RR_MASK       (0xffffffffUL)
+#endif
+
+/**
+ * @brief   Initialize round robin scheduling
+ *
+ * Called by auto_init, after ztimer has been initialized.
+ */
+void sched_round_robin_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
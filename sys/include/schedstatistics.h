@@ -14,6 +14,24 @@
  *              (@ref schedstat_t) for a thread will be updated on every
  *              @ref sched_run().
  *
+ * In addition to the total runtime and the number of times a thread was
+ * scheduled, the following is recorded for every thread:
+ *
+ * - the number of voluntary (the thread blocked) and involuntary (the thread
+ *   was preempted or yielded while still runnable) context switches
+ * - the longest time the thread ran without being switched out
+ * - a histogram and the maximum of the wakeup latency, i.e., the time between
+ *   a thread becoming runnable and it actually being scheduled
+ *
+ * With module `schedstatistics_irq` the time a thread spent with interrupts
+ * disabled (from the outermost irq_disable() to the irq_restore() or
+ * irq_enable() that enables them again) is recorded as well. This adds a
+ * timer read to every such pair, so it is not enabled by default. Interrupts
+ * disabled within ISRs are not accounted.
+ *
+ * The statistics are shown by @ref ps (histograms with `ps -l`) and can be
+ * read using @ref schedstatistics_get().
+ *
  * @note        If auto_init is disabled `init_schedstatistics()` needs to be
  *              called as well as xtimer_init().
  * @{
@@ -36,6 +54,16 @@
  extern "C" {
 #endif
 
+/**
+ * @brief   Number of buckets of the wakeup latency histogram
+ *
+ * Bucket `i` counts latencies smaller than `4^(i + 1)` ticks (and not counted
+ * by a lower bucket), the last bucket counts all larger latencies.
+ */
+#ifndef CONFIG_SCHEDSTATISTICS_HIST_NUMOF
+#define CONFIG_SCHEDSTATISTICS_HIST_NUMOF   (8U)
+#endif
+
 /**
  *  Scheduler statistics
  */
@@ -44,6 +72,23 @@ typedef struct {
                                   scheduled to run */
     unsigned int schedules;  /**< How often the thread was scheduled to run */
     uint64_t runtime_ticks;  /**< The total runtime of this thread in ticks */
+    unsigned int voluntary;  /**< Context switches due to the thread blocking */
+    unsigned int involuntary;/**< Context switches while the thread was still
+                                  runnable */
+    uint32_t max_slice;      /**< Longest time the thread ran without being
+                                  switched out, in ticks */
+    uint32_t lastwakeup;     /**< Time stamp of the last time this thread was
+                                  put on the runqueue */
+    uint32_t max_latency;    /**< Maximum wakeup latency in ticks */
+    uint32_t latency_hist[CONFIG_SCHEDSTATISTICS_HIST_NUMOF]; /**< Wakeup
+                                  latency histogram */
+#if defined(MODULE_SCHEDSTATISTICS_IRQ) || defined(DOXYGEN)
+    uint64_t irq_off_ticks;  /**< Total time with interrupts disabled in
+                                  ticks */
+    uint32_t max_irq_off;    /**< Longest time with interrupts disabled in
+                                  ticks */
+#endif
+    uint8_t woken;           /**< Thread was woken up, but not yet scheduled */
 } schedstat_t;
 
 /**
@@ -57,6 +102,37 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ * @brief   Get a consistent copy of the scheduler statistics of a thread
+ *
+ * @param[in]   pid     Pid of the thread
+ * @param[out]  stat    Statistics of the thread
+ */
+void schedstatistics_get(kernel_pid_t pid, schedstat_t *stat);
+
+/**
+ * @brief   Reset the latency histogram and the maxima of a thread
+ *
+ * Runtime and switch counters are not affected.
+ *
+ * @param[in]   pid     Pid of the thread
+ */
+void schedstatistics_reset_max(kernel_pid_t pid);
+
+/**
+ * @brief   Get the upper limit of a wakeup latency histogram bucket
+ *
+ * @param[in]   bucket  Index of the bucket
+ *
+ * @return  First latency (in ticks) not counted by @p bucket anymore,
+ *          UINT32_MAX for the last bucket
+ */
+static inline uint32_t schedstatistics_hist_limit(unsigned bucket)
+{
+    return (bucket < (CONFIG_SCHEDSTATISTICS_HIST_NUMOF - 1))
+           ? (UINT32_C(4) << (2 * bucket)) : UINT32_MAX;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,6 +41,42 @@
  * trace_dump();
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * ## Kernel tracepoints
+ *
+ * With the pseudomodule `trace_kernel`, the kernel additionally records the
+ * following events into the same trace buffer:
+ *
+ * | event                          | arg          | val           |
+ * |:------------------------------ |:------------ |:------------- |
+ * | @ref TRACE_EVENT_SWITCH        | next pid     | previous pid  |
+ * | @ref TRACE_EVENT_ISR_ENTER     | interrupt    | -             |
+ * | @ref TRACE_EVENT_ISR_EXIT      | interrupt    | -             |
+ * | @ref TRACE_EVENT_MSG_SEND      | target pid   | message type  |
+ * | @ref TRACE_EVENT_MSG_RECV      | sender pid   | message type  |
+ * | @ref TRACE_EVENT_MUTEX_BLOCK   | -            | mutex address |
+ * | @ref TRACE_EVENT_MUTEX_UNBLOCK | woken pid    | mutex address |
+ * | @ref TRACE_EVENT_FLAGS_WAKE    | woken pid    | thread flags  |
+ *
+ * Every entry also records the pid of the thread that was active when the
+ * entry was added. ISR entry and exit are only recorded on architectures
+ * having a common interrupt entry point (currently `native`), other
+ * architectures or drivers can call trace_kernel() themselves.
+ *
+ * Entries are reserved in the ring buffer using an atomic increment, so
+ * recording does not disable interrupts. An entry only becomes visible to
+ * trace_dump() and trace_get() once it is completely written. Events recorded
+ * before trace_init() was called (e.g. the first context switches during
+ * boot) have a time stamp of 0, as the timers are not initialized yet.
+ *
+ * ## Offline analysis
+ *
+ * trace_dump_binary() prints the buffer in a compact format (one line of hex
+ * per entry) that can be converted to the Chrome trace event format
+ * (chrome://tracing, Perfetto) using `dist/tools/trace/trace2json.py`:
+ *
+ *     make term | tee trace.log
+ *     dist/tools/trace/trace2json.py trace.log > trace.json
+ *
  * @{
  *
  * @brief       Execution tracing module API
@@ -54,11 +90,78 @@
 #define TRACE_H
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief   Trace event types
+ */
+typedef enum {
+    TRACE_EVENT_USER,           /**< user defined event, see trace() */
+    TRACE_EVENT_SWITCH,         /**< context switch */
+    TRACE_EVENT_ISR_ENTER,      /**< interrupt service routine entered */
+    TRACE_EVENT_ISR_EXIT,       /**< interrupt service routine left */
+    TRACE_EVENT_MSG_SEND,       /**< message sent */
+    TRACE_EVENT_MSG_RECV,       /**< message received */
+    TRACE_EVENT_MUTEX_BLOCK,    /**< thread blocked on a mutex */
+    TRACE_EVENT_MUTEX_UNBLOCK,  /**< thread got a mutex on unlock */
+    TRACE_EVENT_FLAGS_WAKE,     /**< thread woken up by thread flags */
+    TRACE_EVENT_NUMOF           /**< number of event types */
+} trace_event_type_t;
+
+/**
+ * @brief   Trace buffer entry
+ */
+typedef struct {
+    uint32_t time;              /**< time stamp in microseconds */
+    uint32_t val;               /**< event specific value */
+    uint16_t arg;               /**< event specific argument */
+    uint8_t type;               /**< event type, see @ref trace_event_type_t */
+    uint8_t pid;                /**< pid of the active thread */
+} trace_entry_t;
+
+/**
+ * @brief   Start time stamping trace entries
+ *
+ * Called by auto_init after the timers are initialized. Applications not
+ * using `auto_init` need to call it once xtimer is usable.
+ */
+void trace_init(void);
+
+/**
+ * @brief   Add an event to the trace buffer
+ *
+ * @param[in]   type    type of the event
+ * @param[in]   arg     event specific argument
+ * @param[in]   val     event specific value
+ */
+void trace_event(trace_event_type_t type, uint16_t arg, uint32_t val);
+
+/**
+ * @brief   Kernel tracepoint
+ *
+ * Records an event if the module `trace_kernel` is used, compiles to nothing
+ * otherwise.
+ *
+ * @param[in]   type    type of the event
+ * @param[in]   arg     event specific argument
+ * @param[in]   val     event specific value
+ */
+static inline void trace_kernel(trace_event_type_t type, uint16_t arg,
+                                uint32_t val)
+{
+#ifdef MODULE_TRACE_KERNEL
+    trace_event(type, arg, val);
+#else
+    (void)type;
+    (void)arg;
+    (void)val;
+#endif
+}
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -80,6 +183,8 @@ void trace(uint32_t val);
  * relative time since last entry, and the value supplied to the `trace()` call
  * of each entry.
  *
+ * Kernel events are printed with their type, argument and pid appended.
+ *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
  *     n=   0 t=  1815312 v=0x00000000
@@ -92,6 +197,29 @@ void trace_dump(void);
  */
 void trace_reset(void);
 
+/**
+ * @brief   Print the current trace buffer in a compact machine readable format
+ *
+ * The output starts with a line `trace: begin <entries>` and ends with a line
+ * `trace: end`. In between, there is one line per entry (oldest first),
+ * consisting of the hex encoded fields of @ref trace_entry_t:
+ *
+ *     <time:8><val:8><arg:4><type:2><pid:2>
+ *
+ * Use `dist/tools/trace/trace2json.py` to convert it.
+ */
+void trace_dump_binary(void);
+
+/**
+ * @brief   Copy the trace buffer
+ *
+ * @param[out]  buf     buffer to copy the entries to, oldest first
+ * @param[in]   numof   number of entries fitting into @p buf
+ *
+ * @return  number of entries copied
+ */
+size_t trace_get(trace_entry_t *buf, size_t numof);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,6 +14,23 @@
  *
  * @attention   Buffer size must be a power of two!
  *
+ * All functions disabling interrupts are safe to be used with any number of
+ * readers and writers. Bulk reads and writes copy the data using at most two
+ * `memcpy()` calls.
+ *
+ * In addition, a zero-copy interface is provided for the common case of a
+ * single producer (e.g., an ISR) and a single consumer (e.g., a thread). It
+ * does not disable interrupts, but relies on acquire / release ordering of
+ * the read and write counters:
+ *
+ * - The consumer calls @ref tsrb_peek_contiguous to access the readable data
+ *   in place and @ref tsrb_commit to release it.
+ * - The producer calls @ref tsrb_reserve_contiguous to get free space to
+ *   write to in place and @ref tsrb_publish to make it readable.
+ *
+ * As the data may wrap around the end of the buffer, two iterations of peek /
+ * commit (or reserve / publish) may be needed to process all of it.
+ *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
  *
@@ -165,6 +182,61 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the contiguous readable data at the head of the ringbuffer
+ *
+ * The data is not removed from the ringbuffer. Call @ref tsrb_commit once it
+ * has been processed.
+ *
+ * @note        Only safe to be used by a single consumer
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Pointer to the first readable byte
+ *
+ * @return      nr of bytes readable at @p data, 0 if the ringbuffer is empty
+ */
+size_t tsrb_peek_contiguous(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Remove data obtained via @ref tsrb_peek_contiguous
+ *
+ * @note        Only safe to be used by a single consumer
+ *
+ * @pre         @p n is not larger than the number of bytes in the ringbuffer
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to remove
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the contiguous free space at the tail of the ringbuffer
+ *
+ * Data written to the returned space becomes readable once
+ * @ref tsrb_publish is called.
+ *
+ * @note        Only safe to be used by a single producer
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Pointer to the first free byte
+ *
+ * @return      nr of bytes writable at @p data, 0 if the ringbuffer is full
+ */
+size_t tsrb_reserve_contiguous(tsrb_t *rb, uint8_t **data);
+
+/**
+ * @brief       Make data written to space obtained via
+ *              @ref tsrb_reserve_contiguous readable
+ *
+ * @note        Only safe to be used by a single producer
+ *
+ * @pre         @p n is not larger than the free space in the ringbuffer
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes to add
+ */
+void tsrb_publish(tsrb_t *rb, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
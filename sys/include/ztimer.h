@@ -135,10 +135,18 @@
  * made a constant operation, at the price of another pointer per timer object
  * (for "previous" element).
  *
- * If deemed necessary, the linked list can be exchanged our augmented with
- * another data structure providing better algorithmic guarantees. It remains
- * to be shown whether the increased complexity would lead to better
- * performance for any reasonable amount of active timers.
+ * For clocks with many concurrently active timers, the pseudomodule
+ * `ztimer_heap` replaces the list by a pairing heap ordered by absolute
+ * (64bit) target time:
+ *
+ * - three pointers and a 64bit target per timer object
+ * - constant get_min() (the heap root is kept in the clock's list head)
+ * - O(1) insertion, O(log n) amortized removal of timer objects
+ * - timers with identical target time are not guaranteed to trigger in the
+ *   order they were set
+ *
+ * The root's offset is always kept relative to the clock's base time, so the
+ * remaining ztimer code is agnostic of the used data structure.
  *
  *
  * ## Clock extension
@@ -260,8 +268,13 @@ typedef struct ztimer_clock ztimer_clock_t;
  * @brief   Minimum information for each timer
  */
 struct ztimer_base {
-    ztimer_base_t *next;        /**< next timer in list */
+    ztimer_base_t *next;        /**< next timer in list (next sibling in heap) */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child in heap                      */
+    ztimer_base_t *prev;        /**< previous sibling, or parent if first child */
+    uint64_t target;            /**< absolute target time in heap             */
+#endif
 };
 
 #if MODULE_ZTIMER_NOW64
@@ -322,6 +335,10 @@ struct ztimer_clock {
     uint32_t lower_last;            /**< timer value at last now() call     */
     ztimer_now_t checkpoint;        /**< cumulated time at last now() call  */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    uint64_t heap_base;             /**< absolute time corresponding to the
+                                         base of the timer heap (list.offset) */
+#endif
 #if MODULE_PM_LAYERED || DOXYGEN
     uint8_t required_pm_mode;       /**< min. pm mode required for the clock to run */
 #endif
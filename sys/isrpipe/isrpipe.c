@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "isrpipe.h"
 
 void isrpipe_init(isrpipe_t *isrpipe, uint8_t *buf, size_t bufsize)
@@ -37,11 +39,43 @@ int isrpipe_write_one(isrpipe_t *isrpipe, uint8_t c)
     return res;
 }
 
+int isrpipe_write(isrpipe_t *isrpipe, const uint8_t *buf, size_t count)
+{
+    int res = tsrb_add(&isrpipe->tsrb, buf, count);
+
+    mutex_unlock(&isrpipe->mutex);
+
+    return res;
+}
+
+int isrpipe_try_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
+{
+    size_t res = 0;
+
+    /* the data may wrap around the end of the buffer, so it is read in at
+     * most two contiguous parts */
+    for (unsigned i = 0; (i < 2) && (res < count); i++) {
+        uint8_t *data;
+        size_t n = tsrb_peek_contiguous(&isrpipe->tsrb, &data);
+
+        if (n == 0) {
+            break;
+        }
+        if (n > count - res) {
+            n = count - res;
+        }
+        memcpy(&buffer[res], data, n);
+        tsrb_commit(&isrpipe->tsrb, n);
+        res += n;
+    }
+    return res;
+}
+
 int isrpipe_read(isrpipe_t *isrpipe, uint8_t *buffer, size_t count)
 {
     int res;
 
-    while (!(res = tsrb_get(&isrpipe->tsrb, buffer, count))) {
+    while (!(res = isrpipe_try_read(isrpipe, buffer, count))) {
         mutex_lock(&isrpipe->mutex);
     }
     return res;
@@ -21,6 +21,8 @@
 #include <assert.h>
 #include <errno.h>
 
+#include "irq.h"
+#include "kernel_defines.h"
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
@@ -82,6 +84,72 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static gnrc_netapi_train_stats_t _stats;
+
+static inline void _count(uint32_t msgs, uint32_t pkts)
+{
+    /* dispatch is called from multiple threads */
+    unsigned state = irq_disable();
+
+    _stats.msgs += msgs;
+    _stats.pkts += pkts;
+    irq_restore(state);
+}
+#else
+static inline void _count(uint32_t msgs, uint32_t pkts)
+{
+    (void)msgs;
+    (void)pkts;
+}
+#endif
+
+static void _deliver(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                     gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    uint32_t status = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+            _count(1, 1);
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
+                                       cmd) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            _count(1, 1);
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                status = EIO;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            _count(0, 1);
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            status = ECANCELED;
+            break;
+    }
+    if (status != 0) {
+        gnrc_pktbuf_release_error(pkt, status);
+    }
+#else
+    _count(1, 1);
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release_error(pkt, EIO);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -93,46 +161,138 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
-#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            uint32_t status = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        status = EIO;
-                    }
-                    break;
+            _deliver(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    return numof;
+}
+
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static inline bool _accepts_train(const gnrc_netreg_entry_t *entry)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX)
+    return ((entry->type == GNRC_NETREG_TYPE_DEFAULT) ||
+            (entry->type == GNRC_NETREG_TYPE_MBOX)) && entry->train;
+#elif defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    return (entry->type == GNRC_NETREG_TYPE_DEFAULT) && entry->train;
+#else
+    return entry->train;
 #endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
+}
+
+static int _deliver_train(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                          gnrc_pktsnip_t *train)
+{
+#ifdef MODULE_GNRC_NETAPI_MBOX
+    if (sendto->type == GNRC_NETREG_TYPE_MBOX) {
+        return _snd_rcv_mbox(sendto->target.mbox, cmd, train);
+    }
 #endif
-                default:
-                    /* unknown dispatch type */
-                    status = ECANCELED;
-                    break;
-            }
-            if (status != 0) {
-                gnrc_pktbuf_release_error(pkt, status);
+    return _gnrc_netapi_send_recv(sendto->target.pid, train, cmd);
+}
+
+int gnrc_netapi_dispatch_train(gnrc_nettype_t type, uint32_t demux_ctx,
+                               uint16_t cmd, gnrc_pktsnip_t *const *pkts,
+                               unsigned numof)
+{
+    int subs = gnrc_netreg_num(type, demux_ctx);
+    gnrc_pktsnip_t *train = NULL;
+    unsigned train_subs = 0;
+    gnrc_netreg_entry_t *sendto;
+
+    assert((cmd == GNRC_NETAPI_MSG_TYPE_RCV) || (cmd == GNRC_NETAPI_MSG_TYPE_SND));
+    if ((subs == 0) || (numof == 0)) {
+        return subs;
+    }
+
+    for (sendto = gnrc_netreg_lookup(type, demux_ctx); sendto != NULL;
+         sendto = gnrc_netreg_getnext(sendto)) {
+        if (_accepts_train(sendto)) {
+            train_subs++;
+        }
+    }
+    if (train_subs > 0) {
+        /* all train subscribers share the same train, so it is allocated
+         * only once */
+        train = gnrc_pktbuf_add(NULL, pkts, numof * sizeof(*pkts),
+                                GNRC_NETTYPE_UNDEF);
+        if (train == NULL) {
+            DEBUG("gnrc_netapi: unable to allocate train, falling back to "
+                  "single packets\n");
+        }
+        else {
+            gnrc_pktbuf_hold(train, train_subs - 1);
+        }
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        gnrc_pktbuf_hold(pkts[i], subs - 1);
+    }
+
+    for (sendto = gnrc_netreg_lookup(type, demux_ctx); sendto != NULL;
+         sendto = gnrc_netreg_getnext(sendto)) {
+        if ((train != NULL) && _accepts_train(sendto)) {
+            _count(1, numof);
+            if (_deliver_train(sendto, (cmd == GNRC_NETAPI_MSG_TYPE_SND)
+                                       ? GNRC_NETAPI_MSG_TYPE_SND_TRAIN
+                                       : GNRC_NETAPI_MSG_TYPE_RCV_TRAIN,
+                               train) < 1) {
+                /* unable to dispatch train */
+                for (unsigned i = 0; i < numof; i++) {
+                    gnrc_pktbuf_release_error(pkts[i], EIO);
+                }
+                gnrc_pktbuf_release(train);
             }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release_error(pkt, EIO);
+        }
+        else {
+            for (unsigned i = 0; i < numof; i++) {
+                _deliver(sendto, cmd, pkts[i]);
             }
-#endif
-            sendto = gnrc_netreg_getnext(sendto);
         }
     }
 
-    return numof;
+    return subs;
+}
+
+void gnrc_netapi_rx_train_add(gnrc_netapi_rx_train_t *train,
+                              gnrc_nettype_t type, uint32_t demux_ctx,
+                              gnrc_pktsnip_t *pkt)
+{
+    if ((train->numof > 0) &&
+        ((train->type != type) || (train->demux_ctx != demux_ctx))) {
+        gnrc_netapi_rx_train_flush(train);
+    }
+    train->type = type;
+    train->demux_ctx = demux_ctx;
+    train->pkts[train->numof++] = pkt;
+    if (train->numof == ARRAY_SIZE(train->pkts)) {
+        gnrc_netapi_rx_train_flush(train);
+    }
 }
+
+int gnrc_netapi_rx_train_flush(gnrc_netapi_rx_train_t *train)
+{
+    int subs = gnrc_netapi_dispatch_receive_train(train->type,
+                                                  train->demux_ctx,
+                                                  train->pkts, train->numof);
+
+    if (subs == 0) {
+        DEBUG("gnrc_netapi: no one interested in train of type %i\n",
+              train->type);
+        for (unsigned i = 0; i < train->numof; i++) {
+            gnrc_pktbuf_release(train->pkts[i]);
+        }
+    }
+    train->numof = 0;
+    return subs;
+}
+
+void gnrc_netapi_train_stats(gnrc_netapi_train_stats_t *stats)
+{
+    unsigned state = irq_disable();
+
+    *stats = _stats;
+    irq_restore(state);
+}
+#endif
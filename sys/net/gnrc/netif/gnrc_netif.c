@@ -69,6 +69,9 @@ int gnrc_netif_create(gnrc_netif_t *netif, char *stack, int stacksize,
     }
 #endif
     rmutex_init(&netif->mutex);
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+    netif->rx_train.numof = 0;
+#endif
     netif->ops = ops;
     netif_register((netif_t*) netif);
     assert(netif->dev == NULL);
@@ -1346,6 +1349,16 @@ static inline event_queue_t *_get_evq(gnrc_netif_t *netif)
  *
  * @return >0 if msg contains a new message
  */
+static void _pass_on_rx_train(gnrc_netif_t *netif)
+{
+    (void)netif;
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+    if (netif->rx_train.numof > 0) {
+        gnrc_netapi_rx_train_flush(&netif->rx_train);
+    }
+#endif
+}
+
 static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
 {
     if (IS_USED(MODULE_GNRC_NETIF_EVENTS)) {
@@ -1370,6 +1383,8 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
             if (msg_waiting > 0) {
                 return;
             }
+            /* the burst of received frames is over */
+            _pass_on_rx_train(netif);
             DEBUG("gnrc_netif: waiting for events\n");
             /* Block the thread until something interesting happens */
             thread_flags_wait_any(THREAD_FLAG_MSG_WAITING | THREAD_FLAG_EVENT);
@@ -1377,6 +1392,11 @@ static void _process_events_await_msg(gnrc_netif_t *netif, msg_t *msg)
     }
     else {
         /* Only messages used for event handling */
+        if (IS_USED(MODULE_GNRC_NETAPI_TRAIN) && (msg_try_receive(msg) > 0)) {
+            return;
+        }
+        /* the burst of received frames is over */
+        _pass_on_rx_train(netif);
         DEBUG("gnrc_netif: waiting for incoming messages\n");
         msg_receive(msg);
     }
@@ -1594,8 +1614,15 @@ static void *_gnrc_netif_thread(void *args)
     return NULL;
 }
 
-static void _pass_on_packet(gnrc_pktsnip_t *pkt)
+static void _pass_on_packet(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
+    (void)netif;
+#if IS_USED(MODULE_GNRC_NETAPI_TRAIN)
+    /* frames received back to back are passed on together, see
+     * _process_events_await_msg() */
+    gnrc_netapi_rx_train_add(&netif->rx_train, pkt->type,
+                             GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+#else
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
@@ -1603,6 +1630,7 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
         gnrc_pktbuf_release(pkt);
         return;
     }
+#endif
 }
 
 static void _event_cb(netdev_t *dev, netdev_event_t event)
@@ -1633,7 +1661,7 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
                  * Further packets will be sent on later TX_COMPLETE */
                 _send_queued_pkt(netif);
                 if (pkt) {
-                    _pass_on_packet(pkt);
+                    _pass_on_packet(netif, pkt);
                 }
                 break;
 #if IS_USED(MODULE_NETSTATS_L2) || IS_USED(MODULE_GNRC_NETIF_PKTQ)
@@ -28,6 +28,7 @@
 #include "net/ieee802154.h"
 #include "net/l2util.h"
 #if IS_USED(MODULE_GNRC_NETIF_6LO)
+#include "net/gnrc/sixlowpan/config.h"
 #include "net/sixlowpan.h"
 #endif
 
@@ -162,6 +163,9 @@ void gnrc_netif_ipv6_init_mtu(gnrc_netif_t *netif)
             }
             else {
                 netif->sixlo.max_frag_size = MIN(SIXLOWPAN_FRAG_MAX_LEN, tmp);
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && GNRC_SIXLOWPAN_SFR_NETIF_DEFAULT
+                netif->sixlo.local_flags |= GNRC_NETIF_6LO_LOCAL_FLAGS_SFR;
+#endif
             }
 #else   /* IS_USED(MODULE_GNRC_NETIF_6LO) */
             netif->ipv6.mtu = tmp;
@@ -15,38 +15,390 @@
 
 #include <assert.h>
 
+#include "net/gnrc/pktbuf.h"
 #include "net/gnrc/pktqueue.h"
 #include "net/gnrc/netif/conf.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/netif/pktq.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
 
-static gnrc_pktqueue_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+/* class selector code points of the DSCP, see RFC 2474, section 4.2.2 */
+#define _DSCP_CS4           (0x20U)
+#define _DSCP_CS6           (0x30U)
 
-static gnrc_pktqueue_t *_get_free_entry(void)
+/* a queue entry with the time it was queued for CoDel */
+typedef struct {
+    gnrc_pktqueue_t super;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+    uint32_t enqueued;
+#endif
+} _entry_t;
+
+static _entry_t _pool[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE];
+
+static _entry_t *_get_free_entry(void)
 {
     for (unsigned i = 0; i < CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE; i++) {
-        if (_pool[i].pkt == NULL) {
+        if (_pool[i].super.pkt == NULL) {
             return &_pool[i];
         }
     }
     return NULL;
 }
 
+/* time stamp for the sojourn time of a packet queued now */
+static inline uint32_t _now(void)
+{
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+    return xtimer_now_usec();
+#else
+    return 0;
+#endif
+}
+
+/* maps a priority class to the index of its queue */
+static inline unsigned _qidx(unsigned prio)
+{
+    return (GNRC_NETIF_PKTQ_PRIO_NUMOF > 1) ? prio : 0;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) && \
+    (IS_USED(MODULE_GNRC_NETTYPE_IPV6) || IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN))
+static unsigned _prio(uint8_t dscp, uint8_t nh)
+{
+    if ((nh == PROTNUM_ICMPV6) || (dscp >= _DSCP_CS6)) {
+        return GNRC_NETIF_PKTQ_PRIO_CONTROL;
+    }
+    if (dscp >= _DSCP_CS4) {
+        return GNRC_NETIF_PKTQ_PRIO_EXPEDITED;
+    }
+    return GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT;
+}
+
+static unsigned _prio_ipv6(const uint8_t *data, size_t size)
+{
+    const ipv6_hdr_t *hdr = (const ipv6_hdr_t *)data;
+
+    if (size < sizeof(ipv6_hdr_t)) {
+        return GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT;
+    }
+    return _prio(ipv6_hdr_get_tc_dscp(hdr), hdr->nh);
+}
+#endif
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) && IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+static unsigned _prio_sixlowpan(uint8_t *data, size_t size)
+{
+    unsigned offset = SIXLOWPAN_IPHC_HDR_LEN;
+    uint8_t dscp = 0;
+    uint8_t nh = PROTNUM_RESERVED;
+
+    if ((size > sizeof(sixlowpan_frag_t)) &&
+        sixlowpan_frag_1_is((sixlowpan_frag_t *)data)) {
+        data += sizeof(sixlowpan_frag_t);
+        size -= sizeof(sixlowpan_frag_t);
+    }
+    if ((size > 1) && (data[0] == SIXLOWPAN_UNCOMP)) {
+        return _prio_ipv6(&data[1], size - 1);
+    }
+    if ((size < SIXLOWPAN_IPHC_HDR_LEN) || !sixlowpan_iphc_is(data)) {
+        /* subsequent fragments carry no IPv6 header */
+        return GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT;
+    }
+    if (data[1] & SIXLOWPAN_IPHC2_CID_EXT) {
+        offset += SIXLOWPAN_IPHC_CID_EXT_LEN;
+    }
+    /* traffic class is inlined as ECN + DSCP, see RFC 6282, section 3.1.1 */
+    switch (data[0] & SIXLOWPAN_IPHC1_TF) {
+        case 0x00:
+            dscp = (offset < size) ? (data[offset] & 0x3f) : 0;
+            offset += 4;
+            break;
+        case 0x08:
+            offset += 3;
+            break;
+        case 0x10:
+            dscp = (offset < size) ? (data[offset] & 0x3f) : 0;
+            offset += 1;
+            break;
+        default:
+            break;
+    }
+    if (!(data[0] & SIXLOWPAN_IPHC1_NH) && (offset < size)) {
+        nh = data[offset];
+    }
+    return _prio(dscp, nh);
+}
+#endif
+
+unsigned gnrc_netif_pktq_prio_class(const gnrc_pktsnip_t *pkt)
+{
+    assert(pkt != NULL);
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    for (; pkt != NULL; pkt = pkt->next) {
+        switch (pkt->type) {
+#if IS_USED(MODULE_GNRC_NETTYPE_IPV6)
+            case GNRC_NETTYPE_IPV6:
+                return _prio_ipv6(pkt->data, pkt->size);
+#endif
+#if IS_USED(MODULE_GNRC_NETTYPE_SIXLOWPAN)
+            case GNRC_NETTYPE_SIXLOWPAN:
+                return _prio_sixlowpan(pkt->data, pkt->size);
+#endif
+            default:
+                break;
+        }
+    }
+#else   /* IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) */
+    (void)pkt;
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) */
+    return GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+/* drops the last packet of the lowest non-empty class below prio_idx */
+static _entry_t *_evict(gnrc_netif_t *netif, unsigned prio_idx)
+{
+    for (unsigned i = GNRC_NETIF_PKTQ_PRIO_NUMOF - 1; i > prio_idx; i--) {
+        gnrc_pktqueue_t *last = netif->send_queue.queue[i];
+
+        if (last == NULL) {
+            continue;
+        }
+        while (last->next != NULL) {
+            last = last->next;
+        }
+        gnrc_pktqueue_remove(&netif->send_queue.queue[i], last);
+        gnrc_pktbuf_release(last->pkt);
+        last->pkt = NULL;
+        netif->send_queue.stats[i].len--;
+        netif->send_queue.stats[i].evicted++;
+        return (_entry_t *)last;
+    }
+    return NULL;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO) */
+
+static _entry_t *_get_entry(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                            unsigned *prio_idx, uint32_t enqueued)
+{
+    _entry_t *entry;
+
+    *prio_idx = _qidx(gnrc_netif_pktq_prio_class(pkt));
+    entry = _get_free_entry();
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_PRIO)
+    if (entry == NULL) {
+        entry = _evict(netif, *prio_idx);
+    }
+#endif
+    if (entry == NULL) {
+        netif->send_queue.stats[*prio_idx].full++;
+        return NULL;
+    }
+    entry->super.pkt = pkt;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+    entry->enqueued = enqueued;
+#else
+    (void)enqueued;
+#endif
+    return entry;
+}
+
+static void _queued(gnrc_netif_t *netif, unsigned prio_idx)
+{
+    gnrc_netif_pktq_stats_t *stats = &netif->send_queue.stats[prio_idx];
+
+    stats->len++;
+    if (stats->len > stats->max_len) {
+        stats->max_len = stats->len;
+    }
+}
+
 int gnrc_netif_pktq_put(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
 {
     assert(netif != NULL);
     assert(pkt != NULL);
 
-    gnrc_pktqueue_t *entry = _get_free_entry();
+    unsigned prio_idx;
+    _entry_t *entry = _get_entry(netif, pkt, &prio_idx, _now());
 
     if (entry == NULL) {
         return -1;
     }
-    entry->pkt = pkt;
-    gnrc_pktqueue_add(&netif->send_queue.queue, entry);
+    gnrc_pktqueue_add(&netif->send_queue.queue[prio_idx], &entry->super);
+    _queued(netif, prio_idx);
     return 0;
 }
 
+static gnrc_pktsnip_t *_dequeue(gnrc_netif_t *netif, unsigned prio_idx,
+                                uint32_t *enqueued)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+    _entry_t *entry = (_entry_t *)gnrc_pktqueue_remove_head(
+        &netif->send_queue.queue[prio_idx]
+    );
+
+    (void)enqueued;
+    if (entry != NULL) {
+        pkt = entry->super.pkt;
+        entry->super.pkt = NULL;
+        netif->send_queue.stats[prio_idx].len--;
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+        *enqueued = entry->enqueued;
+        netif->send_queue.last_pkt = pkt;
+        netif->send_queue.last_enqueued = entry->enqueued;
+#endif
+    }
+    return pkt;
+}
+
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+static inline bool _time_reached(uint32_t now, uint32_t time)
+{
+    /* xtimer_now_usec() overflows every ~1.2 hours */
+    return (now - time) < (UINT32_MAX / 2);
+}
+
+static uint32_t _isqrt(uint32_t n)
+{
+    uint32_t res = 0, bit = UINT32_C(1) << 30;
+
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= res + bit) {
+            n -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+static inline uint32_t _control_law(uint32_t t, uint32_t count)
+{
+    assert(count > 0);
+    return t + (CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US / _isqrt(count));
+}
+
+static void _codel_drop(gnrc_netif_t *netif, unsigned prio_idx,
+                        gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktbuf_release(pkt);
+    netif->send_queue.stats[prio_idx].aqm_drops++;
+}
+
+static gnrc_pktsnip_t *_codel_dodequeue(gnrc_netif_t *netif,
+                                        unsigned prio_idx, uint32_t now,
+                                        bool *ok_to_drop)
+{
+    gnrc_netif_pktq_codel_t *codel = &netif->send_queue.codel[prio_idx];
+    uint32_t enqueued = 0;
+    gnrc_pktsnip_t *pkt = _dequeue(netif, prio_idx, &enqueued);
+
+    *ok_to_drop = false;
+    if (pkt == NULL) {
+        codel->first_above_time = 0;
+        return NULL;
+    }
+    /* don't drop the last packet in the queue, so there is always something
+     * to send */
+    if (((now - enqueued) < CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US) ||
+        (netif->send_queue.queue[prio_idx] == NULL)) {
+        codel->first_above_time = 0;
+    }
+    else if (codel->first_above_time == 0) {
+        /* 0 marks sojourn time below target, so avoid it as a timestamp */
+        codel->first_above_time = (now + CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US) | 1;
+    }
+    else if (_time_reached(now, codel->first_above_time)) {
+        *ok_to_drop = true;
+    }
+    return pkt;
+}
+
+/* see RFC 8289, section 5.5 */
+static gnrc_pktsnip_t *_codel_dequeue(gnrc_netif_t *netif, unsigned prio_idx)
+{
+    gnrc_netif_pktq_codel_t *codel = &netif->send_queue.codel[prio_idx];
+    uint32_t now = xtimer_now_usec();
+    bool ok_to_drop;
+    gnrc_pktsnip_t *pkt = _codel_dodequeue(netif, prio_idx, now, &ok_to_drop);
+
+    if (pkt == NULL) {
+        codel->dropping = false;
+        return NULL;
+    }
+    if (codel->dropping) {
+        if (!ok_to_drop) {
+            /* sojourn time below target - leave dropping state */
+            codel->dropping = false;
+        }
+        while (codel->dropping && _time_reached(now, codel->drop_next)) {
+            _codel_drop(netif, prio_idx, pkt);
+            if (codel->count < UINT32_MAX) {
+                codel->count++;
+            }
+            pkt = _codel_dodequeue(netif, prio_idx, now, &ok_to_drop);
+            if (!ok_to_drop) {
+                codel->dropping = false;
+            }
+            else {
+                codel->drop_next = _control_law(codel->drop_next,
+                                                codel->count);
+            }
+        }
+    }
+    else if (ok_to_drop) {
+        uint32_t delta;
+
+        _codel_drop(netif, prio_idx, pkt);
+        pkt = _codel_dodequeue(netif, prio_idx, now, &ok_to_drop);
+        codel->dropping = true;
+        /* if we were dropping recently, start with the drop rate we ended
+         * with */
+        delta = codel->count - codel->lastcount;
+        codel->count = 1;
+        if ((delta > 1) &&
+            ((now - codel->drop_next) <
+             (16 * CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US))) {
+            codel->count = delta;
+        }
+        codel->drop_next = _control_law(now, codel->count);
+        codel->lastcount = codel->count;
+    }
+    return pkt;
+}
+#endif  /* IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL) */
+
+gnrc_pktsnip_t *gnrc_netif_pktq_get(gnrc_netif_t *netif)
+{
+    assert(netif != NULL);
+
+    for (unsigned i = 0; i < GNRC_NETIF_PKTQ_PRIO_NUMOF; i++) {
+        gnrc_pktsnip_t *pkt;
+
+        if (netif->send_queue.queue[i] == NULL) {
+            continue;
+        }
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+        pkt = _codel_dequeue(netif, i);
+#else
+        pkt = _dequeue(netif, i, NULL);
+#endif
+        if (pkt != NULL) {
+            return pkt;
+        }
+    }
+    return NULL;
+}
+
 void gnrc_netif_pktq_sched_get(gnrc_netif_t *netif)
 {
 #if CONFIG_GNRC_NETIF_PKTQ_TIMER_US >= 0
@@ -73,13 +425,24 @@ int gnrc_netif_pktq_push_back(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
     assert(netif != NULL);
     assert(pkt != NULL);
 
-    gnrc_pktqueue_t *entry = _get_free_entry();
+    unsigned prio_idx;
+    uint32_t enqueued = _now();
+    _entry_t *entry;
 
+#if IS_USED(MODULE_GNRC_NETIF_PKTQ_CODEL)
+    /* the packet is usually pushed back, because it could not be sent after
+     * gnrc_netif_pktq_get(), so its sojourn time continues */
+    if (pkt == netif->send_queue.last_pkt) {
+        enqueued = netif->send_queue.last_enqueued;
+        netif->send_queue.last_pkt = NULL;
+    }
+#endif
+    entry = _get_entry(netif, pkt, &prio_idx, enqueued);
     if (entry == NULL) {
         return -1;
     }
-    entry->pkt = pkt;
-    LL_PREPEND(netif->send_queue.queue, entry);
+    LL_PREPEND(netif->send_queue.queue[prio_idx], &entry->super);
+    _queued(netif, prio_idx);
     return 0;
 }
 
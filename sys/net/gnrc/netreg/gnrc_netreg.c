@@ -16,6 +16,7 @@
 #include <string.h>
 
 #include "assert.h"
+#include "kernel_defines.h"
 #include "log.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
@@ -30,13 +31,35 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#if IS_USED(MODULE_GNRC_NETREG_HASH)
+static_assert((CONFIG_GNRC_NETREG_HASH_BUCKETS &
+               (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_NETREG_HASH_BUCKETS must be a power of 2");
+
+/* The registry as lookup table by gnrc_nettype_t and hashed demux context */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_HASH_BUCKETS];
+
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* Fibonacci hashing, so consecutive ports end up in different buckets */
+    return &netreg[type][((demux_ctx * 2654435769U) >> 16) &
+                         (CONFIG_GNRC_NETREG_HASH_BUCKETS - 1)];
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_head(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+#endif
+
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -61,7 +84,7 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*_head(type, entry->demux_ctx), entry);
 
     return 0;
 }
@@ -72,7 +95,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_head(type, entry->demux_ctx), entry);
 }
 
 /**
@@ -94,7 +117,8 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        /* all entries with the same demux context are in the same list */
+        gnrc_netreg_entry_t *head = (from) ? from->next : *_head(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
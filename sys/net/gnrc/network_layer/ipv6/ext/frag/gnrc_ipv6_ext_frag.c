@@ -36,8 +36,6 @@
 
 static gnrc_ipv6_ext_frag_send_t _snd_bufs[CONFIG_GNRC_IPV6_EXT_FRAG_SEND_SIZE];
 static gnrc_ipv6_ext_frag_rbuf_t _rbuf[CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE];
-static gnrc_ipv6_ext_frag_limits_t _limits_pool[CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE];
-static clist_node_t _free_limits;
 static xtimer_t _gc_xtimer;
 static msg_t _gc_msg = { .type = GNRC_IPV6_EXT_FRAG_RBUF_GC };
 static gnrc_ipv6_ext_frag_stats_t _stats;
@@ -53,7 +51,8 @@ typedef enum {
     FRAG_LIMITS_NEW = 0,        /**< limits are not present and do not overlap */
     FRAG_LIMITS_DUPLICATE,      /**< fragment limits are already present */
     FRAG_LIMITS_OVERLAP,        /**< limits overlap */
-    FRAG_LIMITS_FULL,           /**< no free gnrc_ipv6_ext_frag_limits_t object */
+    FRAG_LIMITS_FULL,           /**< no free gnrc_ipv6_ext_frag_limits_t object
+                                 *   in reassembly buffer entry */
 } _limits_res_t;
 
 void gnrc_ipv6_ext_frag_init(void)
@@ -62,9 +61,6 @@ void gnrc_ipv6_ext_frag_init(void)
     memset(_rbuf, 0, sizeof(_rbuf));
 #endif
     _last_id = random_uint32();
-    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE; i++) {
-        clist_rpush(&_free_limits, (clist_node_t *)&_limits_pool[i]);
-    }
 }
 
 /*
@@ -586,10 +582,8 @@ gnrc_ipv6_ext_frag_rbuf_t *gnrc_ipv6_ext_frag_rbuf_get(ipv6_hdr_t *ipv6,
 void gnrc_ipv6_ext_frag_rbuf_free(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
     rbuf->ipv6 = NULL;
-    while (rbuf->limits.next != NULL) {
-        clist_node_t *tmp = clist_lpop(&rbuf->limits);
-        clist_rpush(&_free_limits, tmp);
-    }
+    rbuf->limits_numof = 0;
+    rbuf->frags = 0;
 }
 
 void gnrc_ipv6_ext_frag_rbuf_gc(void)
@@ -608,11 +602,6 @@ gnrc_ipv6_ext_frag_stats_t *gnrc_ipv6_ext_frag_stats(void)
     return (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) ? &_stats : NULL;
 }
 
-typedef struct {
-    uint16_t start;
-    uint16_t end;
-} _check_limits_t;
-
 static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
                               uint32_t id)
 {
@@ -620,57 +609,85 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
     rbuf->id = id;
     rbuf->pkt_len = 0;
     rbuf->last = 0;
-}
-
-static int _check_overlap(clist_node_t *node, void *arg)
-{
-    _check_limits_t *limits = arg;
-    gnrc_ipv6_ext_frag_limits_t *cur = (gnrc_ipv6_ext_frag_limits_t *)node;
-
-    return ((cur->start < limits->end) && (limits->start < cur->end));
-}
-
-static int _limits_cmp(clist_node_t *a, clist_node_t *b)
-{
-    gnrc_ipv6_ext_frag_limits_t *al = (gnrc_ipv6_ext_frag_limits_t *)a;
-    gnrc_ipv6_ext_frag_limits_t *bl = (gnrc_ipv6_ext_frag_limits_t *)b;
+    if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+        unsigned used = 0;
 
-    return (int)al->start - (int)bl->start;
+        for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE; i++) {
+            if (_rbuf[i].ipv6 != NULL) {
+                used++;
+            }
+        }
+        if (used > _stats.rbuf_max_used) {
+            _stats.rbuf_max_used = used;
+        }
+    }
 }
 
 static _limits_res_t _overlaps(gnrc_ipv6_ext_frag_rbuf_t *rbuf,
                                unsigned offset, unsigned pkt_len)
 {
-    _check_limits_t limits = { .start = offset >> 3U,
-                               .end = (offset + pkt_len) >> 3U };
-    gnrc_ipv6_ext_frag_limits_t *res;
+    gnrc_ipv6_ext_frag_limits_t *limits = rbuf->limits;
+    uint16_t start = offset >> 3U;
+    uint16_t end = (offset + pkt_len) >> 3U;
+    unsigned i = 0;
 
-    if (limits.start == limits.end) {
+    if (start == end) {
         /* might happen with last fragment */
-        limits.end++;
-    }
-    res = (gnrc_ipv6_ext_frag_limits_t *)clist_foreach(&rbuf->limits,
-                                                       _check_overlap,
-                                                       &limits);
-    if (res == NULL) {
-        res = (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
-        if (res != NULL) {
-            res->start = limits.start;
-            res->end = limits.end;
-            clist_rpush(&rbuf->limits, (clist_node_t *)res);
-            clist_sort(&rbuf->limits, _limits_cmp);
-            return FRAG_LIMITS_NEW;
+        end++;
+    }
+    /* limits are sorted and do not touch each other, so find the first one
+     * that does not end before the fragment */
+    while ((i < rbuf->limits_numof) && (limits[i].end < start)) {
+        i++;
+    }
+    if ((i < rbuf->limits_numof) && (limits[i].start <= end)) {
+        if ((limits[i].start < end) && (start < limits[i].end)) {
+            /* adjacent fragments are merged, so a fragment that lies
+             * completely within known limits was already received */
+            if ((limits[i].start <= start) && (end <= limits[i].end)) {
+                return FRAG_LIMITS_DUPLICATE;
+            }
+            return FRAG_LIMITS_OVERLAP;
+        }
+        if (limits[i].end == start) {
+            /* fragment is adjacent to the end of limits[i] */
+            bool has_next = ((i + 1) < rbuf->limits_numof);
+
+            if (has_next && (limits[i + 1].start < end)) {
+                return FRAG_LIMITS_OVERLAP;
+            }
+            if (has_next && (limits[i + 1].start == end)) {
+                /* fragment closes the gap between limits[i] and
+                 * limits[i + 1] */
+                limits[i].end = limits[i + 1].end;
+                memmove(&limits[i + 1], &limits[i + 2],
+                        (rbuf->limits_numof - i - 2) * sizeof(limits[0]));
+                rbuf->limits_numof--;
+            }
+            else {
+                limits[i].end = end;
+            }
         }
         else {
-            return FRAG_LIMITS_FULL;
+            /* fragment is adjacent to the start of limits[i] */
+            limits[i].start = start;
         }
     }
-    else if ((res->start == limits.start) && (res->end == limits.end)) {
-        return FRAG_LIMITS_DUPLICATE;
+    else if (rbuf->limits_numof < CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_NUMOF) {
+        memmove(&limits[i + 1], &limits[i],
+                (rbuf->limits_numof - i) * sizeof(limits[0]));
+        limits[i].start = start;
+        limits[i].end = end;
+        rbuf->limits_numof++;
     }
     else {
-        return FRAG_LIMITS_NEW;
+        if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+            _stats.limits_full++;
+        }
+        return FRAG_LIMITS_FULL;
     }
+    rbuf->frags++;
+    return FRAG_LIMITS_NEW;
 }
 
 static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
@@ -695,30 +712,20 @@ static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
 
 static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
 {
-    assert(rbuf->limits.next != NULL);    /* this function is only called when
-                                           * at least one fragment was already
-                                           * added */
-    /* clist: first element is second element ;-) (from next of head) */
-    gnrc_ipv6_ext_frag_limits_t *ptr =
-            (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next->next;
-    if (rbuf->last && (ptr->start == 0)) {
-        gnrc_pktsnip_t *res = NULL;
-
-        /* last and first fragment were received, so check if everything
-         * in-between is there */
-        do {
-            gnrc_ipv6_ext_frag_limits_t *next = ptr->next;
-            if (ptr->end < next->start) {
-                return NULL;
-            }
-            ptr = next;
-        } while (((clist_node_t *)ptr) != rbuf->limits.next);
-        res = rbuf->pkt;
+    assert(rbuf->limits_numof > 0);   /* this function is only called when
+                                       * at least one fragment was already
+                                       * added */
+    /* last and first fragment were received and everything in-between is
+     * there when all fragments were merged into a single limits object */
+    if (rbuf->last && (rbuf->limits_numof == 1) &&
+        (rbuf->limits[0].start == 0)) {
+        gnrc_pktsnip_t *res = rbuf->pkt;
+
         /* rewrite length */
         rbuf->ipv6->len = byteorder_htons(rbuf->pkt_len);
         rbuf->pkt = NULL;
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
-            _stats.fragments += clist_count(&rbuf->limits);
+            _stats.fragments += rbuf->frags;
             _stats.datagrams++;
         }
         gnrc_ipv6_ext_frag_rbuf_free(rbuf);
@@ -61,6 +61,13 @@ static char _stack[GNRC_IPV6_STACK_SIZE];
  */
 static fib_entry_t _fib_entries[GNRC_IPV6_FIB_TABLE_SIZE];
 
+#ifdef MODULE_FIB_RADIX
+/**
+ * @brief buffer to store the radix tree nodes of the IPv6 forwarding table
+ */
+static fib_radix_node_t _fib_radix[FIB_RADIX_NODES_NUMOF(GNRC_IPV6_FIB_TABLE_SIZE)];
+#endif
+
 /**
  * @brief the IPv6 forwarding table
  */
@@ -71,6 +78,13 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+/* upper layer packets of a received train, only used while handling the
+ * train */
+static gnrc_netapi_rx_train_t _rx_train;
+static bool _rx_train_active;
+#endif
+
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
@@ -96,6 +110,9 @@ kernel_pid_t gnrc_ipv6_init(void)
     gnrc_ipv6_fib_table.data.entries = _fib_entries;
     gnrc_ipv6_fib_table.table_type = FIB_TABLE_TYPE_SH;
     gnrc_ipv6_fib_table.size = GNRC_IPV6_FIB_TABLE_SIZE;
+#ifdef MODULE_FIB_RADIX
+    gnrc_ipv6_fib_table.radix = _fib_radix;
+#endif
     fib_init(&gnrc_ipv6_fib_table);
 #endif
 
@@ -152,6 +169,14 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
 
     DEBUG("ipv6: forward nh = %u to other threads\n", nh);
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    if (_rx_train_active && !has_nh_subs) {
+        /* pass the packets of a train on to the upper layer as a train */
+        gnrc_netapi_rx_train_add(&_rx_train, pkt->type,
+                                 GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+        return;
+    }
+#endif
     if (has_nh_subs) {
         gnrc_pktbuf_hold(pkt, 1);   /* don't remove from packet buffer in
                                      * next dispatch */
@@ -181,6 +206,9 @@ static void *_event_loop(void *args)
                                                             thread_getpid());
 
     (void)args;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    me_reg.train = true;
+#endif
     msg_init_queue(msg_q, GNRC_IPV6_MSG_QUEUE_SIZE);
 
     /* initialize fragmentation data-structures */
@@ -209,6 +237,29 @@ static void *_event_loop(void *args)
                 _send(msg.content.ptr, true);
                 break;
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+            case GNRC_NETAPI_MSG_TYPE_RCV_TRAIN:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_TRAIN received\n");
+                _rx_train_active = true;
+                for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+                    _receive(gnrc_netapi_train_pkt(msg.content.ptr, i));
+                }
+                _rx_train_active = false;
+                gnrc_pktbuf_release(msg.content.ptr);
+                if (_rx_train.numof > 0) {
+                    gnrc_netapi_rx_train_flush(&_rx_train);
+                }
+                break;
+
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND_TRAIN received\n");
+                for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+                    _send(gnrc_netapi_train_pkt(msg.content.ptr, i), true);
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+#endif
+
             case GNRC_NETAPI_MSG_TYPE_GET:
             case GNRC_NETAPI_MSG_TYPE_SET:
                 DEBUG("ipv6: reply to unsupported get/set\n");
@@ -25,6 +25,7 @@
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
+#include "prefix_trie.h"
 #include "random.h"
 
 #include "_nib-internal.h"
@@ -41,6 +42,40 @@ static _nib_onl_entry_t _nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
 static _nib_offl_entry_t _dsts[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
 static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+/*
+ * Open-addressing hash table over the IPv6 addresses of _nodes with linear
+ * probing. Slots reference nodes by index + 1, so 0 means "empty slot". The
+ * interface is not part of the key, since _nib_onl_get() treats interface 0
+ * as a wildcard. The table is at most half full, so probing always ends on
+ * an empty slot.
+ */
+#define _ONL_HASH_NUMOF (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+static_assert(_ONL_HASH_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for hash table");
+
+static uint16_t _onl_hash[_ONL_HASH_NUMOF];
+
+static void _nib_onl_index(const _nib_onl_entry_t *node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+/* trie over the prefixes of _dsts for longest-prefix matching */
+static const uint8_t *_trie_key(const prefix_trie_t *trie, unsigned idx,
+                                size_t *size);
+
+static_assert(PREFIX_TRIE_NODES_NUMOF(CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF too large for trie");
+
+static prefix_trie_node_t _trie_nodes[PREFIX_TRIE_NODES_NUMOF(CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF)];
+static prefix_trie_t _trie = {
+    .nodes = _trie_nodes,
+    .key = _trie_key,
+    .numof = CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+};
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -62,6 +97,13 @@ void _nib_init(void)
     memset(_nodes, 0, sizeof(_nodes));
     memset(_def_routers, 0, sizeof(_def_routers));
     memset(_dsts, 0, sizeof(_dsts));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    memset(_onl_hash, 0, sizeof(_onl_hash));
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+    prefix_trie_init(&_trie, _trie_nodes, CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+                     _trie_key);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
@@ -214,24 +256,103 @@ _nib_onl_entry_t *_nib_onl_iter(const _nib_onl_entry_t *last)
     return NULL;
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+static unsigned _onl_hash_slot(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* Fibonacci hashing to spread similar addresses */
+    return ((hash * 2654435769U) >> 16) % _ONL_HASH_NUMOF;
+}
+
+static inline unsigned _onl_hash_next(unsigned slot)
+{
+    return (slot + 1) % _ONL_HASH_NUMOF;
+}
+
+static void _nib_onl_index(const _nib_onl_entry_t *node)
+{
+    unsigned slot = _onl_hash_slot(&node->ipv6);
+
+    while (_onl_hash[slot] != 0) {
+        slot = _onl_hash_next(slot);
+    }
+    _onl_hash[slot] = (node - _nodes) + 1;
+}
+
+void _nib_onl_unindex(const _nib_onl_entry_t *node)
+{
+    uint16_t ref = (node - _nodes) + 1;
+    unsigned slot = _onl_hash_slot(&node->ipv6);
+
+    while (_onl_hash[slot] != ref) {
+        if (_onl_hash[slot] == 0) {
+            /* not indexed */
+            return;
+        }
+        slot = _onl_hash_next(slot);
+    }
+    /* shift following entries of the probe sequence back into the gap, so
+     * no tombstones are needed */
+    for (unsigned next = _onl_hash_next(slot); _onl_hash[next] != 0;
+         next = _onl_hash_next(next)) {
+        unsigned home = _onl_hash_slot(&_nodes[_onl_hash[next] - 1].ipv6);
+
+        /* entry can be moved if its home slot is not cyclically within
+         * (slot, next] */
+        if ((slot < next) ? ((home <= slot) || (home > next))
+                          : ((home <= slot) && (home > next))) {
+            _onl_hash[slot] = _onl_hash[next];
+            slot = next;
+        }
+    }
+    _onl_hash[slot] = 0;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
+
+static inline bool _onl_matches(const _nib_onl_entry_t *node,
+                                const ipv6_addr_t *addr, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           /* either requested or current interface undefined or
+            * interfaces equal */
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface)) &&
+           ipv6_addr_equal(&node->ipv6, addr);
+}
+
 _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
 {
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_entry_t *res = NULL;
+
+    for (unsigned slot = _onl_hash_slot(addr); _onl_hash[slot] != 0;
+         slot = _onl_hash_next(slot)) {
+        _nib_onl_entry_t *node = &_nodes[_onl_hash[slot] - 1];
+
+        /* return the first match in _nodes like the linear search would */
+        if (_onl_matches(node, addr, iface) && ((res == NULL) || (node < res))) {
+            res = node;
+        }
+    }
+    if (res != NULL) {
+        DEBUG("  Found %p\n", (void *)res);
+        return res;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
-        if ((node->mode != _EMPTY) &&
-            /* either requested or current interface undefined or
-             * interfaces equal */
-            ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
-             (_nib_onl_get_if(node) == iface)) &&
-            ipv6_addr_equal(&node->ipv6, addr)) {
+        if (_onl_matches(node, addr, iface)) {
             DEBUG("  Found %p\n", (void *)node);
             return node;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -493,7 +614,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+                _nib_onl_unindex(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+                _nib_onl_index(tmp_node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +641,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        prefix_trie_add(&_trie, dst - _dsts, pfx_len);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
     }
     return dst;
 }
@@ -550,6 +680,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+        prefix_trie_remove(&_trie, dst - _dsts);
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -573,6 +706,39 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+static const uint8_t *_trie_key(const prefix_trie_t *trie, unsigned idx,
+                                size_t *size)
+{
+    (void)trie;
+    *size = sizeof(ipv6_addr_t);
+    return _dsts[idx].pfx.u8;
+}
+
+static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    prefix_trie_iter_t iter;
+    int idx;
+    int len = -1;
+
+    DEBUG("nib: get match for destination %s from NIB\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    prefix_trie_match_init(&_trie, &iter);
+    /* take the first used entry of the longest matching prefix */
+    while ((idx = prefix_trie_match(&_trie, dst->u8, sizeof(*dst), &iter)) >= 0) {
+        if ((_dsts[idx].mode != _EMPTY) &&
+            ((int)prefix_trie_len(&_trie, idx) > len)) {
+            len = prefix_trie_len(&_trie, idx);
+            res = &_dsts[idx];
+            DEBUG("nib: best match so far %s/%u\n",
+                  ipv6_addr_to_str(addr_str, &res->pfx, sizeof(addr_str)),
+                  (unsigned)len);
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
@@ -601,6 +767,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
     }
     return res;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
@@ -827,10 +994,16 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+    _nib_onl_index(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
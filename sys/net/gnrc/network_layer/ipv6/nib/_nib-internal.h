@@ -311,6 +311,16 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+/**
+ * @brief   Removes an on-link entry from the hash table over the IPv6
+ *          addresses
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_ONL_HASH != 0.
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_unindex(const _nib_onl_entry_t *node);
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,6 +332,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ONL_HASH)
+        _nib_onl_unindex(node);
+#endif  /* CONFIG_GNRC_IPV6_NIB_ONL_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
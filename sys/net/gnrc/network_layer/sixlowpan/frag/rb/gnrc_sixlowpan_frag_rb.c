@@ -32,29 +32,12 @@
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
-#include "utlist.h"
 
 #include "net/gnrc/sixlowpan/frag/rb.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-/* estimated fragment payload size to determinate RBUF_INT_SIZE, default to
- * MAC payload size - fragment header. */
-#ifndef GNRC_SIXLOWPAN_FRAG_SIZE
-/* assuming 64-bit source/destination address, source PAN ID omitted */
-#define GNRC_SIXLOWPAN_FRAG_SIZE (104 - 5)
-#endif
-
-#ifndef RBUF_INT_SIZE
-/* same as ((int) ceil((double) N / D)) */
-#define DIV_CEIL(N, D) (((N) + (D) - 1) / (D))
-#define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * \
-                       CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
-#endif
-
-static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
-
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
@@ -65,13 +48,8 @@ static msg_t _gc_timer_msg = { .type = GNRC_SIXLOWPAN_FRAG_RB_GC_MSG };
 /* ------------------------------------
  * internal function definitions
  * ------------------------------------*/
-/* checks whether start and end overlaps, but not identical to, given interval i */
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end);
-/* gets a free entry from interval buffer */
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void);
 /* update interval buffer of entry */
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
+static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_t *entry,
                               uint16_t offset, size_t frag_size);
 /* gets an entry identified by its tuple */
 static int _rbuf_get(const void *src, size_t src_len,
@@ -93,28 +71,33 @@ enum {
     RBUF_ADD_DUPLICATE = -3,
 };
 
-static int _check_fragments(gnrc_sixlowpan_frag_rb_base_t *entry,
+static int _check_fragments(gnrc_sixlowpan_frag_rb_t *entry,
                             size_t frag_size, size_t offset)
 {
-    gnrc_sixlowpan_frag_rb_int_t *ptr = entry->ints;
+    const uint16_t end = (uint16_t)(offset + frag_size - 1);
 
     /* If the fragment overlaps another fragment and differs in either the size
      * or the offset of the overlapped fragment, discards the datagram
      * https://tools.ietf.org/html/rfc4944#section-5.3 */
-    while (ptr != NULL) {
-        if (_rbuf_int_overlap_partially(ptr, offset, offset + frag_size - 1)) {
+    for (unsigned i = 0; i < entry->ints_numof; i++) {
+        const gnrc_sixlowpan_frag_rb_int_t *ptr = &entry->ints[i];
 
+        if (ptr->start > end) {
+            /* intervals are sorted, so none of the following can overlap */
+            break;
+        }
+        if (offset <= ptr->end) {
+            /* adjacent fragments are merged, so a fragment that lies
+             * completely within an interval was already received */
+            if ((ptr->start <= offset) && (end <= ptr->end)) {
+                DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
+                return RBUF_ADD_DUPLICATE;
+            }
             /* "A fresh reassembly may be commenced with the most recently
              * received link fragment"
              * https://tools.ietf.org/html/rfc4944#section-5.3 */
             return RBUF_ADD_REPEAT;
         }
-        /* End was already checked in overlap check */
-        if (ptr->start == offset) {
-            DEBUG("6lo rbuf: fragment already in reassembly buffer\n");
-            return RBUF_ADD_DUPLICATE;
-        }
-        ptr = ptr->next;
     }
     return RBUF_ADD_SUCCESS;
 }
@@ -184,6 +167,14 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (sixlowpan_sfr_rfrag_is(pkt->data)) {
+        /* the first fragment carries the datagram size in the offset field */
+        return (sixlowpan_sfr_rfrag_get_seq(pkt->data) == 0)
+             ? (offset == 0)
+             : (offset == sixlowpan_sfr_rfrag_get_offset(pkt->data));
+    }
+#endif
     return (sixlowpan_frag_1_is(pkt->data) && (offset == 0)) ||
            (sixlowpan_frag_n_is(pkt->data) &&
             (offset == sixlowpan_frag_offset(pkt->data)));
@@ -195,6 +186,11 @@ static uint8_t *_6lo_frag_payload(gnrc_pktsnip_t *pkt)
     if (sixlowpan_frag_1_is(pkt->data)) {
         return ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_t);
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (sixlowpan_sfr_rfrag_is(pkt->data)) {
+        return ((uint8_t *)pkt->data) + sizeof(sixlowpan_sfr_rfrag_t);
+    }
+#endif
     else {
         return ((uint8_t *)pkt->data) + sizeof(sixlowpan_frag_n_t);
     }
@@ -202,18 +198,13 @@ static uint8_t *_6lo_frag_payload(gnrc_pktsnip_t *pkt)
 
 static size_t _6lo_frag_size(gnrc_pktsnip_t *pkt, size_t offset, uint8_t *data)
 {
-    size_t frag_size;
+    /* everything after the fragmentation header */
+    size_t frag_size = pkt->size - (data - (uint8_t *)pkt->data);
 
-    if (offset == 0) {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_t);
-        if (data[0] == SIXLOWPAN_UNCOMP) {
-            /* subtract SIXLOWPAN_UNCOMP byte from fragment size,
-             * data pointer must be changed by caller (see _rbuf_add()) */
-            frag_size--;
-        }
-    }
-    else {
-        frag_size = pkt->size - sizeof(sixlowpan_frag_n_t);
+    if ((offset == 0) && (data[0] == SIXLOWPAN_UNCOMP)) {
+        /* subtract SIXLOWPAN_UNCOMP byte from fragment size,
+         * data pointer must be changed by caller (see _rbuf_add()) */
+        frag_size--;
     }
     return frag_size;
 }
@@ -232,10 +223,38 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     assert(_valid_offset(pkt, offset));
     data = _6lo_frag_payload(pkt);
     frag_size = _6lo_frag_size(pkt, offset, data);
-    datagram_size = sixlowpan_frag_datagram_size(pkt->data);
-    datagram_tag = sixlowpan_frag_datagram_tag(pkt->data);
 
     gnrc_sixlowpan_frag_rb_gc();
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    if (sixlowpan_sfr_rfrag_is(pkt->data)) {
+        const sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+
+        datagram_tag = rfrag->base.tag;
+        if (offset == 0) {
+            /* the first fragment carries the datagram size in its offset
+             * field */
+            datagram_size = sixlowpan_sfr_rfrag_get_offset(rfrag);
+        }
+        else {
+            /* subsequent fragments do not carry the datagram size, so they
+             * can only be added to an existing entry */
+            gnrc_sixlowpan_frag_rb_t *e = _rbuf_get_by_tag(netif_hdr,
+                                                           datagram_tag);
+
+            if (e == NULL) {
+                DEBUG("6lo rbuf: no entry for recoverable fragment.\n");
+                gnrc_pktbuf_release(pkt);
+                return RBUF_ADD_ERROR;
+            }
+            datagram_size = e->super.datagram_size;
+        }
+    }
+    else
+#endif
+    {
+        datagram_size = sixlowpan_frag_datagram_size(pkt->data);
+        datagram_tag = sixlowpan_frag_datagram_tag(pkt->data);
+    }
     res = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                     gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                     datagram_size, datagram_tag, page);
@@ -254,7 +273,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
         return RBUF_ADD_ERROR;
     }
 
-    switch (_check_fragments(&entry->super, frag_size, offset)) {
+    switch (_check_fragments(entry, frag_size, offset)) {
         case RBUF_ADD_REPEAT:
             DEBUG("6lo rfrag: overlapping intervals, discarding datagram\n");
             gnrc_pktbuf_release(entry->pkt);
@@ -267,7 +286,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             break;
     }
 
-    if (_rbuf_update_ints(&entry->super, offset, frag_size)) {
+    if (_rbuf_update_ints(entry, offset, frag_size)) {
         DEBUG("6lo rbuf: add fragment data\n");
         entry->super.current_size += (uint16_t)frag_size;
         if (offset == 0) {
@@ -275,7 +294,7 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
             if (sixlowpan_iphc_is(data)) {
                 DEBUG("6lo rbuf: detected IPHC header.\n");
                 gnrc_pktsnip_t *frag_hdr = gnrc_pktbuf_mark(pkt,
-                        sizeof(sixlowpan_frag_t), GNRC_NETTYPE_SIXLOWPAN);
+                        data - (uint8_t *)pkt->data, GNRC_NETTYPE_SIXLOWPAN);
                 if (frag_hdr == NULL) {
                     DEBUG("6lo rbuf: unable to mark fragment header. "
                           "aborting reassembly.\n");
@@ -316,51 +335,58 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
     return res;
 }
 
-static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_frag_rb_int_t *i,
-                                               uint16_t start, uint16_t end)
-{
-    /* start and ends are both inclusive, so using <= for both */
-    return ((i->start <= end) && (start <= i->end)) && /* overlaps */
-        ((start != i->start) || (end != i->end)); /* not identical */
-}
-
-static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_get_free(void)
-{
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
-    }
-
-    return NULL;
-}
-
-static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
+static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_t *entry,
                               uint16_t offset, size_t frag_size)
 {
-    gnrc_sixlowpan_frag_rb_int_t *new;
-    uint16_t end = (uint16_t)(offset + frag_size - 1);
-
-    new = _rbuf_int_get_free();
-
-    if (new == NULL) {
+    gnrc_sixlowpan_frag_rb_int_t *ints = entry->ints;
+    const uint16_t end = (uint16_t)(offset + frag_size - 1);
+    unsigned i = 0;
+    bool merge_prev, merge_next;
+
+    /* _check_fragments() made sure the fragment does not overlap any
+     * interval, so find the first interval behind the fragment */
+    while ((i < entry->ints_numof) && (ints[i].end < offset)) {
+        i++;
+    }
+    merge_prev = (i > 0) && ((ints[i - 1].end + 1U) == offset);
+    merge_next = (i < entry->ints_numof) && ((end + 1U) == ints[i].start);
+    if (merge_prev && merge_next) {
+        /* fragment closes the gap between two intervals */
+        ints[i - 1].end = ints[i].end;
+        memmove(&ints[i], &ints[i + 1],
+                (entry->ints_numof - i - 1) * sizeof(ints[0]));
+        entry->ints_numof--;
+    }
+    else if (merge_prev) {
+        ints[i - 1].end = end;
+    }
+    else if (merge_next) {
+        ints[i].start = offset;
+    }
+    else if (entry->ints_numof < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_INTS_NUMOF) {
+        memmove(&ints[i + 1], &ints[i],
+                (entry->ints_numof - i) * sizeof(ints[0]));
+        ints[i].start = offset;
+        ints[i].end = end;
+        entry->ints_numof++;
+    }
+    else {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+        gnrc_sixlowpan_frag_stats_get()->rbuf_ints_full++;
+#endif
         return false;
     }
-
-    new->start = offset;
-    new->end = end;
+    entry->frags++;
 
     DEBUG("6lo rfrag: add interval (%" PRIu16 ", %" PRIu16 ") to entry (%s, ",
-          new->start, new->end, gnrc_netif_addr_to_str(entry->src,
-                                                       entry->src_len,
-                                                       l2addr_str));
-    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->dst,
-                                                  entry->dst_len,
+          offset, end, gnrc_netif_addr_to_str(entry->super.src,
+                                              entry->super.src_len,
+                                              l2addr_str));
+    DEBUG("%s, %u, %u)\n", gnrc_netif_addr_to_str(entry->super.dst,
+                                                  entry->super.dst_len,
                                                   l2addr_str),
-          entry->datagram_size, entry->tag);
-
-    LL_PREPEND(entry->ints, new);
+          entry->super.datagram_size, entry->super.tag);
 
     return true;
 }
@@ -406,6 +432,23 @@ void gnrc_sixlowpan_frag_rb_gc(void)
 #endif
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+static void _stats_update_rbuf_usage(void)
+{
+    gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+    unsigned used = 0;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
+            used++;
+        }
+    }
+    if (used > stats->rbuf_max_used) {
+        stats->rbuf_max_used = used;
+    }
+}
+#endif
+
 static inline void _set_rbuf_timeout(void)
 {
     xtimer_set_msg(&_gc_timer, CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US,
@@ -506,6 +549,9 @@ static int _rbuf_get(const void *src, size_t src_len,
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
         return -1;
     }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+    _stats_update_rbuf_usage();
+#endif
 
     if (res->pkt->data) {
         /* clean first few bytes for later look-ups */
@@ -537,7 +583,6 @@ static int _rbuf_get(const void *src, size_t src_len,
 void gnrc_sixlowpan_frag_rb_reset(void)
 {
     xtimer_remove(&_gc_timer);
-    memset(rbuf_int, 0, sizeof(rbuf_int));
     for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -555,15 +600,10 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
-    while (entry->ints != NULL) {
-        gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
-
-        entry->ints->start = 0;
-        entry->ints->end = 0;
-        entry->ints->next = NULL;
-        entry->ints = next;
-    }
     entry->datagram_size = 0;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    memset(entry->received, 0, sizeof(entry->received));
+#endif
 }
 
 static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
@@ -585,20 +625,6 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
 #endif  /* CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER */
 }
 
-#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-static inline unsigned _count_frags(gnrc_sixlowpan_frag_rb_t *rbuf)
-{
-    unsigned frags = 0;
-    gnrc_sixlowpan_frag_rb_int_t *frag = rbuf->super.ints;
-
-    while (frag) {
-        frag = frag->next;
-        frags++;
-    }
-    return frags;
-}
-#endif
-
 int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf,
                                                    gnrc_netif_hdr_t *netif_hdr)
 {
@@ -630,7 +656,7 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
+        gnrc_sixlowpan_frag_stats_get()->fragments += rbuf->frags;
         gnrc_sixlowpan_frag_stats_get()->datagrams++;
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
@@ -0,0 +1,847 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include "bitfield.h"
+#include "clist.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/internal.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/sixlowpan/config.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/gnrc/sixlowpan/internal.h"
+#include "net/sixlowpan/sfr.h"
+#include "xtimer.h"
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#include "net/gnrc/sixlowpan/frag/stats.h"
+#endif
+
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Number of fragment descriptors, enough to fill the windows of all
+ *          fragmentation buffer entries
+ */
+#define SFR_FRAG_DESCS_NUMOF    (CONFIG_GNRC_SIXLOWPAN_FRAG_FB_SIZE * \
+                                 GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE)
+
+/**
+ * @brief   Number of frames that can wait for the inter-frame gap to pass
+ */
+#define SFR_FRAME_QUEUE_SIZE    (2 * SFR_FRAG_DESCS_NUMOF)
+
+/**
+ * @brief   Describes a fragment sent but not acknowledged yet
+ *
+ * The fragment itself is not kept, it is rebuilt from
+ * gnrc_sixlowpan_frag_fb_t::pkt if it needs to be resent.
+ */
+typedef struct {
+    clist_node_t super;     /**< list parent class */
+    uint16_t offset;        /**< offset within the compressed datagram */
+    uint16_t size;          /**< size of the fragment's payload */
+    uint8_t seq;            /**< sequence number of the fragment */
+    uint8_t retries;        /**< number of times the fragment was resent */
+} _frag_desc_t;
+
+static _frag_desc_t _frag_descs[SFR_FRAG_DESCS_NUMOF];
+static clist_node_t _frag_descs_free;
+
+#if GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0
+static gnrc_pktsnip_t *_frame_queue[SFR_FRAME_QUEUE_SIZE];
+static unsigned _frame_queue_head, _frame_queue_len;
+static uint32_t _last_frame_sent;
+static xtimer_t _if_gap_timer;
+static msg_t _if_gap_msg = { .type = GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_MSG };
+#endif
+
+static char addr_str[GNRC_NETIF_HDR_L2ADDR_PRINT_LEN];
+
+static inline size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_STATS
+#define _COUNT_STAT(field)  (gnrc_sixlowpan_frag_stats_get()->field++)
+#else
+#define _COUNT_STAT(field)
+#endif
+
+static const uint8_t _full_bitmap[SIXLOWPAN_SFR_ACK_BITMAP_SIZE / 8] = {
+    0xff, 0xff, 0xff, 0xff
+};
+static const uint8_t _null_bitmap[SIXLOWPAN_SFR_ACK_BITMAP_SIZE / 8];
+
+static void _sched_frame(gnrc_pktsnip_t *frame);
+
+/* ========================== sender side =================================== */
+
+static inline uint16_t _max_frag_size(gnrc_netif_t *netif)
+{
+    return _min(GNRC_SIXLOWPAN_SFR_OPT_FRAG_SIZE,
+                netif->sixlo.max_frag_size - sizeof(sixlowpan_sfr_rfrag_t));
+}
+
+static void _free_window(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    clist_node_t *node;
+
+    while ((node = clist_lpop(&fbuf->sfr.window)) != NULL) {
+        clist_rpush(&_frag_descs_free, node);
+    }
+    fbuf->sfr.frags_sent = 0;
+}
+
+static void _clean_up_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf, uint32_t error)
+{
+    xtimer_remove(&fbuf->sfr.arq_timer);
+    _free_window(fbuf);
+    if (fbuf->pkt != NULL) {
+        gnrc_pktbuf_release_error(fbuf->pkt, error);
+        fbuf->pkt = NULL;
+    }
+}
+
+static void _set_arq_timer(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    /* identify the datagram by its tag, not by the buffer entry: the entry
+     * may be released and reused while the timeout message is still queued */
+    fbuf->sfr.arq_msg.content.value = fbuf->tag;
+    xtimer_set_msg(&fbuf->sfr.arq_timer,
+                   GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS * US_PER_MS,
+                   &fbuf->sfr.arq_msg, gnrc_sixlowpan_get_pid());
+}
+
+static void _copy_pkt(uint8_t *data, const gnrc_pktsnip_t *pkt,
+                      size_t offset, size_t size)
+{
+    while ((pkt != NULL) && (offset >= pkt->size)) {
+        offset -= pkt->size;
+        pkt = pkt->next;
+    }
+    while ((pkt != NULL) && (size > 0)) {
+        size_t len = _min(pkt->size - offset, size);
+
+        memcpy(data, ((uint8_t *)pkt->data) + offset, len);
+        data += len;
+        size -= len;
+        offset = 0;
+        pkt = pkt->next;
+    }
+}
+
+static gnrc_pktsnip_t *_build_frag(gnrc_sixlowpan_frag_fb_t *fbuf,
+                                   uint8_t seq, uint16_t offset, uint16_t size,
+                                   bool ack_req)
+{
+    gnrc_netif_hdr_t *netif_hdr = fbuf->pkt->data;
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_sfr_rfrag_t *hdr;
+    size_t payload_len = gnrc_pkt_len(fbuf->pkt->next);
+
+    netif = gnrc_netif_hdr_build(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                 netif_hdr->src_l2addr_len,
+                                 gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                                 netif_hdr->dst_l2addr_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: error allocating new link-layer header\n");
+        return NULL;
+    }
+    *((gnrc_netif_hdr_t *)netif->data) = *netif_hdr;
+    frag = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_rfrag_t) + size,
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: error allocating fragment\n");
+        gnrc_pktbuf_release(netif);
+        return NULL;
+    }
+    hdr = frag->data;
+    hdr->base.disp_ecn = 0;
+    hdr->ar_seq_fs.u16 = 0;
+    sixlowpan_sfr_rfrag_set_disp(&hdr->base);
+    hdr->base.tag = (uint8_t)fbuf->tag;
+    sixlowpan_sfr_rfrag_set_seq(hdr, seq);
+    sixlowpan_sfr_rfrag_set_frag_size(hdr, size);
+    if (ack_req) {
+        sixlowpan_sfr_rfrag_set_ack_req(hdr);
+    }
+    if (size == 0) {
+        /* abort fragment */
+        sixlowpan_sfr_rfrag_set_offset(hdr, 0);
+    }
+    else if (seq == 0) {
+        /* first fragment carries the datagram size */
+        sixlowpan_sfr_rfrag_set_offset(hdr, fbuf->datagram_size);
+    }
+    else {
+        /* compression only affects the headers in the first fragment */
+        sixlowpan_sfr_rfrag_set_offset(hdr, offset + (fbuf->datagram_size -
+                                                      payload_len));
+    }
+    _copy_pkt((uint8_t *)(hdr + 1), fbuf->pkt->next, offset, size);
+    if ((offset + size) < payload_len) {
+        /* Tell the link layer that we will send more fragments */
+        ((gnrc_netif_hdr_t *)netif->data)->flags |=
+            GNRC_NETIF_HDR_FLAGS_MORE_DATA;
+    }
+    DEBUG("6lo sfr: send fragment (tag: %u, seq: %u, size: %u, offset: %u, "
+          "ack_req: %u)\n", (unsigned)hdr->base.tag, (unsigned)seq,
+          (unsigned)size, (unsigned)sixlowpan_sfr_rfrag_get_offset(hdr),
+          (unsigned)ack_req);
+    return gnrc_pkt_prepend(frag, netif);
+}
+
+static int _resend_frag(gnrc_sixlowpan_frag_fb_t *fbuf, _frag_desc_t *desc,
+                        bool ack_req)
+{
+    gnrc_pktsnip_t *frame = _build_frag(fbuf, desc->seq, desc->offset,
+                                        desc->size, ack_req);
+
+    if (frame == NULL) {
+        return -ENOMEM;
+    }
+    desc->retries++;
+    _sched_frame(frame);
+    return 0;
+}
+
+static int _send_window(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(fbuf->pkt->data);
+    size_t payload_len = gnrc_pkt_len(fbuf->pkt->next);
+    uint16_t max_frag_size = _max_frag_size(netif);
+
+    while ((fbuf->sfr.frags_sent < fbuf->sfr.window_size) &&
+           (fbuf->offset < payload_len)) {
+        _frag_desc_t *desc = (_frag_desc_t *)clist_lpop(&_frag_descs_free);
+        gnrc_pktsnip_t *frame;
+        bool ack_req;
+
+        /* pool is dimensioned for all windows to be full */
+        assert(desc != NULL);
+        assert(fbuf->sfr.cur_seq <= SIXLOWPAN_SFR_SEQ_MAX);
+        desc->offset = fbuf->offset;
+        desc->size = _min(max_frag_size, payload_len - fbuf->offset);
+        desc->seq = fbuf->sfr.cur_seq;
+        desc->retries = 0;
+        ack_req = ((fbuf->sfr.frags_sent + 1U) == fbuf->sfr.window_size) ||
+                  ((desc->offset + desc->size) >= payload_len);
+        frame = _build_frag(fbuf, desc->seq, desc->offset, desc->size,
+                            ack_req);
+        if (frame == NULL) {
+            clist_rpush(&_frag_descs_free, &desc->super);
+            return -ENOMEM;
+        }
+        clist_rpush(&fbuf->sfr.window, &desc->super);
+        fbuf->sfr.cur_seq++;
+        fbuf->sfr.frags_sent++;
+        fbuf->offset += desc->size;
+        _sched_frame(frame);
+    }
+    _set_arq_timer(fbuf);
+    return 0;
+}
+
+static void _send_abort_frag(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    gnrc_pktsnip_t *frame = _build_frag(fbuf, 0, 0, 0, false);
+
+    if (frame != NULL) {
+        _sched_frame(frame);
+    }
+}
+
+static void _start_datagram(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    fbuf->offset = 0;
+    fbuf->sfr.cur_seq = 0;
+    fbuf->sfr.frags_sent = 0;
+    fbuf->sfr.window.next = NULL;
+    if (_send_window(fbuf) < 0) {
+        DEBUG("6lo sfr: unable to send fragments\n");
+        _clean_up_fbuf(fbuf, ENOMEM);
+    }
+}
+
+static void _abort(gnrc_sixlowpan_frag_fb_t *fbuf, bool notify)
+{
+    xtimer_remove(&fbuf->sfr.arq_timer);
+    if (notify) {
+        _send_abort_frag(fbuf);
+    }
+    _free_window(fbuf);
+#if GNRC_SIXLOWPAN_SFR_DG_RETRIES > 0
+    if (fbuf->sfr.dg_retries < GNRC_SIXLOWPAN_SFR_DG_RETRIES) {
+        DEBUG("6lo sfr: resending datagram with tag %u from scratch\n",
+              (unsigned)fbuf->tag);
+        fbuf->sfr.dg_retries++;
+        fbuf->tag = gnrc_sixlowpan_frag_fb_next_tag() & UINT8_MAX;
+        _COUNT_STAT(sfr_dg_resends);
+        _start_datagram(fbuf);
+        return;
+    }
+#endif  /* GNRC_SIXLOWPAN_SFR_DG_RETRIES > 0 */
+    DEBUG("6lo sfr: aborting datagram with tag %u\n", (unsigned)fbuf->tag);
+    _COUNT_STAT(sfr_aborts);
+    _clean_up_fbuf(fbuf, ETIMEDOUT);
+}
+
+static inline void _shrink_window(gnrc_sixlowpan_frag_fb_t *fbuf)
+{
+    fbuf->sfr.window_size /= 2;
+    if (fbuf->sfr.window_size < GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE) {
+        fbuf->sfr.window_size = GNRC_SIXLOWPAN_SFR_MIN_WIN_SIZE;
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_send(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page)
+{
+    assert(ctx != NULL);
+    gnrc_sixlowpan_frag_fb_t *fbuf = ctx;
+    gnrc_netif_t *netif;
+    size_t payload_len;
+    uint16_t max_frag_size;
+
+    assert((fbuf->pkt == pkt) || (pkt == NULL));
+    (void)page;
+    (void)pkt;
+    netif = gnrc_netif_hdr_get_netif(fbuf->pkt->data);
+    payload_len = gnrc_pkt_len(fbuf->pkt->next);
+    max_frag_size = _max_frag_size(netif);
+    assert(max_frag_size > 0);
+    if (((payload_len + max_frag_size - 1) / max_frag_size) >
+        (SIXLOWPAN_SFR_SEQ_MAX + 1U)) {
+        DEBUG("6lo sfr: datagram of size %u needs too many fragments\n",
+              (unsigned)payload_len);
+        gnrc_pktbuf_release_error(fbuf->pkt, EMSGSIZE);
+        fbuf->pkt = NULL;
+        return;
+    }
+    /* RFRAG tags are only 8 bits wide */
+    fbuf->tag &= UINT8_MAX;
+    fbuf->sfr.window_size = GNRC_SIXLOWPAN_SFR_OPT_WIN_SIZE;
+    fbuf->sfr.dg_retries = 0;
+    fbuf->sfr.arq_msg.type = GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG;
+    _start_datagram(fbuf);
+}
+
+static void _handle_ack_for_fbuf(gnrc_sixlowpan_frag_fb_t *fbuf,
+                                 sixlowpan_sfr_ack_t *ack)
+{
+    _frag_desc_t *last_lost = NULL;
+    int max_acked = -1;
+    bool lost = false;
+
+    _COUNT_STAT(sfr_acks);
+    if (memcmp(ack->bitmap, _null_bitmap, sizeof(_null_bitmap)) == 0) {
+        DEBUG("6lo sfr: receiver aborted datagram with tag %u\n",
+              (unsigned)fbuf->tag);
+        _abort(fbuf, false);
+        return;
+    }
+    if (memcmp(ack->bitmap, _full_bitmap, sizeof(_full_bitmap)) == 0) {
+        DEBUG("6lo sfr: datagram with tag %u completely acknowledged\n",
+              (unsigned)fbuf->tag);
+        _clean_up_fbuf(fbuf, GNRC_NETERR_SUCCESS);
+        return;
+    }
+    xtimer_remove(&fbuf->sfr.arq_timer);
+    for (unsigned i = 0; i < SIXLOWPAN_SFR_ACK_BITMAP_SIZE; i++) {
+        if (bf_isset(ack->bitmap, i)) {
+            max_acked = i;
+        }
+    }
+    /* remove acknowledged fragments from window */
+    for (unsigned i = fbuf->sfr.frags_sent; i > 0; i--) {
+        _frag_desc_t *desc = (_frag_desc_t *)clist_lpop(&fbuf->sfr.window);
+
+        if (bf_isset(ack->bitmap, desc->seq)) {
+            clist_rpush(&_frag_descs_free, &desc->super);
+            fbuf->sfr.frags_sent--;
+        }
+        else {
+            clist_rpush(&fbuf->sfr.window, &desc->super);
+            /* fragments sent after the last one acknowledged may just not
+             * have arrived yet */
+            lost |= (desc->seq < max_acked);
+        }
+    }
+    if (lost || (GNRC_SIXLOWPAN_SFR_USE_ECN &&
+                 sixlowpan_sfr_ecn(&ack->base))) {
+        _shrink_window(fbuf);
+    }
+    else if ((fbuf->sfr.frags_sent == 0) &&
+             (fbuf->sfr.window_size < GNRC_SIXLOWPAN_SFR_MAX_WIN_SIZE)) {
+        fbuf->sfr.window_size++;
+    }
+    if (lost) {
+        clist_node_t *node = fbuf->sfr.window.next;
+
+        /* window is sorted by sequence number, so the last lost fragment
+         * requests the acknowledgment */
+        do {
+            node = node->next;
+            if (((_frag_desc_t *)node)->seq < max_acked) {
+                last_lost = (_frag_desc_t *)node;
+            }
+        } while (node != fbuf->sfr.window.next);
+        do {
+            _frag_desc_t *desc;
+
+            node = node->next;
+            desc = (_frag_desc_t *)node;
+            if (desc->seq >= max_acked) {
+                continue;
+            }
+            if (desc->retries >= GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
+                _abort(fbuf, true);
+                return;
+            }
+            if (_resend_frag(fbuf, desc, desc == last_lost) < 0) {
+                _clean_up_fbuf(fbuf, ENOMEM);
+                return;
+            }
+            _COUNT_STAT(sfr_resends_nack);
+        } while (node != fbuf->sfr.window.next);
+        _set_arq_timer(fbuf);
+    }
+    else if ((fbuf->sfr.frags_sent == 0) &&
+             (fbuf->offset >= gnrc_pkt_len(fbuf->pkt->next))) {
+        /* everything was acknowledged, though not with a full bitmap */
+        _clean_up_fbuf(fbuf, GNRC_NETERR_SUCCESS);
+    }
+    else if (_send_window(fbuf) < 0) {
+        _clean_up_fbuf(fbuf, ENOMEM);
+    }
+}
+
+void gnrc_sixlowpan_frag_sfr_arq_timeout(uint16_t tag)
+{
+    gnrc_sixlowpan_frag_fb_t *fbuf = gnrc_sixlowpan_frag_fb_get_by_tag(tag);
+    _frag_desc_t *last;
+
+    if ((fbuf == NULL) ||
+        ((last = (_frag_desc_t *)clist_rpeek(&fbuf->sfr.window)) == NULL)) {
+        DEBUG("6lo sfr: stale ARQ timeout\n");
+        return;
+    }
+    if (last->retries >= GNRC_SIXLOWPAN_SFR_FRAG_RETRIES) {
+        _abort(fbuf, true);
+        return;
+    }
+    _shrink_window(fbuf);
+    if (_resend_frag(fbuf, last, true) < 0) {
+        _clean_up_fbuf(fbuf, ENOMEM);
+        return;
+    }
+    _COUNT_STAT(sfr_resends_timeout);
+    _set_arq_timer(fbuf);
+}
+
+/* ========================== receiver side ================================= */
+
+static void _send_ack(gnrc_netif_t *netif, const uint8_t *dst, size_t dst_len,
+                      uint8_t tag, const uint8_t *bitmap, bool ecn)
+{
+    gnrc_pktsnip_t *netif_snip, *ack_snip;
+    sixlowpan_sfr_ack_t *ack;
+
+    netif_snip = gnrc_netif_hdr_build(NULL, 0, dst, dst_len);
+    if (netif_snip == NULL) {
+        DEBUG("6lo sfr: unable to allocate link-layer header for ACK\n");
+        return;
+    }
+    gnrc_netif_hdr_set_netif(netif_snip->data, netif);
+    ack_snip = gnrc_pktbuf_add(NULL, NULL, sizeof(sixlowpan_sfr_ack_t),
+                               GNRC_NETTYPE_SIXLOWPAN);
+    if (ack_snip == NULL) {
+        DEBUG("6lo sfr: unable to allocate ACK\n");
+        gnrc_pktbuf_release(netif_snip);
+        return;
+    }
+    ack = ack_snip->data;
+    ack->base.disp_ecn = 0;
+    sixlowpan_sfr_ack_set_disp(&ack->base);
+    if (ecn) {
+        sixlowpan_sfr_set_ecn(&ack->base);
+    }
+    ack->base.tag = tag;
+    if (bitmap == NULL) {
+        memset(ack->bitmap, 0, sizeof(ack->bitmap));
+    }
+    else {
+        memcpy(ack->bitmap, bitmap, sizeof(ack->bitmap));
+    }
+    DEBUG("6lo sfr: send ACK for tag %u to %s (bitmap: %02x%02x%02x%02x)\n",
+          (unsigned)tag, gnrc_netif_addr_to_str(dst, dst_len, addr_str),
+          ack->bitmap[0], ack->bitmap[1], ack->bitmap[2], ack->bitmap[3]);
+    gnrc_sixlowpan_dispatch_send(gnrc_pkt_prepend(ack_snip, netif_snip),
+                                 NULL, 0);
+}
+
+static inline void _send_ack_back(const gnrc_netif_hdr_t *netif_hdr,
+                                  uint8_t tag, const uint8_t *bitmap,
+                                  bool ecn)
+{
+    _send_ack(gnrc_netif_hdr_get_netif(netif_hdr),
+              gnrc_netif_hdr_get_src_addr(netif_hdr),
+              netif_hdr->src_l2addr_len, tag, bitmap, ecn);
+}
+
+static void _add_to_rb(gnrc_pktsnip_t *netif_snip, gnrc_pktsnip_t *pkt,
+                       unsigned page)
+{
+    gnrc_netif_hdr_t *netif_hdr = netif_snip->data;
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    gnrc_sixlowpan_frag_rb_t *rbe;
+    uint8_t tag = rfrag->base.tag;
+    uint8_t seq = sixlowpan_sfr_rfrag_get_seq(rfrag);
+    bool ack_req = sixlowpan_sfr_rfrag_ack_req(rfrag);
+    bool ecn = sixlowpan_sfr_ecn(&rfrag->base);
+
+    /* keep link-layer header for acknowledgment, pkt is released or taken
+     * over by the reassembly buffer */
+    gnrc_pktbuf_hold(netif_snip, 1);
+    /* the first fragment carries the datagram size in its offset field */
+    rbe = gnrc_sixlowpan_frag_rb_add(netif_hdr, pkt,
+                                     (seq == 0)
+                                     ? 0
+                                     : sixlowpan_sfr_rfrag_get_offset(rfrag),
+                                     page);
+    if (rbe == NULL) {
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+        if (gnrc_sixlowpan_frag_vrb_get(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                        netif_hdr->src_l2addr_len,
+                                        tag) != NULL) {
+            /* datagram is forwarded */
+            gnrc_pktbuf_release(netif_snip);
+            return;
+        }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+        if (ack_req) {
+            /* an entry only still exists if the datagram was completed
+             * recently, otherwise the datagram was dropped */
+            _send_ack_back(netif_hdr, tag,
+                           gnrc_sixlowpan_frag_rb_exists(netif_hdr, tag)
+                           ? _full_bitmap : NULL, ecn);
+        }
+    }
+    else {
+        uint8_t bitmap[SIXLOWPAN_SFR_ACK_BITMAP_SIZE / 8];
+        int res;
+
+        bf_set(rbe->super.received, seq);
+        memcpy(bitmap, rbe->super.received, sizeof(bitmap));
+        res = gnrc_sixlowpan_frag_rb_dispatch_when_complete(rbe, netif_hdr);
+        if (res > 0) {
+            _send_ack_back(netif_hdr, tag, _full_bitmap, ecn);
+        }
+        else if (res < 0) {
+            _send_ack_back(netif_hdr, tag, NULL, ecn);
+        }
+        else if (ack_req) {
+            _send_ack_back(netif_hdr, tag, bitmap, ecn);
+        }
+    }
+    gnrc_pktbuf_release(netif_snip);
+}
+
+static void _handle_abort(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
+                          unsigned page)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    uint8_t tag = rfrag->base.tag;
+
+    DEBUG("6lo sfr: received abort for tag %u\n", (unsigned)tag);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(
+            gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
+            tag
+        );
+
+    if (vrbe != NULL) {
+        gnrc_sixlowpan_frag_sfr_forward(NULL, rfrag, vrbe, page);
+        gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+#else   /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    (void)page;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    gnrc_sixlowpan_frag_rb_rm_by_datagram(netif_hdr, tag);
+    if (sixlowpan_sfr_rfrag_ack_req(rfrag)) {
+        _send_ack_back(netif_hdr, tag, NULL, sixlowpan_sfr_ecn(&rfrag->base));
+    }
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _handle_rfrag(gnrc_pktsnip_t *netif_snip, gnrc_pktsnip_t *pkt,
+                          unsigned page)
+{
+    gnrc_netif_hdr_t *netif_hdr = netif_snip->data;
+    sixlowpan_sfr_rfrag_t *rfrag = pkt->data;
+    uint16_t frag_size = sixlowpan_sfr_rfrag_get_frag_size(rfrag);
+
+    if (frag_size != (pkt->size - sizeof(sixlowpan_sfr_rfrag_t))) {
+        DEBUG("6lo sfr: fragment size %u does not match received size %u\n",
+              (unsigned)frag_size,
+              (unsigned)(pkt->size - sizeof(sixlowpan_sfr_rfrag_t)));
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if ((frag_size == 0) && (sixlowpan_sfr_rfrag_get_offset(rfrag) == 0)) {
+        _handle_abort(netif_hdr, pkt, page);
+        return;
+    }
+    if (sixlowpan_sfr_rfrag_get_seq(rfrag) == 0) {
+        _add_to_rb(netif_snip, pkt, page);
+        return;
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_get(
+            gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
+            rfrag->base.tag
+        );
+
+    if (vrbe != NULL) {
+        gnrc_pktsnip_t *hdr = gnrc_pktbuf_mark(pkt,
+                                               sizeof(sixlowpan_sfr_rfrag_t),
+                                               GNRC_NETTYPE_SIXLOWPAN);
+
+        if (hdr == NULL) {
+            DEBUG("6lo sfr: unable to mark RFRAG header\n");
+            gnrc_pktbuf_release(pkt);
+            return;
+        }
+        /* detach payload from headers */
+        pkt->next = NULL;
+        gnrc_sixlowpan_frag_sfr_forward(pkt, hdr->data, vrbe, page);
+        gnrc_pktbuf_release(hdr);
+        return;
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    if (!gnrc_sixlowpan_frag_rb_exists(netif_hdr, rfrag->base.tag)) {
+        DEBUG("6lo sfr: no reassembly state for fragment with tag %u\n",
+              (unsigned)rfrag->base.tag);
+        if (sixlowpan_sfr_rfrag_ack_req(rfrag)) {
+            _send_ack_back(netif_hdr, rfrag->base.tag, NULL,
+                           sixlowpan_sfr_ecn(&rfrag->base));
+        }
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    _add_to_rb(netif_snip, pkt, page);
+}
+
+static void _handle_ack(gnrc_netif_hdr_t *netif_hdr,
+                        sixlowpan_sfr_ack_t *ack)
+{
+    gnrc_sixlowpan_frag_fb_t *fbuf;
+
+    DEBUG("6lo sfr: received ACK for tag %u from %s\n", (unsigned)ack->base.tag,
+          gnrc_netif_addr_to_str(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                                 netif_hdr->src_l2addr_len, addr_str));
+    fbuf = gnrc_sixlowpan_frag_fb_get_by_tag(ack->base.tag);
+    if ((fbuf != NULL) && (fbuf->pkt != NULL) &&
+        (clist_lpeek(&fbuf->sfr.window) != NULL)) {
+        gnrc_netif_hdr_t *fbuf_hdr = fbuf->pkt->data;
+
+        if ((fbuf_hdr->dst_l2addr_len == netif_hdr->src_l2addr_len) &&
+            (memcmp(gnrc_netif_hdr_get_dst_addr(fbuf_hdr),
+                    gnrc_netif_hdr_get_src_addr(netif_hdr),
+                    netif_hdr->src_l2addr_len) == 0)) {
+            _handle_ack_for_fbuf(fbuf, ack);
+            return;
+        }
+    }
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_netif_t *netif = gnrc_netif_hdr_get_netif(netif_hdr);
+    gnrc_sixlowpan_frag_vrb_t *vrbe = gnrc_sixlowpan_frag_vrb_reverse(
+            netif, gnrc_netif_hdr_get_src_addr(netif_hdr),
+            netif_hdr->src_l2addr_len, ack->base.tag
+        );
+
+    if (vrbe != NULL) {
+        /* relay acknowledgment towards the original sender */
+        _send_ack(netif, vrbe->super.src, vrbe->super.src_len,
+                  vrbe->super.tag, ack->bitmap, sixlowpan_sfr_ecn(&ack->base));
+        if ((memcmp(ack->bitmap, _null_bitmap, sizeof(_null_bitmap)) == 0) ||
+            (memcmp(ack->bitmap, _full_bitmap, sizeof(_full_bitmap)) == 0)) {
+            gnrc_sixlowpan_frag_vrb_rm(vrbe);
+        }
+        else {
+            vrbe->super.arrival = xtimer_now_usec();
+        }
+        return;
+    }
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    DEBUG("6lo sfr: no datagram for ACK found\n");
+}
+
+void gnrc_sixlowpan_frag_sfr_recv(gnrc_pktsnip_t *pkt, void *ctx,
+                                  unsigned page)
+{
+    gnrc_pktsnip_t *netif_snip = gnrc_pktsnip_search_type(pkt,
+                                                          GNRC_NETTYPE_NETIF);
+    sixlowpan_sfr_t *hdr = pkt->data;
+
+    (void)ctx;
+    if (netif_snip == NULL) {
+        DEBUG("6lo sfr: no link-layer header found\n");
+        gnrc_pktbuf_release(pkt);
+        return;
+    }
+    if (sixlowpan_sfr_rfrag_is(hdr) &&
+        (pkt->size >= sizeof(sixlowpan_sfr_rfrag_t))) {
+        _handle_rfrag(netif_snip, pkt, page);
+    }
+    else if (sixlowpan_sfr_ack_is(hdr) &&
+             (pkt->size >= sizeof(sixlowpan_sfr_ack_t))) {
+        _handle_ack(netif_snip->data, pkt->data);
+        gnrc_pktbuf_release(pkt);
+    }
+    else {
+        DEBUG("6lo sfr: invalid selective fragment recovery header\n");
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+/* ========================== forwarding ==================================== */
+
+int gnrc_sixlowpan_frag_sfr_forward(gnrc_pktsnip_t *pkt,
+                                    const sixlowpan_sfr_rfrag_t *rfrag,
+                                    gnrc_sixlowpan_frag_vrb_t *vrbe,
+                                    unsigned page)
+{
+    gnrc_pktsnip_t *netif, *frag;
+    sixlowpan_sfr_rfrag_t *hdr;
+
+    assert(rfrag != NULL);
+    assert(vrbe != NULL);
+    (void)page;
+    netif = gnrc_netif_hdr_build(NULL, 0, vrbe->super.dst,
+                                 vrbe->super.dst_len);
+    if (netif == NULL) {
+        DEBUG("6lo sfr: unable to allocate link-layer header for forwarding\n");
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    gnrc_netif_hdr_set_netif(netif->data, vrbe->out_netif);
+    frag = gnrc_pktbuf_add(pkt, rfrag, sizeof(sixlowpan_sfr_rfrag_t),
+                           GNRC_NETTYPE_SIXLOWPAN);
+    if (frag == NULL) {
+        DEBUG("6lo sfr: unable to allocate RFRAG header for forwarding\n");
+        gnrc_pktbuf_release(netif);
+        gnrc_pktbuf_release(pkt);
+        return -ENOMEM;
+    }
+    hdr = frag->data;
+    hdr->base.tag = (uint8_t)vrbe->out_tag;
+    /* the first fragment may have been recompressed */
+    sixlowpan_sfr_rfrag_set_frag_size(hdr, gnrc_pkt_len(pkt));
+    DEBUG("6lo sfr: forward fragment (seq: %u) with tag %u to %s\n",
+          (unsigned)sixlowpan_sfr_rfrag_get_seq(hdr), (unsigned)hdr->base.tag,
+          gnrc_netif_addr_to_str(vrbe->super.dst, vrbe->super.dst_len,
+                                 addr_str));
+    vrbe->super.arrival = xtimer_now_usec();
+    _sched_frame(gnrc_pkt_prepend(frag, netif));
+    return 0;
+}
+
+/* ========================== frame scheduling ============================== */
+
+static void _sched_frame(gnrc_pktsnip_t *frame)
+{
+#if GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0
+    uint32_t now = xtimer_now_usec();
+    uint32_t since_last = now - _last_frame_sent;
+
+    if ((_frame_queue_len == 0) &&
+        (since_last >= GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US)) {
+        _last_frame_sent = now;
+        gnrc_sixlowpan_dispatch_send(frame, NULL, 0);
+        return;
+    }
+    if (_frame_queue_len < SFR_FRAME_QUEUE_SIZE) {
+        _frame_queue[(_frame_queue_head + _frame_queue_len) %
+                     SFR_FRAME_QUEUE_SIZE] = frame;
+        if (_frame_queue_len++ == 0) {
+            xtimer_set_msg(&_if_gap_timer,
+                           GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US - since_last,
+                           &_if_gap_msg, gnrc_sixlowpan_get_pid());
+        }
+        return;
+    }
+    DEBUG("6lo sfr: frame queue full, sending without inter-frame gap\n");
+#endif  /* GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0 */
+    gnrc_sixlowpan_dispatch_send(frame, NULL, 0);
+}
+
+void gnrc_sixlowpan_frag_sfr_inter_frame_gap(void)
+{
+#if GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0
+    gnrc_pktsnip_t *frame;
+
+    if (_frame_queue_len == 0) {
+        return;
+    }
+    frame = _frame_queue[_frame_queue_head];
+    _frame_queue_head = (_frame_queue_head + 1) % SFR_FRAME_QUEUE_SIZE;
+    _frame_queue_len--;
+    _last_frame_sent = xtimer_now_usec();
+    gnrc_sixlowpan_dispatch_send(frame, NULL, 0);
+    if (_frame_queue_len > 0) {
+        xtimer_set_msg(&_if_gap_timer, GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US,
+                       &_if_gap_msg, gnrc_sixlowpan_get_pid());
+    }
+#endif  /* GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0 */
+}
+
+void gnrc_sixlowpan_frag_sfr_init(void)
+{
+    _frag_descs_free.next = NULL;
+    for (unsigned i = 0; i < SFR_FRAG_DESCS_NUMOF; i++) {
+        clist_rpush(&_frag_descs_free, &_frag_descs[i].super);
+    }
+#if GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0
+    _frame_queue_head = 0;
+    _frame_queue_len = 0;
+    _last_frame_sent = xtimer_now_usec() - GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US;
+#endif  /* GNRC_SIXLOWPAN_SFR_INTER_FRAME_GAP_US > 0 */
+}
+
+void gnrc_sixlowpan_frag_sfr_netif_enable(gnrc_netif_t *netif, bool enable)
+{
+    gnrc_netif_acquire(netif);
+    if (enable) {
+        netif->sixlo.local_flags |= GNRC_NETIF_6LO_LOCAL_FLAGS_SFR;
+    }
+    else {
+        netif->sixlo.local_flags &= ~GNRC_NETIF_6LO_LOCAL_FLAGS_SFR;
+    }
+    gnrc_netif_release(netif);
+}
+
+/** @} */
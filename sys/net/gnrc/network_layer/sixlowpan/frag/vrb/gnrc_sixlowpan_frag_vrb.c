@@ -68,6 +68,10 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                 vrbe->out_netif = out_netif;
                 memcpy(vrbe->super.dst, out_dst, out_dst_len);
                 vrbe->out_tag = gnrc_sixlowpan_frag_fb_next_tag();
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+                /* recoverable fragments only have 8-bit tags */
+                vrbe->out_tag &= UINT8_MAX;
+#endif
                 vrbe->super.dst_len = out_dst_len;
                 DEBUG("6lo vrb: creating entry (%s, ",
                       gnrc_netif_addr_to_str(vrbe->super.src,
@@ -83,32 +87,6 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_add(
                                              vrbe->super.dst_len,
                                              addr_str), vrbe->out_tag);
             }
-            /* _equal_index() => append intervals of `base`, so they don't get
-             * lost. We use append, so we don't need to change base! */
-            else if (base->ints != NULL) {
-                gnrc_sixlowpan_frag_rb_int_t *tmp = vrbe->super.ints;
-
-                if (tmp != base->ints) {
-                    /* base->ints is not already vrbe->super.ints */
-                    if (tmp != NULL) {
-                        /* iterate before appending and check if `base->ints` is
-                         * not already part of list */
-                        while (tmp->next != NULL) {
-                            if (tmp == base->ints) {
-                                tmp = NULL;
-                                break;
-                            }
-                            tmp = tmp->next;
-                        }
-                        if (tmp != NULL) {
-                            tmp->next = base->ints;
-                        }
-                    }
-                    else {
-                        vrbe->super.ints = base->ints;
-                    }
-                }
-            }
             break;
         }
     }
@@ -184,6 +162,33 @@ gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_get(
     return NULL;
 }
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+gnrc_sixlowpan_frag_vrb_t *gnrc_sixlowpan_frag_vrb_reverse(
+        const gnrc_netif_t *netif, const uint8_t *src, size_t src_len,
+        unsigned tag)
+{
+    DEBUG("6lo vrb: trying to get entry for reverse label (%s, %u)\n",
+          gnrc_netif_addr_to_str(src, src_len, addr_str), tag);
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_VRB_SIZE; i++) {
+        gnrc_sixlowpan_frag_vrb_t *vrbe = &_vrb[i];
+
+        if (!gnrc_sixlowpan_frag_vrb_entry_empty(vrbe) &&
+            (vrbe->out_tag == tag) &&
+            ((netif == NULL) || (vrbe->out_netif == netif)) &&
+            (vrbe->super.dst_len == src_len) &&
+            (memcmp(vrbe->super.dst, src, src_len) == 0)) {
+            DEBUG("6lo vrb: got VRB entry from (%s, %u)\n",
+                  gnrc_netif_addr_to_str(vrbe->super.src,
+                                         vrbe->super.src_len,
+                                         addr_str), vrbe->super.tag);
+            return vrbe;
+        }
+    }
+    DEBUG("6lo vrb: no entry found\n");
+    return NULL;
+}
+#endif
+
 void gnrc_sixlowpan_frag_vrb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
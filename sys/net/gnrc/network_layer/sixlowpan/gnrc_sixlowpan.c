@@ -23,6 +23,9 @@
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#endif
 #include "net/gnrc/sixlowpan/iphc.h"
 #include "net/gnrc/netif.h"
 #include "net/sixlowpan.h"
@@ -141,6 +144,12 @@ void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
         fbuf->hint.fragsz = 0;
 #endif
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+        if (gnrc_sixlowpan_frag_sfr_netif(netif)) {
+            gnrc_sixlowpan_frag_sfr_send(pkt, fbuf, page);
+            return;
+        }
+#endif
         gnrc_sixlowpan_frag_send(pkt, fbuf, page);
     }
 #endif
@@ -221,6 +230,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
         return;
     }
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    else if (sixlowpan_sfr_is((sixlowpan_sfr_t *)dispatch)) {
+        DEBUG("6lo: received 6LoWPAN recoverable fragment\n");
+        gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, 0);
+        return;
+    }
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC
     else if (sixlowpan_iphc_is(dispatch)) {
         DEBUG("6lo: received 6LoWPAN IPHC compressed datagram\n");
@@ -323,6 +339,10 @@ static void *_event_loop(void *args)
     /* preinitialize ACK */
     reply.type = GNRC_NETAPI_MSG_TYPE_ACK;
 
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    gnrc_sixlowpan_frag_sfr_init();
+#endif
+
     /* start event loop */
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
@@ -362,6 +382,16 @@ static void *_event_loop(void *args)
                 gnrc_sixlowpan_frag_rb_gc();
                 break;
 #endif
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+            case GNRC_SIXLOWPAN_FRAG_SFR_ARQ_TIMEOUT_MSG:
+                DEBUG("6lo: ARQ timeout event received\n");
+                gnrc_sixlowpan_frag_sfr_arq_timeout(msg.content.value);
+                break;
+            case GNRC_SIXLOWPAN_FRAG_SFR_INTER_FRAME_GAP_MSG:
+                DEBUG("6lo: inter-frame gap event received\n");
+                gnrc_sixlowpan_frag_sfr_inter_frame_gap();
+                break;
+#endif
 
             default:
                 DEBUG("6lo: operation not supported\n");
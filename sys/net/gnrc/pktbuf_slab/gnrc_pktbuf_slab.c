@@ -0,0 +1,482 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf_slab
+ * @{
+ *
+ * @file
+ * @author  agent <agent@local>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _ALIGNMENT_MASK     (sizeof(uintptr_t) - 1)
+#define _ALIGN(size)        (((size) + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK))
+#define _WORDS(size, numof) ((_ALIGN(size) / sizeof(uintptr_t)) * (numof))
+
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _LARGE_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+#ifdef MODULE_NETDEV_ETH
+static_assert(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE >= ETHERNET_FRAME_LEN,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE can't hold an Ethernet frame");
+#endif
+
+typedef struct _unused {
+    struct _unused *next;
+} _unused_t;
+
+typedef struct {
+    uint8_t *start;             /**< first block */
+    _unused_t *first_unused;    /**< free list */
+    uint16_t size;              /**< block size */
+    uint16_t numof;             /**< number of blocks */
+    uint16_t used;              /**< number of blocks in use */
+    uint16_t max_used;          /**< high-water mark of used */
+    uint16_t failed;            /**< failed allocations */
+} _class_t;
+
+static mutex_t _mutex = MUTEX_INIT;
+/* The pools need to be aligned to word size, so that the blocks can be casted
+ * to `_unused_t *` safely. */
+static uintptr_t _snip_pool[_WORDS(_SNIP_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF)];
+static uintptr_t _small_pool[_WORDS(_SMALL_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF)];
+static uintptr_t _large_pool[_WORDS(_LARGE_SIZE, CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF)];
+
+static _class_t _classes[GNRC_PKTBUF_SLAB_NUMOF] = {
+    [GNRC_PKTBUF_SLAB_SNIP] = {
+        .start = (uint8_t *)_snip_pool,
+        .size = _SNIP_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF,
+    },
+    [GNRC_PKTBUF_SLAB_SMALL] = {
+        .start = (uint8_t *)_small_pool,
+        .size = _SMALL_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+    },
+    [GNRC_PKTBUF_SLAB_LARGE] = {
+        .start = (uint8_t *)_large_pool,
+        .size = _LARGE_SIZE,
+        .numof = CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF,
+    },
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(gnrc_pktbuf_slab_class_t min, size_t size);
+static void _pktbuf_free(void *data);
+
+static inline bool _class_contains(const _class_t *cls, const void *ptr)
+{
+    return (size_t)((const uint8_t *)ptr - cls->start) <
+           ((size_t)cls->size * cls->numof);
+}
+
+static _class_t *_class_of(const void *ptr)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (_class_contains(&_classes[i], ptr)) {
+            return &_classes[i];
+        }
+    }
+    return NULL;
+}
+
+/* returns the start of the block ptr points into */
+static inline uint8_t *_block_of(const _class_t *cls, const void *ptr)
+{
+    size_t offset = (const uint8_t *)ptr - cls->start;
+
+    return cls->start + (offset - (offset % cls->size));
+}
+
+/* number of bytes usable from ptr to the end of its block */
+static size_t _capacity(const void *ptr)
+{
+    const _class_t *cls = _class_of(ptr);
+
+    if (cls == NULL) {
+        return 0;
+    }
+    return (_block_of(cls, ptr) + cls->size) - (const uint8_t *)ptr;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        _class_t *cls = &_classes[i];
+
+        cls->first_unused = NULL;
+        /* build free list back to front so blocks are handed out in address
+         * order */
+        for (unsigned j = cls->numof; j > 0; j--) {
+            /* blocks are word aligned, so cast via uintptr_t to silence
+             * -Wcast-align */
+            _unused_t *block = (_unused_t *)(uintptr_t)
+                               (cls->start + ((j - 1) * cls->size));
+            block->next = cls->first_unused;
+            cls->first_unused = block;
+        }
+        cls->used = 0;
+        cls->max_used = 0;
+        cls->failed = 0;
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, (unsigned)_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(GNRC_PKTBUF_SLAB_SNIP, sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->size == size) {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    else {
+        /* both parts would share one block, so move the smaller part to a
+         * block of its own */
+        size_t rest = pkt->size - size;
+        void *new_data = _pktbuf_alloc(GNRC_PKTBUF_SLAB_SMALL,
+                                       (size < rest) ? size : rest);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            _pktbuf_free(marked_snip);
+            mutex_unlock(&_mutex);
+            return NULL;
+        }
+        if (size < rest) {
+            memcpy(new_data, pkt->data, size);
+            new_data_marked = new_data;
+            pkt->data = ((uint8_t *)pkt->data) + size;
+        }
+        else {
+            memcpy(new_data, ((uint8_t *)pkt->data) + size, rest);
+            new_data_marked = pkt->data;
+            pkt->data = new_data;
+        }
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _class_of(pkt->data)));
+    if (size == 0) {
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* new size does not fit into the block of the data */
+    else if (size > _capacity(pkt->data)) {
+        void *new_data = _pktbuf_alloc(GNRC_PKTBUF_SLAB_SMALL, size);
+
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {
+            memcpy(new_data, pkt->data, pkt->size);
+        }
+        _pktbuf_free(pkt->data);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_class_of(pkt) != NULL);
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_slab_get_stats(gnrc_pktbuf_slab_class_t cls,
+                                gnrc_pktbuf_slab_stats_t *stats)
+{
+    assert(cls < GNRC_PKTBUF_SLAB_NUMOF);
+    mutex_lock(&_mutex);
+    stats->size = _classes[cls].size;
+    stats->numof = _classes[cls].numof;
+    stats->used = _classes[cls].used;
+    stats->max_used = _classes[cls].max_used;
+    stats->failed = _classes[cls].failed;
+    mutex_unlock(&_mutex);
+}
+
+void gnrc_pktbuf_slab_reset_stats(void)
+{
+    mutex_lock(&_mutex);
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        _classes[i].max_used = _classes[i].used;
+        _classes[i].failed = 0;
+    }
+    mutex_unlock(&_mutex);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    static const char *names[] = { "snip", "small", "large" };
+
+    printf("packet buffer: %u bytes in %u size classes\n",
+           (unsigned)(sizeof(_snip_pool) + sizeof(_small_pool) + sizeof(_large_pool)),
+           (unsigned)GNRC_PKTBUF_SLAB_NUMOF);
+    puts("  class  size  numof  used  max used  failed");
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        gnrc_pktbuf_slab_stats_t stats;
+
+        gnrc_pktbuf_slab_get_stats(i, &stats);
+        printf("  %-5s  %4u  %5u  %4u  %8u  %6u\n", names[i],
+               stats.size, stats.numof, stats.used, stats.max_used,
+               stats.failed);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (_classes[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall ptr in free list of cls: ptr is the start of a block of cls
+     *  - forall cls: length of free list of cls == cls->numof - cls->used
+     *  - forall cls: cls->used <= cls->max_used <= cls->numof
+     */
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        const _class_t *cls = &_classes[i];
+        unsigned unused = 0;
+
+        for (_unused_t *ptr = cls->first_unused; ptr; ptr = ptr->next) {
+            if (!_class_contains(cls, ptr) ||
+                (_block_of(cls, ptr) != (uint8_t *)ptr) ||
+                (++unused > cls->numof)) {
+                return false;
+            }
+        }
+        if ((unused != (unsigned)(cls->numof - cls->used)) ||
+            (cls->used > cls->max_used) || (cls->max_used > cls->numof)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(GNRC_PKTBUF_SLAB_SNIP, sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(GNRC_PKTBUF_SLAB_SMALL, size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+/* snip descriptors are allocated from GNRC_PKTBUF_SLAB_SNIP, data from
+ * GNRC_PKTBUF_SLAB_SMALL upwards so small headers can not starve the
+ * descriptors */
+static void *_pktbuf_alloc(gnrc_pktbuf_slab_class_t min, size_t size)
+{
+    unsigned i = GNRC_PKTBUF_SLAB_NUMOF;
+
+    /* find smallest fitting class */
+    for (unsigned j = min; j < GNRC_PKTBUF_SLAB_NUMOF; j++) {
+        if (size <= _classes[j].size) {
+            i = j;
+            break;
+        }
+    }
+    if (i == GNRC_PKTBUF_SLAB_NUMOF) {
+        DEBUG("pktbuf: %u bytes exceed largest size class\n", (unsigned)size);
+        return NULL;
+    }
+    /* fall back to larger classes if the fitting one is exhausted */
+    for (unsigned j = i; j < GNRC_PKTBUF_SLAB_NUMOF; j++) {
+        _class_t *cls = &_classes[j];
+        _unused_t *block = cls->first_unused;
+
+        if (block != NULL) {
+            cls->first_unused = block->next;
+            if (++cls->used > cls->max_used) {
+                cls->max_used = cls->used;
+            }
+            return block;
+        }
+    }
+    DEBUG("pktbuf: no space left in packet buffer\n");
+    _classes[i].failed++;
+    return NULL;
+}
+
+static void _pktbuf_free(void *data)
+{
+    _class_t *cls = _class_of(data);
+    _unused_t *block;
+
+    if (cls == NULL) {
+        return;
+    }
+    /* data might point into the block, e.g. after gnrc_pktbuf_mark() */
+    block = (_unused_t *)(uintptr_t)_block_of(cls, data);
+    assert(cls->used > 0);
+    block->next = cls->first_unused;
+    cls->first_unused = block;
+    cls->used--;
+}
+
+/** @} */
@@ -70,6 +70,18 @@ static inline size_t _align(size_t size)
     return (size + _ALIGNMENT_MASK) & ~(_ALIGNMENT_MASK);
 }
 
+/* aligns ptr up to the next chunk boundary within the buffer */
+static inline uint8_t *_align_ptr(void *ptr)
+{
+    return &_pktbuf[_align((uint8_t *)ptr - _pktbuf)];
+}
+
+/* aligns ptr down to the chunk boundary within the buffer */
+static inline uint8_t *_align_ptr_down(void *ptr)
+{
+    return &_pktbuf[((uint8_t *)ptr - _pktbuf) & ~(_ALIGNMENT_MASK)];
+}
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -111,8 +123,6 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
-    /* size required for chunk */
-    size_t required_new_size = _align(size);
     void *new_data_marked;
 
     mutex_lock(&_mutex);
@@ -131,36 +141,48 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&_mutex);
         return NULL;
     }
-    /* marked data would not fit _unused_t marker => move data around to allow
-     * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
-        void *new_data_rest;
-        new_data_marked = _pktbuf_alloc(size);
-        if (new_data_marked == NULL) {
+    new_data_marked = pkt->data;
+    if (pkt->size == size) {
+        pkt->data = NULL;
+    }
+    /* split point is not at a chunk boundary: both parts can not be freed
+     * independently, so move the smaller part to a chunk of its own */
+    else if ((uint8_t *)pkt->data + size != _align_ptr((uint8_t *)pkt->data + size)) {
+        uint8_t *split = (uint8_t *)pkt->data + size;
+        size_t rest = pkt->size - size;
+        void *new_data = _pktbuf_alloc((size < rest) ? size : rest);
+
+        if (new_data == NULL) {
             DEBUG("pktbuf: could not reallocate marked section.\n");
             _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
             mutex_unlock(&_mutex);
             return NULL;
         }
-        new_data_rest = _pktbuf_alloc(pkt->size - size);
-        if (new_data_rest == NULL) {
-            DEBUG("pktbuf: could not reallocate remaining section.\n");
-            _pktbuf_free(marked_snip, sizeof(gnrc_pktsnip_t));
-            _pktbuf_free(new_data_marked, size);
-            mutex_unlock(&_mutex);
-            return NULL;
+        if (size < rest) {
+            uint8_t *start = _align_ptr_down(pkt->data);
+
+            memcpy(new_data, pkt->data, size);
+            new_data_marked = new_data;
+            pkt->data = split;
+            /* release the chunks before the split point, the remaining
+             * bytes up to split belong to the rest */
+            if (_align_ptr_down(split) > start) {
+                _pktbuf_free(start, _align_ptr_down(split) - start);
+            }
+        }
+        else {
+            uint8_t *end = (uint8_t *)pkt->data + pkt->size;
+
+            memcpy(new_data, split, rest);
+            pkt->data = new_data;
+            /* release the chunks after the split point */
+            if (_align_ptr(end) > _align_ptr(split)) {
+                _pktbuf_free(_align_ptr(split), _align_ptr(end) - _align_ptr(split));
+            }
         }
-        memcpy(new_data_marked, pkt->data, size);
-        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
-        _pktbuf_free(pkt->data, pkt->size);
-        marked_snip->data = new_data_marked;
-        pkt->data = new_data_rest;
     }
     else {
-        new_data_marked = pkt->data;
-        /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
-        pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
-                                          NULL;
+        pkt->data = (uint8_t *)pkt->data + size;
     }
     pkt->size -= size;
     _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
@@ -171,8 +193,6 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
 
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = _align(size);
-
     mutex_lock(&_mutex);
     assert(pkt != NULL);
     assert(((pkt->size == 0) && (pkt->data == NULL)) ||
@@ -203,9 +223,13 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         _pktbuf_free(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        _pktbuf_free(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else {
+        uint8_t *new_end = _align_ptr((uint8_t *)pkt->data + size);
+        uint8_t *old_end = _align_ptr((uint8_t *)pkt->data + pkt->size);
+
+        if (old_end > new_end) {
+            _pktbuf_free(new_end, old_end - new_end);
+        }
     }
     pkt->size = size;
     mutex_unlock(&_mutex);
@@ -471,17 +495,22 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
 static void _pktbuf_free(void *data, size_t size)
 {
     size_t bytes_at_end;
-    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+    _unused_t *new, *prev = NULL, *ptr = _first_unused;
 
     if (!_pktbuf_contains(data)) {
         return;
     }
-    while (ptr && (((void *)ptr) < data)) {
+    /* after gnrc_pktbuf_mark() data might not start at a chunk boundary, the
+     * chunk then also comprises the bytes before data up to the boundary.
+     * We cast to uintptr_t as intermediate step to silence -Wcast-align */
+    new = (_unused_t *)(uintptr_t)_align_ptr_down(data);
+    size = _align_ptr((uint8_t *)data + size) - (uint8_t *)new;
+    while (ptr && (ptr < new)) {
         prev = ptr;
         ptr = ptr->next;
     }
     new->next = ptr;
-    new->size = _align(size);
+    new->size = size;
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
     bytes_at_end = ((&_pktbuf[0] + CONFIG_GNRC_PKTBUF_SIZE) - (((uint8_t *)new) + new->size));
@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "log.h"
 #include "net/af.h"
@@ -84,32 +85,34 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
 #else   /* SOCK_HAS_ASYNC */
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    reg->entry.train = true;
+#endif
 #endif  /* SOCK_HAS_ASYNC */
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    reg->train = NULL;
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
-ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
-                       uint32_t timeout, sock_ip_ep_t *remote)
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static gnrc_pktsnip_t *_train_next(gnrc_sock_reg_t *reg)
 {
-    gnrc_pktsnip_t *pkt, *netif;
-    msg_t msg;
+    gnrc_pktsnip_t *pkt = gnrc_netapi_train_pkt(reg->train, reg->train_pos++);
 
-    /* The fuzzing module is only enabled when building a fuzzing
-     * application from the fuzzing/ subdirectory. When using gnrc_sock
-     * the fuzzer assumes that gnrc_sock_recv is called in a loop. If it
-     * is called again and the previous return value was the special
-     * crafted fuzzing packet, the fuzzing application terminates.
-     *
-     * sock_async_event has its on fuzzing termination condition. */
-#if defined(MODULE_FUZZING) && !defined(MODULE_SOCK_ASYNC_EVENT)
-    if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
-        exit(EXIT_SUCCESS);
+    if (reg->train_pos == gnrc_netapi_train_len(reg->train)) {
+        gnrc_pktbuf_release(reg->train);
+        reg->train = NULL;
     }
+    return pkt;
+}
 #endif
 
-    if (reg->mbox.cib.mask != (GNRC_SOCK_MBOX_SIZE - 1)) {
-        return -EINVAL;
-    }
+static int _mbox_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt,
+                      uint32_t timeout)
+{
+    msg_t msg;
+
 #ifdef MODULE_XTIMER
     xtimer_t timeout_timer;
 
@@ -132,8 +135,17 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
 #endif
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
-            pkt = msg.content.ptr;
-            break;
+            *pkt = msg.content.ptr;
+            return 0;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+        case GNRC_NETAPI_MSG_TYPE_RCV_TRAIN:
+            /* all packets of the train came with one message, the others are
+             * taken by the next calls */
+            reg->train = msg.content.ptr;
+            reg->train_pos = 0;
+            *pkt = _train_next(reg);
+            return 0;
+#endif
 #ifdef MODULE_XTIMER
         case _TIMEOUT_MSG_TYPE:
             if (msg.content.value == _TIMEOUT_MAGIC) {
@@ -144,6 +156,40 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
+}
+
+ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
+                       uint32_t timeout, sock_ip_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt, *netif;
+    int res;
+
+    /* The fuzzing module is only enabled when building a fuzzing
+     * application from the fuzzing/ subdirectory. When using gnrc_sock
+     * the fuzzer assumes that gnrc_sock_recv is called in a loop. If it
+     * is called again and the previous return value was the special
+     * crafted fuzzing packet, the fuzzing application terminates.
+     *
+     * sock_async_event has its on fuzzing termination condition. */
+#if defined(MODULE_FUZZING) && !defined(MODULE_SOCK_ASYNC_EVENT)
+    if (gnrc_sock_prevpkt && gnrc_sock_prevpkt == gnrc_pktbuf_fuzzptr) {
+        exit(EXIT_SUCCESS);
+    }
+#endif
+
+    if (reg->mbox.cib.mask != (GNRC_SOCK_MBOX_SIZE - 1)) {
+        return -EINVAL;
+    }
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    if (reg->train != NULL) {
+        /* the next packet of a received train is already there */
+        pkt = _train_next(reg);
+    }
+    else
+#endif
+    if ((res = _mbox_recv(reg, &pkt, timeout)) < 0) {
+        return res;
+    }
     /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
      * was implemented */
     ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
@@ -173,16 +219,34 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
-ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
-                       const sock_ip_ep_t *remote, uint8_t nh)
+gnrc_pktsnip_t *gnrc_sock_build_payload(const iolist_t *snips)
+{
+    gnrc_pktsnip_t *payload;
+    uint8_t *ptr;
+
+    /* copy into the packet buffer directly, so the chunks don't need to be
+     * concatenated by the caller first */
+    payload = gnrc_pktbuf_add(NULL, NULL, iolist_size(snips),
+                              GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return NULL;
+    }
+    ptr = payload->data;
+    for (const iolist_t *snip = snips; snip != NULL; snip = snip->iol_next) {
+        if (snip->iol_len > 0) {
+            memcpy(ptr, snip->iol_base, snip->iol_len);
+            ptr += snip->iol_len;
+        }
+    }
+    return payload;
+}
+
+int gnrc_sock_build(gnrc_pktsnip_t **pkt_ptr, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_nettype_t *type)
 {
-    gnrc_pktsnip_t *pkt;
+    gnrc_pktsnip_t *pkt, *payload = *pkt_ptr;
     kernel_pid_t iface = KERNEL_PID_UNDEF;
-    gnrc_nettype_t type;
-    size_t payload_len = gnrc_pkt_len(payload);
-#ifdef MODULE_GNRC_NETERR
-    unsigned status_subs = 0;
-#endif
 
     if (local->family != remote->family) {
         gnrc_pktbuf_release(payload);
@@ -199,10 +263,10 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
             }
             if (payload->type == GNRC_NETTYPE_UNDEF) {
                 payload->type = GNRC_NETTYPE_IPV6;
-                type = GNRC_NETTYPE_IPV6;
+                *type = GNRC_NETTYPE_IPV6;
             }
             else {
-                type = payload->type;
+                *type = payload->type;
             }
             hdr = pkt->data;
             hdr->nh = nh;
@@ -234,10 +298,25 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
         netif_hdr->if_pid = iface;
         pkt = gnrc_pkt_prepend(pkt, netif);
     }
+    *pkt_ptr = pkt;
+    return 0;
+}
+
+ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                       const sock_ip_ep_t *remote, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = payload;
+    gnrc_nettype_t type;
+    size_t payload_len = gnrc_pkt_len(payload);
+    int res;
+#ifdef MODULE_GNRC_NETERR
+    unsigned status_subs = 0;
+#endif
+
+    if ((res = gnrc_sock_build(&pkt, local, remote, nh, &type)) < 0) {
+        return res;
+    }
 #ifdef MODULE_GNRC_NETERR
-    /* cppcheck-suppress uninitvar
-     * (reason: pkt is initialized in AF_INET6 case above, otherwise function
-     * will return early) */
     for (gnrc_pktsnip_t *ptr = pkt; ptr != NULL; ptr = ptr->next) {
         /* no error should occur since pkt was created here */
         gnrc_neterr_reg(ptr);
@@ -283,4 +362,20 @@ ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
     return payload_len;
 }
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+int gnrc_sock_send_train(gnrc_nettype_t type, gnrc_pktsnip_t *const *pkts,
+                         unsigned numof)
+{
+    if (!gnrc_netapi_dispatch_send_train(type, GNRC_NETREG_DEMUX_CTX_ALL,
+                                         pkts, numof)) {
+        /* this should not happen, but just in case */
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        return -EBADMSG;
+    }
+    return 0;
+}
+#endif
+
 /** @} */
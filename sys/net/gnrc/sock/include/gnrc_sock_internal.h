@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include "iolist.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/gnrc.h"
@@ -118,12 +119,60 @@ void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt, uint32_t timeout,
                        sock_ip_ep_t *remote);
 
+/**
+ * @brief   Gather the payload of a packet to send internally
+ * @internal
+ *
+ * @param[in] snips     List of payload chunks.
+ *
+ * @return  A single snip holding all chunks of @p snips.
+ * @return  NULL, if the packet buffer is full.
+ */
+gnrc_pktsnip_t *gnrc_sock_build_payload(const iolist_t *snips);
+
+/**
+ * @brief   Build the network layer headers of a packet to send internally
+ * @internal
+ *
+ * @param[in,out] pkt   The payload, the full packet on success. The payload
+ *                      is released on error.
+ * @param[in] local     Local end point to send from.
+ * @param[in] remote    Remote end point to send to.
+ * @param[in] nh        Next header of the network layer.
+ * @param[out] type     Type to dispatch the packet with.
+ *
+ * @return  0 on success.
+ * @return  negative errno on error.
+ */
+int gnrc_sock_build(gnrc_pktsnip_t **pkt, sock_ip_ep_t *local,
+                    const sock_ip_ep_t *remote, uint8_t nh,
+                    gnrc_nettype_t *type);
+
 /**
  * @brief   Send a packet internally
  * @internal
  */
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh);
+
+#if defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+/**
+ * @brief   Send packets built with gnrc_sock_build() as one train internally
+ * @internal
+ *
+ * @note    Unlike gnrc_sock_send() this does not wait for error reports of
+ *          @ref net_gnrc_neterr.
+ *
+ * @param[in] type      Type to dispatch the packets with.
+ * @param[in] pkts      The packets. Released on error.
+ * @param[in] numof     Number of packets in @p pkts.
+ *
+ * @return  0 on success.
+ * @return  -EBADMSG, if there is no handler for @p type.
+ */
+int gnrc_sock_send_train(gnrc_nettype_t type, gnrc_pktsnip_t *const *pkts,
+                         unsigned numof);
+#endif
 /**
  * @}
  */
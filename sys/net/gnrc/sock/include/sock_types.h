@@ -90,6 +90,10 @@ struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;             /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                           /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[GNRC_SOCK_MBOX_SIZE]; /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(MODULE_GNRC_NETAPI_TRAIN) || defined(DOXYGEN)
+    gnrc_pktsnip_t *train;                 /**< received train not yet taken completely */
+    unsigned train_pos;                    /**< next packet of gnrc_sock_reg_t::train */
+#endif
 #ifdef SOCK_HAS_ASYNC
     gnrc_netreg_entry_cbd_t netreg_cb;     /**< netreg callback */
     /**
@@ -151,6 +151,15 @@ ssize_t sock_ip_recv_buf(sock_ip_t *sock, void **data, void **buf_ctx,
 
 ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
                      uint8_t proto, const sock_ip_ep_t *remote)
+{
+    const iolist_t snip = { .iol_base = (void *)data, .iol_len = len };
+
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+    return sock_ip_sendv(sock, &snip, proto, remote);
+}
+
+ssize_t sock_ip_sendv(sock_ip_t *sock, const iolist_t *snips, uint8_t proto,
+                      const sock_ip_ep_t *remote)
 {
     int res;
     gnrc_pktsnip_t *pkt;
@@ -158,7 +167,6 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     sock_ip_ep_t rem;
 
     assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
     if ((remote != NULL) && (sock != NULL) &&
         (sock->local.netif != SOCK_ADDR_ANY_NETIF) &&
         (remote->netif != SOCK_ADDR_ANY_NETIF) &&
@@ -211,7 +219,7 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
          * there was no remote given on create, take from local */
         rem.family = local.family;
     }
-    pkt = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
+    pkt = gnrc_sock_build_payload(snips);
     if (pkt == NULL) {
         return -ENOMEM;
     }
@@ -30,6 +30,19 @@
 
 #include "gnrc_sock_internal.h"
 
+#if defined(MODULE_SOCK_UDP_BATCH) && defined(MODULE_GNRC_NETAPI_TRAIN) && \
+    !defined(MODULE_GNRC_NETERR)
+/**
+ * @brief   Maximum number of datagrams sock_udp_send_batch() passes down
+ *          the stack with a single message
+ *
+ * The datagrams are sent as a packet train (see @ref net_gnrc_netapi_train).
+ * With @ref net_gnrc_neterr the datagrams are sent one by one, as the error
+ * report of every datagram needs to be waited for.
+ */
+#define _SEND_TRAIN_LEN     (8U)
+#endif
+
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
 static sock_udp_t *_udp_socks = NULL;
 #endif
@@ -242,18 +255,23 @@ ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
-ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
-                      const sock_udp_ep_t *remote)
+/**
+ * @brief   Checks @p remote and binds @p sock implicitly for sending
+ *
+ * @param[in] sock          A UDP sock object. May be NULL.
+ * @param[in] remote        Remote end point for the sent data. May be NULL.
+ * @param[out] local        Local end point to send from.
+ * @param[out] rem          Remote end point to send to.
+ * @param[out] src_port     Source port to send from.
+ *
+ * @return  0 on success.
+ * @return  negative errno on error, see @ref sock_udp_send().
+ */
+static int _send_prepare(sock_udp_t *sock, const sock_udp_ep_t *remote,
+                         sock_ip_ep_t *local, sock_udp_ep_t *rem,
+                         uint16_t *src_port)
 {
-    int res;
-    gnrc_pktsnip_t *payload, *pkt;
-    uint16_t src_port = 0, dst_port;
-    sock_ip_ep_t local;
-    sock_udp_ep_t remote_cpy;
-    sock_ip_ep_t *rem;
-
     assert((sock != NULL) || (remote != NULL));
-    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
 
     if (remote != NULL) {
         if (remote->port == 0) {
@@ -280,8 +298,8 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
      * cppcheck is being weird here anyways) */
     if ((sock == NULL) || (sock->local.family == AF_UNSPEC)) {
         /* no sock or sock currently unbound */
-        memset(&local, 0, sizeof(local));
-        if ((src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
+        memset(local, 0, sizeof(*local));
+        if ((*src_port = _get_dyn_port(sock)) == GNRC_SOCK_DYN_PORTRANGE_ERR) {
             return -EADDRINUSE;
         }
         /* cppcheck-suppress nullPointer
@@ -289,14 +307,14 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
          * well, see above) */
         if (sock != NULL) {
             /* bind sock object implicitly */
-            sock->local.port = src_port;
+            sock->local.port = *src_port;
             if (remote == NULL) {
                 sock->local.family = sock->remote.family;
             }
             else {
                 sock->local.family = remote->family;
             }
-            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, src_port);
+            gnrc_sock_create(&sock->reg, GNRC_NETTYPE_UDP, *src_port);
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
             /* prepend to current socks */
             sock->reg.next = (gnrc_sock_reg_t *)_udp_socks;
@@ -305,48 +323,184 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
         }
     }
     else {
-        src_port = sock->local.port;
-        memcpy(&local, &sock->local, sizeof(local));
+        *src_port = sock->local.port;
+        memcpy(local, &sock->local, sizeof(*local));
     }
     /* sock can't be NULL at this point */
     if (remote == NULL) {
-        rem = (sock_ip_ep_t *)&sock->remote;
-        dst_port = sock->remote.port;
+        memcpy(rem, &sock->remote, sizeof(*rem));
     }
     else {
-        rem = (sock_ip_ep_t *)&remote_cpy;
-        gnrc_ep_set(rem, (sock_ip_ep_t *)remote, sizeof(sock_udp_ep_t));
-        dst_port = remote->port;
+        gnrc_ep_set((sock_ip_ep_t *)rem, (sock_ip_ep_t *)remote,
+                    sizeof(sock_udp_ep_t));
     }
     /* check for matching address families in local and remote */
-    if (local.family == AF_UNSPEC) {
-        local.family = rem->family;
+    if (local->family == AF_UNSPEC) {
+        local->family = rem->family;
     }
-    else if (local.family != rem->family) {
+    else if (local->family != rem->family) {
         return -EINVAL;
     }
-    /* generate payload and header snips */
-    payload = gnrc_pktbuf_add(NULL, (void *)data, len, GNRC_NETTYPE_UNDEF);
-    if (payload == NULL) {
-        return -ENOMEM;
-    }
-    pkt = gnrc_udp_hdr_build(payload, src_port, dst_port);
+    return 0;
+}
+
+/**
+ * @brief   Sends a payload as UDP datagram
+ *
+ * @param[in] payload   Payload of the datagram. Released on error.
+ * @param[in] local     Local end point to send from.
+ * @param[in] rem       Remote end point to send to.
+ * @param[in] src_port  Source port to send from.
+ *
+ * @return  The number of payload bytes sent on success.
+ * @return  negative errno on error, see @ref sock_udp_send().
+ */
+static ssize_t _send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
+                     const sock_udp_ep_t *rem, uint16_t src_port)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
+
+    pkt = gnrc_udp_hdr_build(payload, src_port, rem->port);
     if (pkt == NULL) {
         gnrc_pktbuf_release(payload);
         return -ENOMEM;
     }
-    res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
+    res = gnrc_sock_send(pkt, local, (const sock_ip_ep_t *)rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
     }
+    return res;
+}
+
+static void _send_async_cb(sock_udp_t *sock)
+{
 #ifdef SOCK_HAS_ASYNC
     if ((sock != NULL) && (sock->reg.async_cb.udp)) {
         sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT,
                                sock->reg.async_cb_arg);
     }
+#else
+    (void)sock;
 #endif  /* SOCK_HAS_ASYNC */
+}
+
+ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
+                      const sock_udp_ep_t *remote)
+{
+    const iolist_t snip = { .iol_base = (void *)data, .iol_len = len };
+
+    assert((len == 0) || (data != NULL)); /* (len != 0) => (data != NULL) */
+    return sock_udp_sendv(sock, &snip, remote);
+}
+
+ssize_t sock_udp_sendv(sock_udp_t *sock, const iolist_t *snips,
+                       const sock_udp_ep_t *remote)
+{
+    int res;
+    gnrc_pktsnip_t *payload;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+
+    assert((sock != NULL) || (remote != NULL));
+
+    if ((res = _send_prepare(sock, remote, &local, &rem, &src_port)) < 0) {
+        return res;
+    }
+    /* generate payload snip */
+    payload = gnrc_sock_build_payload(snips);
+    if (payload == NULL) {
+        return -ENOMEM;
+    }
+    res = _send(payload, &local, &rem, src_port);
+    _send_async_cb(sock);
+    return res;
+}
+
+#ifdef MODULE_SOCK_UDP_BATCH
+int sock_udp_send_batch(sock_udp_t *sock, const sock_udp_dgram_t *dgrams,
+                        unsigned dgrams_numof)
+{
+    const sock_udp_ep_t *prev_remote = NULL;
+    uint16_t src_port = 0;
+    sock_ip_ep_t local;
+    sock_udp_ep_t rem;
+    unsigned numof;
+    int res = 0;
+#ifdef _SEND_TRAIN_LEN
+    gnrc_pktsnip_t *train[_SEND_TRAIN_LEN];
+    unsigned train_len = 0;
+    gnrc_nettype_t type = GNRC_NETTYPE_UDP;
+#endif
+
+    assert((dgrams != NULL) && (dgrams_numof > 0));
+    for (numof = 0; numof < dgrams_numof; numof++) {
+        const sock_udp_dgram_t *dgram = &dgrams[numof];
+        gnrc_pktsnip_t *payload;
+
+        assert((sock != NULL) || (dgram->remote != NULL));
+        assert((dgram->len == 0) || (dgram->data != NULL));
+        /* end points only need to be checked again, if the remote changes */
+        if ((numof == 0) || (dgram->remote != prev_remote)) {
+            res = _send_prepare(sock, dgram->remote, &local, &rem, &src_port);
+            if (res < 0) {
+                break;
+            }
+            prev_remote = dgram->remote;
+        }
+        payload = gnrc_pktbuf_add(NULL, dgram->data, dgram->len,
+                                  GNRC_NETTYPE_UNDEF);
+        if (payload == NULL) {
+            res = -ENOMEM;
+            break;
+        }
+#ifdef _SEND_TRAIN_LEN
+        gnrc_pktsnip_t *pkt = gnrc_udp_hdr_build(payload, src_port, rem.port);
+
+        if (pkt == NULL) {
+            gnrc_pktbuf_release(payload);
+            res = -ENOMEM;
+            break;
+        }
+        if ((res = gnrc_sock_build(&pkt, &local, (sock_ip_ep_t *)&rem,
+                                   PROTNUM_UDP, &type)) < 0) {
+            break;
+        }
+        train[train_len++] = pkt;
+        if (train_len == _SEND_TRAIN_LEN) {
+            res = gnrc_sock_send_train(type, train, train_len);
+            train_len = 0;
+            if (res < 0) {
+                /* the datagrams of the train were not sent */
+                numof -= _SEND_TRAIN_LEN - 1;
+                break;
+            }
+        }
+#else
+        if ((res = _send(payload, &local, &rem, src_port)) < 0) {
+            break;
+        }
+#endif
+    }
+#ifdef _SEND_TRAIN_LEN
+    if (train_len > 0) {
+        int train_res = gnrc_sock_send_train(type, train, train_len);
+
+        if (train_res < 0) {
+            numof -= train_len;
+            res = train_res;
+        }
+    }
+#endif
+    if (numof > 0) {
+        /* one notification for the whole batch */
+        _send_async_cb(sock);
+        return numof;
+    }
     return res;
 }
+#endif  /* MODULE_SOCK_UDP_BATCH */
 
 #ifdef SOCK_HAS_ASYNC
 void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb, void *arg)
@@ -229,6 +229,121 @@ static int _gnrc_tcp_open(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *remote,
 }
 
 /* External GNRC TCP API */
+/**
+ * @brief   Hands out an established connection of a listen queue.
+ *
+ * @pre     @p queue is locked.
+ *
+ * Connections that were reset before they were accepted are listening again
+ * afterwards.
+ *
+ * @param[in,out] queue   TCB queue to search.
+ *
+ * @returns   TCB of an established connection, that was not accepted yet.
+ *            NULL if there is none.
+ */
+static gnrc_tcp_tcb_t *_accept_established(gnrc_tcp_tcb_queue_t *queue)
+{
+    TCP_DEBUG_ENTER;
+    for (size_t i = 0; i < queue->tcbs_len; ++i) {
+        gnrc_tcp_tcb_t *tcb = &queue->tcbs[i];
+
+        if (tcb->status & STATUS_ACCEPTED) {
+            continue;
+        }
+        if (tcb->state == FSM_STATE_CLOSED) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+            _gnrc_tcp_fsm_set_mbox(tcb, queue->mbox);
+            continue;
+        }
+        if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_CLOSE_WAIT) {
+            mutex_lock(&(tcb->fsm_lock));
+            tcb->status |= STATUS_ACCEPTED;
+            tcb->mbox = NULL;
+            mutex_unlock(&(tcb->fsm_lock));
+            TCP_DEBUG_LEAVE;
+            return tcb;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return NULL;
+}
+
+/**
+ * @brief   Resets the state of the last connection of a TCB.
+ *
+ * The address family, the local endpoint, the passive open flags, the listen
+ * queue and the locks are kept.
+ *
+ * @param[in,out] tcb   TCB to reset.
+ */
+static void _tcb_reset(gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_IPV6
+    memset(tcb->peer_addr, 0, sizeof(tcb->peer_addr));
+    tcb->ll_iface = 0;
+#endif
+    tcb->peer_port = PORT_UNSPEC;
+    tcb->status &= (STATUS_PASSIVE | STATUS_ALLOW_ANY_ADDR);
+    tcb->snd_una = 0;
+    tcb->snd_nxt = 0;
+    tcb->snd_wnd = 0;
+    tcb->snd_wl1 = 0;
+    tcb->snd_wl2 = 0;
+    tcb->rcv_nxt = 0;
+    tcb->rcv_wnd = 0;
+    tcb->iss = 0;
+    tcb->irs = 0;
+    tcb->mss = 0;
+    tcb->snd_wscale = 0;
+    tcb->rcv_wscale = 0;
+    tcb->rtt_start = 0;
+    tcb->rtt_var = RTO_UNINITIALIZED;
+    tcb->srtt = RTO_UNINITIALIZED;
+    tcb->rto = RTO_UNINITIALIZED;
+    tcb->rtt_seq = 0;
+    tcb->retries = 0;
+    tcb->dup_acks = 0;
+    tcb->cwnd = 0;
+    tcb->ssthresh = 0;
+    tcb->recover = 0;
+    memset(tcb->rcv_sack, 0, sizeof(tcb->rcv_sack));
+    tcb->rcv_sack_num = 0;
+}
+
+/**
+ * @brief   Lets a closed TCB of a listen queue wait for the next connection.
+ *
+ * @param[in,out] tcb     TCB to reuse.
+ * @param[in]     queue   Listen queue @p tcb belonged to when it was closed.
+ *                        Nothing is done if it is NULL.
+ */
+static void _relisten(gnrc_tcp_tcb_t *tcb, gnrc_tcp_tcb_queue_t *queue)
+{
+    TCP_DEBUG_ENTER;
+    if (queue == NULL) {
+        TCP_DEBUG_LEAVE;
+        return;
+    }
+
+    mutex_lock(&(queue->lock));
+    /* The queue may have stopped listening in the meantime */
+    if (tcb->queue == queue) {
+        mutex_lock(&(tcb->fsm_lock));
+        if (tcb->state == FSM_STATE_CLOSED) {
+            _tcb_reset(tcb);
+        }
+        tcb->status &= ~STATUS_ACCEPTED;
+        mutex_unlock(&(tcb->fsm_lock));
+        if (tcb->state == FSM_STATE_CLOSED) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+        }
+        _gnrc_tcp_fsm_set_mbox(tcb, queue->mbox);
+    }
+    mutex_unlock(&(queue->lock));
+    TCP_DEBUG_LEAVE;
+}
+
 int gnrc_tcp_ep_init(gnrc_tcp_ep_t *ep, int family, const uint8_t *addr, size_t addr_size,
                      uint16_t port, uint16_t netif)
 {
@@ -409,9 +524,7 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
 #else
     TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
 #endif
-    tcb->rtt_var = RTO_UNINITIALIZED;
-    tcb->srtt = RTO_UNINITIALIZED;
-    tcb->rto = RTO_UNINITIALIZED;
+    _tcb_reset(tcb);
     mutex_init(&(tcb->fsm_lock));
     mutex_init(&(tcb->function_lock));
     TCP_DEBUG_LEAVE;
@@ -483,6 +596,198 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_ep_t *local)
 #endif
 }
 
+void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    memset(queue, 0, sizeof(gnrc_tcp_tcb_queue_t));
+    mutex_init(&(queue->lock));
+    TCP_DEBUG_LEAVE;
+}
+
+int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tcbs_len,
+                    const gnrc_tcp_ep_t *local)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(tcbs != NULL);
+    assert(tcbs_len > 0);
+    assert(local != NULL);
+    assert(local->port != PORT_UNSPEC);
+
+    /* Check if given AF-Family in local is supported */
+#ifdef MODULE_GNRC_IPV6
+    if (local->family != AF_INET6) {
+        TCP_DEBUG_ERROR("-EAFNOSUPPORT: AF-Family not supported.");
+        TCP_DEBUG_LEAVE;
+        return -EAFNOSUPPORT;
+    }
+
+    mutex_lock(&(queue->lock));
+
+    /* Queue is already listening: Return -EISCONN */
+    if (queue->tcbs != NULL) {
+        mutex_unlock(&(queue->lock));
+        TCP_DEBUG_ERROR("-EISCONN: Queue already listening.");
+        TCP_DEBUG_LEAVE;
+        return -EISCONN;
+    }
+
+    /* Let every TCB wait for a connection request, T: CLOSED -> LISTEN */
+    for (size_t i = 0; i < tcbs_len; ++i) {
+        gnrc_tcp_tcb_t *tcb = &tcbs[i];
+
+        gnrc_tcp_tcb_init(tcb);
+        tcb->status |= STATUS_PASSIVE;
+        memcpy(tcb->local_addr, local->addr.ipv6, sizeof(tcb->local_addr));
+        if (ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
+            tcb->status |= STATUS_ALLOW_ANY_ADDR;
+        }
+        tcb->local_port = local->port;
+        tcb->queue = queue;
+
+        int ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_OPEN, NULL, NULL, 0);
+        if (ret < 0) {
+            /* Revert TCBs that are already listening */
+            while (i-- > 0) {
+                _gnrc_tcp_fsm(&tcbs[i], FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+                tcbs[i].queue = NULL;
+            }
+            tcb->queue = NULL;
+            mutex_unlock(&(queue->lock));
+            TCP_DEBUG_ERROR("-ENOMEM: All receive buffers are in use.");
+            TCP_DEBUG_LEAVE;
+            return ret;
+        }
+    }
+    queue->tcbs = tcbs;
+    queue->tcbs_len = tcbs_len;
+    queue->mbox = NULL;
+    mutex_unlock(&(queue->lock));
+    TCP_DEBUG_LEAVE;
+    return 0;
+#else
+    (void) queue;
+    (void) tcbs;
+    (void) tcbs_len;
+    TCP_DEBUG_ERROR("-EAFNOSUPPORT: AF-Family not supported.");
+    TCP_DEBUG_LEAVE;
+    return -EAFNOSUPPORT;
+#endif
+}
+
+int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
+                    const uint32_t user_timeout_duration_ms)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(tcb != NULL);
+
+    msg_t msg;
+    msg_t msg_queue[TCP_MSG_QUEUE_SIZE];
+    mbox_t mbox = MBOX_INIT(msg_queue, TCP_MSG_QUEUE_SIZE);
+    evtimer_mbox_event_t event_user_timeout;
+    int ret = 0;
+
+    *tcb = NULL;
+    mutex_lock(&(queue->lock));
+
+    /* Check if queue is in a valid state */
+    if (queue->tcbs == NULL) {
+        mutex_unlock(&(queue->lock));
+        TCP_DEBUG_ERROR("-EINVAL: Queue is not listening.");
+        TCP_DEBUG_LEAVE;
+        return -EINVAL;
+    }
+    if (queue->mbox != NULL) {
+        mutex_unlock(&(queue->lock));
+        TCP_DEBUG_ERROR("-EALREADY: Another thread is accepting.");
+        TCP_DEBUG_LEAVE;
+        return -EALREADY;
+    }
+
+    /* Return a connection that has been established in the meantime */
+    *tcb = _accept_established(queue);
+    if (*tcb != NULL || user_timeout_duration_ms == 0) {
+        mutex_unlock(&(queue->lock));
+        if (*tcb == NULL) {
+            TCP_DEBUG_ERROR("-EAGAIN: No connection established, try later again.");
+            ret = -EAGAIN;
+        }
+        TCP_DEBUG_LEAVE;
+        return ret;
+    }
+
+    /* Setup messaging */
+    queue->mbox = &mbox;
+    for (size_t i = 0; i < queue->tcbs_len; ++i) {
+        if (!(queue->tcbs[i].status & STATUS_ACCEPTED)) {
+            _gnrc_tcp_fsm_set_mbox(&queue->tcbs[i], &mbox);
+        }
+    }
+    mutex_unlock(&(queue->lock));
+
+    _sched_mbox(&event_user_timeout, user_timeout_duration_ms,
+                MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
+
+    /* Wait until a connection was established */
+    while (*tcb == NULL && ret == 0) {
+        mbox_get(&mbox, &msg);
+        switch (msg.type) {
+            case MSG_TYPE_NOTIFY_USER:
+                TCP_DEBUG_INFO("Received MSG_TYPE_NOTIFY_USER.");
+                mutex_lock(&(queue->lock));
+                *tcb = _accept_established(queue);
+                mutex_unlock(&(queue->lock));
+                break;
+
+            case MSG_TYPE_USER_SPEC_TIMEOUT:
+                TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
+                TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
+                ret = -ETIMEDOUT;
+                break;
+
+            default:
+                TCP_DEBUG_ERROR("Received unexpected message.");
+        }
+    }
+
+    /* Cleanup */
+    mutex_lock(&(queue->lock));
+    for (size_t i = 0; i < queue->tcbs_len; ++i) {
+        if (!(queue->tcbs[i].status & STATUS_ACCEPTED)) {
+            _gnrc_tcp_fsm_set_mbox(&queue->tcbs[i], NULL);
+        }
+    }
+    queue->mbox = NULL;
+    mutex_unlock(&(queue->lock));
+    _unsched_mbox(&event_user_timeout);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
+{
+    TCP_DEBUG_ENTER;
+    assert(queue != NULL);
+    assert(queue->mbox == NULL);
+
+    mutex_lock(&(queue->lock));
+    for (size_t i = 0; i < queue->tcbs_len; ++i) {
+        gnrc_tcp_tcb_t *tcb = &queue->tcbs[i];
+
+        /* Accepted connections are up to the user */
+        if (!(tcb->status & STATUS_ACCEPTED) && tcb->state != FSM_STATE_CLOSED) {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
+        }
+        tcb->queue = NULL;
+    }
+    queue->tcbs = NULL;
+    queue->tcbs_len = 0;
+    mutex_unlock(&(queue->lock));
+    TCP_DEBUG_LEAVE;
+}
+
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t timeout_duration_ms)
 {
@@ -497,6 +802,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     evtimer_mbox_event_t event_probe_timeout;
     uint32_t probe_timeout_duration_ms = 0;
     ssize_t ret = 0;
+    size_t sent = 0;
     bool probing_mode = false;
 
     /* Lock the TCB for this function call */
@@ -521,8 +827,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and everything sent was acked */
+    while (ret == 0) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             TCP_DEBUG_ERROR("-ECONNRESET: Connection was reset by peer.");
@@ -543,9 +849,15 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send as much of the remaining data as possible, if we are not probing */
+        if (sent < len && !probing_mode) {
+            sent += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                  (uint8_t *) data + sent, len - sent);
+        }
+
+        /* Nothing more can be sent and everything sent was acked: return */
+        if (sent > 0 && tcb->pkt_retransmit[0] == NULL) {
+            break;
         }
 
         /* Wait for responses */
@@ -599,6 +911,10 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         }
     }
 
+    if (ret == 0) {
+        ret = sent;
+    }
+
     /* Cleanup */
     _gnrc_tcp_fsm_set_mbox(tcb, NULL);
     _unsched_mbox(&tcb->event_misc);
@@ -735,6 +1051,7 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     /* Return if connection is closed */
     if (tcb->state == FSM_STATE_CLOSED) {
         mutex_unlock(&(tcb->function_lock));
+        _relisten(tcb, tcb->queue);
         TCP_DEBUG_LEAVE;
         return;
     }
@@ -770,6 +1087,9 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb)
     _gnrc_tcp_fsm_set_mbox(tcb, NULL);
     _unsched_mbox(&tcb->event_misc);
     mutex_unlock(&(tcb->function_lock));
+
+    /* Reuse TCBs of a listen queue for the next connection */
+    _relisten(tcb, tcb->queue);
     TCP_DEBUG_LEAVE;
 }
 
@@ -785,6 +1105,9 @@ void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
         _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_ABORT, NULL, NULL, 0);
     }
     mutex_unlock(&(tcb->function_lock));
+
+    /* Reuse TCBs of a listen queue for the next connection */
+    _relisten(tcb, tcb->queue);
     TCP_DEBUG_LEAVE;
 }
 
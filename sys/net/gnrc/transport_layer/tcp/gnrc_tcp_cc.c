@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+#include "net/tcp.h"
+#include "net/gnrc/tcp/config.h"
+#include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_cc.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief MSS to assume if the peer did not send an MSS option (see RFC 793).
+ */
+#define DEFAULT_PEER_MSS    (536U)
+
+/**
+ * @brief Upper bound for the congestion window.
+ *
+ * The send window can't exceed this value, so growing the congestion window
+ * any further has no effect.
+ */
+#define CWND_MAX            ((uint32_t) UINT16_MAX << TCP_OPTION_WS_MAX)
+
+static inline uint32_t _min(const uint32_t x, const uint32_t y)
+{
+    return (x < y) ? x : y;
+}
+
+static inline uint32_t _max(const uint32_t x, const uint32_t y)
+{
+    return (x > y) ? x : y;
+}
+
+static inline uint32_t _flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+/**
+ * @brief Halves the congestion window on loss, see RFC 5681, equation (4).
+ */
+static void _reduce_ssthresh(gnrc_tcp_tcb_t *tcb, uint32_t smss)
+{
+    tcb->ssthresh = _max(_flight_size(tcb) / 2, 2 * smss);
+}
+
+uint16_t _gnrc_tcp_cc_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    uint16_t mss = (tcb->mss > 0) ? tcb->mss : DEFAULT_PEER_MSS;
+
+    return (mss < CONFIG_GNRC_TCP_MSS) ? mss : CONFIG_GNRC_TCP_MSS;
+}
+
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _gnrc_tcp_cc_smss(tcb);
+
+    /* Initial window, see RFC 5681, section 3.1 */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    tcb->ssthresh = UINT32_MAX;
+    tcb->recover = tcb->snd_una;
+    tcb->dup_acks = 0;
+    tcb->status &= ~(STATUS_FAST_RECOVERY | STATUS_LOSS_RECOVERY);
+    TCP_DEBUG_LEAVE;
+}
+
+uint32_t _gnrc_tcp_cc_snd_avail(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = _min(tcb->snd_wnd, tcb->cwnd);
+    uint32_t flight = _flight_size(tcb);
+
+    return (wnd > flight) ? (wnd - flight) : 0;
+}
+
+bool _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _gnrc_tcp_cc_smss(tcb);
+    bool all_recovered = LEQ_32_BIT(tcb->recover, tcb->snd_una);
+
+    tcb->dup_acks = 0;
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        if (all_recovered) {
+            /* Full acknowledgment: deflate window, see RFC 6582, section 3.2.
+             * The retransmit queue limits bursts, so use ssthresh directly */
+            TCP_DEBUG_INFO("Leaving fast recovery.");
+            tcb->cwnd = tcb->ssthresh;
+            tcb->status &= ~STATUS_FAST_RECOVERY;
+            TCP_DEBUG_LEAVE;
+            return false;
+        }
+        /* Partial acknowledgment: the next segment was lost as well */
+        tcb->cwnd = (tcb->cwnd > acked) ? (tcb->cwnd - acked) : 0;
+        if (acked >= smss) {
+            tcb->cwnd += smss;
+        }
+        tcb->cwnd = _max(tcb->cwnd, smss);
+        TCP_DEBUG_LEAVE;
+        return true;
+    }
+
+    /* Slow start or congestion avoidance, see RFC 5681, section 3.1 */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += _min(acked, smss);
+    }
+    else {
+        tcb->cwnd += _max((smss * smss) / tcb->cwnd, 1);
+    }
+    tcb->cwnd = _min(tcb->cwnd, CWND_MAX);
+
+    /* After a timeout, resend the segments sent before it one by one */
+    if (tcb->status & STATUS_LOSS_RECOVERY) {
+        if (all_recovered) {
+            tcb->status &= ~STATUS_LOSS_RECOVERY;
+        }
+        TCP_DEBUG_LEAVE;
+        return !all_recovered;
+    }
+    TCP_DEBUG_LEAVE;
+    return false;
+}
+
+bool _gnrc_tcp_cc_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _gnrc_tcp_cc_smss(tcb);
+
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        /* Inflate window for each segment that left the network */
+        tcb->cwnd = _min(tcb->cwnd + smss, CWND_MAX);
+        TCP_DEBUG_LEAVE;
+        return false;
+    }
+    if (++tcb->dup_acks != GNRC_TCP_CC_DUP_THRESH) {
+        TCP_DEBUG_LEAVE;
+        return false;
+    }
+    /* Don't enter fast recovery again for losses of the same window, see
+     * RFC 6582, section 3.2 */
+    if (!LEQ_32_BIT(tcb->recover, tcb->snd_una) ||
+        (tcb->status & STATUS_LOSS_RECOVERY)) {
+        TCP_DEBUG_LEAVE;
+        return false;
+    }
+    TCP_DEBUG_INFO("Entering fast recovery.");
+    _reduce_ssthresh(tcb, smss);
+    tcb->cwnd = tcb->ssthresh + (GNRC_TCP_CC_DUP_THRESH * smss);
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_FAST_RECOVERY;
+    TCP_DEBUG_LEAVE;
+    return true;
+}
+
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t smss = _gnrc_tcp_cc_smss(tcb);
+
+    /* Only reduce ssthresh for the first timeout of a segment, see RFC 5681,
+     * section 3.1 */
+    if (tcb->retries == 0) {
+        _reduce_ssthresh(tcb, smss);
+    }
+    /* Loss window */
+    tcb->cwnd = smss;
+    tcb->dup_acks = 0;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+    tcb->status |= STATUS_LOSS_RECOVERY;
+    TCP_DEBUG_LEAVE;
+}
@@ -20,6 +20,7 @@
 #include <assert.h>
 #include <utlist.h>
 #include <errno.h>
+#include <stdbool.h>
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
@@ -105,6 +106,50 @@ static int _send(gnrc_pktsnip_t *pkt)
     return 0;
 }
 
+#ifdef MODULE_GNRC_IPV6
+/**
+ * @brief Checks if @p tcb handles the connection an incoming packet belongs to.
+ *
+ * @param[in] tcb   TCB to check.
+ * @param[in] ip    IPv6 header of the incoming packet.
+ * @param[in] src   Source port of the incoming packet.
+ * @param[in] dst   Destination port of the incoming packet.
+ *
+ * @returns   true if ports and peer address match, false otherwise.
+ */
+static bool _conn_match(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *ip, uint16_t src,
+                        uint16_t dst)
+{
+    if (tcb->address_family != AF_INET6 || tcb->local_port != dst ||
+        tcb->peer_port != src) {
+        return false;
+    }
+    return ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr,
+                           &((ipv6_hdr_t *)ip->data)->src);
+}
+
+/**
+ * @brief Checks if @p tcb is bound to the local endpoint an incoming SYN is
+ *        addressed to.
+ *
+ * @param[in] tcb   TCB to check.
+ * @param[in] ip    IPv6 header of the incoming packet.
+ * @param[in] dst   Destination port of the incoming packet.
+ *
+ * @returns   true if the port matches and the local address is either
+ *            unspecified or equal to the destination address, false otherwise.
+ */
+static bool _listen_match(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *ip, uint16_t dst)
+{
+    if (tcb->address_family != AF_INET6 || tcb->local_port != dst) {
+        return false;
+    }
+    return ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr) ||
+           ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr,
+                           &((ipv6_hdr_t *)ip->data)->dst);
+}
+#endif
+
 /**
  * @brief Receive function, receive packet from network layer.
  *
@@ -128,6 +173,7 @@ static int _receive(gnrc_pktsnip_t *pkt)
     uint16_t dst = 0;
     uint8_t hdr_size = 0;
     uint8_t syn = 0;
+    bool queue_full = false;
     gnrc_pktsnip_t *ip = NULL;
     gnrc_pktsnip_t *reset = NULL;
     gnrc_tcp_tcb_t *tcb = NULL;
@@ -214,40 +260,37 @@ static int _receive(gnrc_pktsnip_t *pkt)
     /* Find TCB to for this packet */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&list->lock);
-    tcb = list->head;
-    while (tcb) {
 #ifdef MODULE_GNRC_IPV6
-        /* Check if current TCB is fitting for the incoming packet */
-        if (ip->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
-            /* If SYN is set, a connection is listening on that port ... */
-            ipv6_addr_t *tmp_addr = NULL;
-            if (syn && tcb->local_port == dst && tcb->state == FSM_STATE_LISTEN) {
-                /* ... and local addr is unspec or pre configured */
-                tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
-                    ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
-                    break;
-                }
+    /* A TCB already handling the connection takes precedence over a listening
+     * one. This includes a TCB in SYN_RCVD receiving a retransmitted SYN */
+    LL_FOREACH(list->head, tcb) {
+        if (tcb->state != FSM_STATE_LISTEN && _conn_match(tcb, ip, src, dst)) {
+            break;
+        }
+    }
+    /* If SYN is set, a connection may be listening on that port */
+    if (tcb == NULL && syn) {
+        LL_FOREACH(list->head, tcb) {
+            if (!_listen_match(tcb, ip, dst)) {
+                continue;
             }
-
-            /* If SYN is not set and the ports match ... */
-            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
-                /* .. and the IPv6 addresses match */
-                tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
-                    break;
-                }
+            if (tcb->state == FSM_STATE_LISTEN) {
+                break;
+            }
+            /* Remember if a listen queue is bound to the endpoint, but all of its TCBs are busy */
+            if (tcb->queue != NULL) {
+                queue_full = true;
             }
         }
+    }
 #else
-        /* Suppress compiler warnings if TCP is built without network layer */
-        TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-        (void) syn;
-        (void) src;
-        (void) dst;
+    /* Suppress compiler warnings if TCP is built without network layer */
+    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+    (void) syn;
+    (void) src;
+    (void) dst;
+    tcb = NULL;
 #endif
-        tcb = tcb->next;
-    }
     mutex_unlock(&list->lock);
 
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
@@ -257,6 +300,13 @@ static int _receive(gnrc_pktsnip_t *pkt)
     if (tcb != NULL) {
         _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
     }
+    /* All TCBs of a listen queue are busy. Drop the SYN so that the peer retries later */
+    else if (queue_full) {
+        gnrc_pktbuf_release(pkt);
+        TCP_DEBUG_INFO("Listen queue is full, drop SYN.");
+        TCP_DEBUG_LEAVE;
+        return -ENOTCONN;
+    }
     /* No fitting TCB has been found. Respond with reset */
     else {
         if ((ctl & MSK_RST) != MSK_RST) {
@@ -19,11 +19,13 @@
 
 #include <utlist.h>
 #include <errno.h>
+#include <string.h>
 #include "random.h"
 #include "net/af.h"
 #include "net/gnrc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
+#include "include/gnrc_tcp_cc.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -92,10 +94,57 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->pkt_retransmit[0] != NULL) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE; i++) {
+            if (tcb->pkt_retransmit[i] != NULL) {
+                gnrc_pktbuf_release(tcb->pkt_retransmit[i]);
+                tcb->pkt_retransmit[i] = NULL;
+            }
+        }
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+/**
+ * @brief Resends segments considered lost without waiting for the
+ *        retransmission timeout.
+ *
+ * The oldest unacknowledged segment is considered lost. During fast recovery
+ * with SACK, every segment in front of a selectively acknowledged segment is
+ * considered lost as well (see RFC 6675). Each segment is resent only once.
+ *
+ * @param[in,out] tcb   TCB holding the retransmit queue.
+ *
+ * @return   Zero on success.
+ */
+static int _fast_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    unsigned last = 0;
+
+    /* Find the last selectively acknowledged segment */
+    if ((tcb->status & STATUS_SACK) && (tcb->status & STATUS_FAST_RECOVERY)) {
+        for (unsigned i = 0; i < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE; i++) {
+            if (tcb->pkt_retransmit[i] == NULL) {
+                break;
+            }
+            if (tcb->pkt_retransmit_flags[i] & RETRANSMIT_SACKED) {
+                last = i;
+            }
+        }
+    }
+
+    for (unsigned i = 0; i <= last && tcb->pkt_retransmit[i] != NULL; i++) {
+        if (tcb->pkt_retransmit_flags[i] & (RETRANSMIT_SACKED | RETRANSMIT_RESENT)) {
+            continue;
+        }
+        tcb->pkt_retransmit_flags[i] |= RETRANSMIT_RESENT;
+
+        /* Every send attempt consumes a user */
+        gnrc_pktbuf_hold(tcb->pkt_retransmit[i], 1);
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[i], 0, true);
     }
     TCP_DEBUG_LEAVE;
     return 0;
@@ -160,6 +209,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             }
 #endif
             tcb->peer_port = PORT_UNSPEC;
+            tcb->retries = 0;
 
             /* Add connection to active connections (if not already active) */
             mutex_lock(&list->lock);
@@ -195,8 +245,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             mutex_unlock(&list->lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            /* The peers MSS is known now: Setup congestion control */
+            _gnrc_tcp_cc_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -235,6 +290,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     }
 
     tcb->rcv_wnd = CONFIG_GNRC_TCP_DEFAULT_WINDOW;
+    tcb->rcv_wscale = _gnrc_tcp_option_calc_wscale(GNRC_TCP_RCV_BUF_SIZE);
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -278,27 +334,37 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+    size_t smss = _gnrc_tcp_cc_smss(tcb);
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Send segments as long as send window, congestion window and retransmit queue allow */
+    while (sent < len &&
+           tcb->pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1] == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        size_t payload = _gnrc_tcp_cc_snd_avail(tcb);
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
+        if (payload == 0) {
+            break;
+        }
 
-        /* Calculate payload size for this segment */
+        /* Push the data once the last segment of the buffer is sent */
+        uint16_t ctl = ((sent + payload) == len) ? (MSK_ACK | MSK_PSH) : MSK_ACK;
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, ctl, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
+        if (_gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false) < 0) {
+            gnrc_pktbuf_release(out_pkt);
+            break;
+        }
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -442,6 +508,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* Scale window, if window scaling was negotiated. SYNs are never scaled. */
+    if (!(ctl & MSK_SYN) && (tcb->status & STATUS_WSCALE)) {
+        seg_wnd <<= tcb->snd_wscale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
@@ -530,6 +601,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->peer_port = src;
             tcb->irs = byteorder_ntohl(tcp_hdr->seq_num);
             tcb->rcv_nxt = tcb->irs + 1;
+            tcb->rcv_sack_num = 0;
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
@@ -574,6 +646,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
         if (ctl & MSK_SYN) {
             tcb->rcv_nxt = seg_seq + 1;
             tcb->irs = seg_seq;
+            tcb->rcv_sack_num = 0;
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
                 _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
@@ -673,8 +746,27 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+
+                    /* Update congestion window, resend next segment if it was lost too */
+                    if (_gnrc_tcp_cc_ack(tcb, acked) && tcb->pkt_retransmit[0] != NULL) {
+                        _fast_retransmit(tcb);
+                    }
+                    /* Signal user that more data can be sent */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK (see RFC 5681, section 2): Peer received out of order data */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd && tcb->pkt_retransmit[0] != NULL) {
+                    /* During fast recovery, SACK information might reveal more losses */
+                    if (_gnrc_tcp_cc_dup_ack(tcb) || (tcb->status & STATUS_FAST_RECOVERY)) {
+                        _fast_retransmit(tcb);
+                    }
+                    /* Signal user that congestion window might have changed */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -699,25 +791,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->pkt_retransmit[0] == NULL) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -733,24 +825,28 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
+                uint32_t seq = seg_seq;
+                size_t rcvd = 0;
+
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
-                    /* Notify owner because new data is available */
+                /* Copy contents into receive buffer, out of order data is kept as well */
+                while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                    rcvd += _gnrc_tcp_rcvbuf_add(tcb, seq, snp->data, snp->size);
+                    seq += snp->size;
+                    snp = snp->next;
+                }
+                /* Shrink receive window */
+                tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+
+                /* Notify owner because new data is available */
+                if (rcvd > 0) {
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || tcb->rcv_nxt != seg_seq + pay_len) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
@@ -764,6 +860,17 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Process FIN only after all data in front of it was received */
+            if (tcb->rcv_nxt != seg_seq + pay_len) {
+                TCP_DEBUG_INFO("FIN received out of order.");
+                if (pay_len == 0) {
+                    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                        tcb->rcv_nxt, NULL, 0);
+                    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                }
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -774,7 +881,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->pkt_retransmit[0] == NULL) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -818,9 +925,26 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    /* Nobody waits for the handshake of a listen queue TCB. Give up and wait
+     * for the next connection request, T: SYN_RCVD -> LISTEN */
+    if ((tcb->state == FSM_STATE_SYN_RCVD) && (tcb->queue != NULL) &&
+        (tcb->retries >= CONFIG_GNRC_TCP_SYNACK_RETRIES)) {
+        TCP_DEBUG_INFO("Handshake timed out, listen again.");
+        _clear_retransmit(tcb);
+        _transition_to(tcb, FSM_STATE_LISTEN);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (tcb->pkt_retransmit[0] != NULL) {
+        _gnrc_tcp_cc_timeout(tcb);
+
+        /* Resend every segment again during loss recovery */
+        memset(tcb->pkt_retransmit_flags, 0, sizeof(tcb->pkt_retransmit_flags));
+        tcb->pkt_retransmit_flags[0] = RETRANSMIT_RESENT;
+        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit[0], true);
+        /* Only timeouts count, fast retransmits don't back off the timer */
+        tcb->retries += 1;
+        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit[0], 0, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
@@ -17,16 +17,42 @@
  * @}
  */
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
+#include "include/gnrc_tcp_pkt.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/**
+ * @brief Reads an unaligned 32-bit value in network byte order.
+ *
+ * @param[in] buf   Buffer to read from.
+ *
+ * @returns   Value in host byte order.
+ */
+static uint32_t _get_u32(const uint8_t *buf)
+{
+    return (((uint32_t) buf[0] << 24) | ((uint32_t) buf[1] << 16) |
+            ((uint32_t) buf[2] << 8) | buf[3]);
+}
+
 int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
 {
     TCP_DEBUG_ENTER;
-    /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    /* Extract offset and control bits */
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    uint8_t offset = GET_OFFSET(ctl);
+
+    /* Options negotiated during the handshake are only valid in the peers SYN */
+    bool syn = (ctl & MSK_SYN) && (tcb->state == FSM_STATE_LISTEN ||
+                                   tcb->state == FSM_STATE_SYN_SENT);
+    if (syn) {
+        tcb->status &= ~(STATUS_WSCALE | STATUS_SACK);
+        tcb->snd_wscale = 0;
+    }
+
+    /* Return if no options are set */
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -64,6 +90,52 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 tcb->mss = (option->value[0] << 8) | option->value[1];
                 break;
 
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                if (syn) {
+                    TCP_DEBUG_INFO("Window scale option found.");
+                    tcb->snd_wscale = (option->value[0] < TCP_OPTION_WS_MAX) ?
+                                      option->value[0] : TCP_OPTION_WS_MAX;
+                    tcb->status |= STATUS_WSCALE;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                if (syn) {
+                    TCP_DEBUG_INFO("SACK permitted option found.");
+                    tcb->status |= STATUS_SACK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_LENGTH_SACK_BLOCK ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                if (!(ctl & MSK_SYN) && (tcb->status & STATUS_SACK)) {
+                    TCP_DEBUG_INFO("SACK option found.");
+                    for (uint8_t i = 0; i < option->length - TCP_OPTION_LENGTH_MIN;
+                         i += TCP_OPTION_LENGTH_SACK_BLOCK) {
+                        _gnrc_tcp_pkt_sack(tcb, _get_u32(option->value + i),
+                                           _get_u32(option->value + i + 4));
+                    }
+                }
+                break;
+
             default:
                 if (opt_left >= TCP_OPTION_LENGTH_MIN) {
                     TCP_DEBUG_INFO("Valid, unsupported option found.");
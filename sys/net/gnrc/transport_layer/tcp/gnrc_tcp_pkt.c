@@ -16,6 +16,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <assert.h>
 #include <string.h>
 #include <utlist.h>
 #include <errno.h>
@@ -49,6 +50,43 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the retransmission timeout from the current RTT estimation.
+ *
+ * @param[in] tcb   TCB holding the RTT estimation.
+ *
+ * @returns   Retransmission timeout in milliseconds.
+ */
+static int32_t _calc_rto(const gnrc_tcp_tcb_t *tcb)
+{
+    /* Before the first measurement: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        return CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    return tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                            CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+}
+
+/**
+ * @brief Schedules the retransmission timer for the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb   TCB holding the retransmission timer.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -155,6 +193,8 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = NULL;
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
+    uint32_t wnd = tcb->rcv_wnd;
+    uint8_t sack_blocks = 0;
 
     /* Add payload, if supplied */
     if (payload != NULL && payload_len > 0) {
@@ -173,13 +213,34 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
+    /* The window field of SYN segments is never scaled */
+    if (!(ctl & MSK_SYN) && (tcb->status & STATUS_WSCALE)) {
+        wnd >>= tcb->rcv_wscale;
+    }
+    tcp_hdr.window = byteorder_htons((wnd < UINT16_MAX) ? wnd : UINT16_MAX);
+
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    /* Add MSS, window scale and SACK permitted option if SYN is sent. */
+    /* The latter two are only sent in a SYN+ACK, if the peer sent them. */
     if (ctl & MSK_SYN) {
         offset += 1;
+        if (!(ctl & MSK_ACK) || (tcb->status & STATUS_WSCALE)) {
+            offset += 1;
+        }
+        if (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK)) {
+            offset += 1;
+        }
+    }
+    /* Add SACK option to pure ACKs, if out of order data was received */
+    else if ((tcb->status & STATUS_SACK) && (ctl & MSK_CTL) == MSK_ACK &&
+             payload_len == 0) {
+        sack_blocks = tcb->rcv_sack_num;
+        if (sack_blocks > 0) {
+            offset += 1 + (sack_blocks * TCP_OPTION_LENGTH_SACK_BLOCK) /
+                      sizeof(network_uint32_t);
+        }
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -211,14 +272,42 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
+            /* If SYN flag is set: Add MSS, window scale and SACK permitted option */
             if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(
+                network_uint32_t option = byteorder_htonl(
                     _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
 
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                memcpy(opt_ptr, &option, sizeof(option));
+                opt_ptr += sizeof(option);
+
+                if (!(ctl & MSK_ACK) || (tcb->status & STATUS_WSCALE)) {
+                    option = byteorder_htonl(_gnrc_tcp_option_build_wscale(tcb->rcv_wscale));
+                    memcpy(opt_ptr, &option, sizeof(option));
+                    opt_ptr += sizeof(option);
+                }
+                if (!(ctl & MSK_ACK) || (tcb->status & STATUS_SACK)) {
+                    option = byteorder_htonl(_gnrc_tcp_option_build_sack_perm());
+                    memcpy(opt_ptr, &option, sizeof(option));
+                    opt_ptr += sizeof(option);
+                }
+            }
+            /* Add SACK option, most recently changed block first */
+            if (sack_blocks > 0) {
+                network_uint32_t option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(sack_blocks));
+
+                memcpy(opt_ptr, &option, sizeof(option));
+                opt_ptr += sizeof(option);
+
+                for (uint8_t i = 0; i < sack_blocks; i++) {
+                    option = byteorder_htonl(tcb->rcv_sack[i].left);
+                    memcpy(opt_ptr, &option, sizeof(option));
+                    opt_ptr += sizeof(option);
+                    option = byteorder_htonl(tcb->rcv_sack[i].right);
+                    memcpy(opt_ptr, &option, sizeof(option));
+                    opt_ptr += sizeof(option);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
             /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
@@ -287,12 +376,17 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
 
     /* If this is no retransmission, advance sequence number and measure time */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        /* Time one segment at a time */
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_TIMING)) {
+            tcb->status |= STATUS_RTT_TIMING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = evtimer_now_msec();
+        }
     }
     else {
-        tcb->retries += 1;
+        /* Don't use retransmitted segments for RTT measurement (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_TIMING;
     }
 
     /* Pass packet down the network stack */
@@ -382,6 +476,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     gnrc_pktsnip_t *snp = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
+    unsigned pos = 0;
 
     /* No packet received */
     if (pkt == NULL) {
@@ -390,8 +485,30 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Retransmissions are always sent for the oldest unacknowledged segment */
+    if (retransmit) {
+        assert(tcb->pkt_retransmit[0] == pkt);
+        gnrc_pktbuf_hold(pkt, 1);
+
+        /* Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+        _sched_retransmit(tcb);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Check if retransmit queue is full */
+    while ((pos < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) && (tcb->pkt_retransmit[pos] != NULL)) {
+        pos++;
+    }
+    if (pos == CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -409,43 +526,15 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
     }
 
     /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    tcb->pkt_retransmit[pos] = pkt;
+    tcb->pkt_retransmit_flags[pos] = 0;
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
-    }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    /* Start retransmission timer if it is not running already */
+    if (pos == 0) {
+        tcb->rto = _calc_rto(tcb);
+        _sched_retransmit(tcb);
     }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -456,50 +545,92 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
     uint32_t seg = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
+    bool acked = false;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->pkt_retransmit[0] == NULL) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all packets, that are acknowledged completely */
+    while (tcb->pkt_retransmit[0] != NULL) {
+        snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit[0], GNRC_NETTYPE_TCP);
+        hdr = (tcp_hdr_t *) snp->data;
+        seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
+            tcb->pkt_retransmit[0]) - 1;
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(tcb->pkt_retransmit[0]);
+        memmove(&tcb->pkt_retransmit[0], &tcb->pkt_retransmit[1],
+                (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1) * sizeof(gnrc_pktsnip_t *));
+        memmove(&tcb->pkt_retransmit_flags[0], &tcb->pkt_retransmit_flags[1],
+                (CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1) * sizeof(uint8_t));
+        tcb->pkt_retransmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE - 1] = NULL;
+        acked = true;
+    }
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
+    /* If segments were acknowledged -> restart timer and update rto. */
+    if (acked) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        tcb->retries = 0;
+
+        /* Measure round trip time, if the timed segment was acknowledged */
+        if ((tcb->status & STATUS_RTT_TIMING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
+            int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
+
+            tcb->status &= ~STATUS_RTT_TIMING;
+            /* Use time only if there was no timer overflow */
+            if (rtt > 0) {
+                /* If this is the first sample taken */
+                if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+                    tcb->srtt = rtt;
+                    tcb->rtt_var = (rtt >> 1);
+                }
+                /* If this is a subsequent sample */
+                else {
+                    tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+                    tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+                    tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+                    tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+                }
+                tcb->rto = _calc_rto(tcb);
             }
         }
+
+        /* Time the oldest segment still unacknowledged */
+        if (tcb->pkt_retransmit[0] != NULL) {
+            _sched_retransmit(tcb);
+        }
     }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const uint32_t left, const uint32_t right)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE; i++) {
+        gnrc_pktsnip_t *pkt = tcb->pkt_retransmit[i];
+
+        if (pkt == NULL) {
+            break;
+        }
+        gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+        uint32_t seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_seg_len(pkt);
+
+        /* Mark segments that are covered by the block completely */
+        if (LEQ_32_BIT(left, seq) && LEQ_32_BIT(end, right)) {
+            tcb->pkt_retransmit_flags[i] |= RETRANSMIT_SACKED;
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
@@ -18,6 +18,8 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "net/tcp.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -25,6 +27,10 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#if CONFIG_GNRC_TCP_SACK_BLOCKS > TCP_OPTION_SACK_BLOCKS_MAX
+#error "CONFIG_GNRC_TCP_SACK_BLOCKS exceeds the SACK option capacity"
+#endif
+
 /**
  * @brief Receive buffer entry.
  */
@@ -124,3 +130,132 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+/**
+ * @brief Copies data behind the readable part of a ringbuffer without making
+ *        it readable.
+ *
+ * @param[in,out] rb       Ringbuffer to write into.
+ * @param[in]     offset   Offset behind the readable part to write at.
+ * @param[in]     data     Data to write.
+ * @param[in]     len      Number of bytes to write.
+ */
+static void _ringbuffer_write_at(ringbuffer_t *rb, size_t offset, const uint8_t *data,
+                                 size_t len)
+{
+    size_t pos = (rb->start + rb->avail + offset) % rb->size;
+    size_t first = rb->size - pos;
+
+    if (first > len) {
+        first = len;
+    }
+    memcpy(rb->buf + pos, data, first);
+    memcpy(rb->buf, data + first, len - first);
+}
+
+/**
+ * @brief Records received out of order data as SACK block.
+ *
+ * @param[in,out] tcb     TCB holding the SACK blocks.
+ * @param[in]     left    First sequence number of the data.
+ * @param[in]     right   Sequence number following the data.
+ */
+static void _sack_insert(gnrc_tcp_tcb_t *tcb, uint32_t left, uint32_t right)
+{
+    uint8_t i = 0;
+
+    /* Merge with all blocks the data overlaps or touches */
+    while (i < tcb->rcv_sack_num) {
+        gnrc_tcp_sack_block_t *block = &tcb->rcv_sack[i];
+
+        if (LEQ_32_BIT(block->left, right) && LEQ_32_BIT(left, block->right)) {
+            left = LSS_32_BIT(block->left, left) ? block->left : left;
+            right = LSS_32_BIT(right, block->right) ? block->right : right;
+            tcb->rcv_sack_num -= 1;
+            memmove(block, block + 1, (tcb->rcv_sack_num - i) * sizeof(*block));
+            /* The grown block may touch blocks checked before */
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
+
+    /* Most recently changed block first. Discard the oldest block if full. */
+    if (tcb->rcv_sack_num == CONFIG_GNRC_TCP_SACK_BLOCKS) {
+        TCP_DEBUG_INFO("SACK blocks exhausted, discarding oldest block.");
+        tcb->rcv_sack_num -= 1;
+    }
+    memmove(&tcb->rcv_sack[1], &tcb->rcv_sack[0],
+            tcb->rcv_sack_num * sizeof(gnrc_tcp_sack_block_t));
+    tcb->rcv_sack[0].left = left;
+    tcb->rcv_sack[0].right = right;
+    tcb->rcv_sack_num += 1;
+}
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const uint8_t *data,
+                            size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    size_t free = ringbuffer_get_free(rb);
+    size_t offset;
+
+    /* Skip data that was received already */
+    if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+        uint32_t dup = tcb->rcv_nxt - seq;
+
+        if (dup >= len) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+        seq += dup;
+        data += dup;
+        len -= dup;
+    }
+
+    /* Discard data that does not fit into the receive buffer */
+    offset = seq - tcb->rcv_nxt;
+    if (offset >= free) {
+        TCP_DEBUG_INFO("Payload exceeds receive buffer.");
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    if (len > free - offset) {
+        len = free - offset;
+    }
+    _ringbuffer_write_at(rb, offset, data, len);
+
+    /* Out of order data: keep it until the gap in front of it is filled */
+    if (offset > 0) {
+        _sack_insert(tcb, seq, seq + len);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* In order data: Append out of order data that connects to it */
+    uint32_t end = seq + len;
+    uint8_t i = 0;
+
+    while (i < tcb->rcv_sack_num) {
+        gnrc_tcp_sack_block_t *block = &tcb->rcv_sack[i];
+
+        if (LEQ_32_BIT(block->left, end)) {
+            end = LSS_32_BIT(end, block->right) ? block->right : end;
+            tcb->rcv_sack_num -= 1;
+            memmove(block, block + 1, (tcb->rcv_sack_num - i) * sizeof(*block));
+            /* The grown data may touch blocks checked before */
+            i = 0;
+        }
+        else {
+            i++;
+        }
+    }
+
+    /* Make data readable */
+    len = end - tcb->rcv_nxt;
+    rb->avail += len;
+    tcb->rcv_nxt = end;
+    TCP_DEBUG_LEAVE;
+    return len;
+}
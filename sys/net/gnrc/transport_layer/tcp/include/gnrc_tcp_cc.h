@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_tcp
+ *
+ * @{
+ *
+ * @file
+ * @brief       TCP congestion control (NewReno).
+ *
+ * @see [RFC 5681](https://tools.ietf.org/html/rfc5681)
+ * @see [RFC 6582](https://tools.ietf.org/html/rfc6582)
+ *
+ * @author      agent <agent@local>
+ */
+
+#ifndef GNRC_TCP_CC_H
+#define GNRC_TCP_CC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit.
+ */
+#define GNRC_TCP_CC_DUP_THRESH  (3U)
+
+/**
+ * @brief Get the sender maximum segment size (SMSS) of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   The maximum payload size of a segment sent on the connection.
+ */
+uint16_t _gnrc_tcp_cc_smss(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Initialize congestion control state of a connection.
+ *
+ * @note Must be called once the connection is established, so the peers MSS
+ *       is known.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Get the number of bytes that may be sent now.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes the send and congestion window allow to send
+ *            in addition to the data in flight.
+ */
+uint32_t _gnrc_tcp_cc_snd_avail(const gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Update congestion control state on an ACK acknowledging new data.
+ *
+ * @pre tcb->snd_una was already advanced to the received ACK.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ *
+ * @returns   true, if the first unacknowledged segment is considered lost
+ *            and should be retransmitted now.
+ * @returns   false otherwise.
+ */
+bool _gnrc_tcp_cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+/**
+ * @brief Update congestion control state on a duplicate ACK.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ *
+ * @returns   true, if a fast retransmit of the first unacknowledged segment
+ *            should be sent now.
+ * @returns   false otherwise.
+ */
+bool _gnrc_tcp_cc_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Update congestion control state on a retransmission timeout.
+ *
+ * @note Must be called before the retransmission is sent.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GNRC_TCP_CC_H */
+/** @} */
@@ -46,6 +46,20 @@ extern "C" {
 #define STATUS_PASSIVE        (1 << 0)
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
+#define STATUS_RTT_TIMING     (1 << 3)
+#define STATUS_FAST_RECOVERY  (1 << 4)
+#define STATUS_LOSS_RECOVERY  (1 << 5)
+#define STATUS_WSCALE         (1 << 6)
+#define STATUS_SACK           (1 << 7)
+#define STATUS_ACCEPTED       (1 << 8)
+/** @} */
+
+/**
+ * @brief Retransmit queue entry flags
+ * @{
+ */
+#define RETRANSMIT_SACKED     (1 << 0)
+#define RETRANSMIT_RESENT     (1 << 1)
 /** @} */
 
 /**
@@ -42,6 +42,68 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option, prefixed by a NOP
+ *        for alignment.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_wscale(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Helper function to build the SACK permitted option, prefixed by two
+ *        NOPs for alignment.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the kind and length fields of the SACK
+ *        option, prefixed by two NOPs for alignment.
+ *
+ * @param[in] nblocks   Number of SACK blocks following.
+ *
+ * @returns   SACK option header value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t nblocks)
+{
+    assert(0 < nblocks && nblocks <= TCP_OPTION_SACK_BLOCKS_MAX);
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + nblocks * TCP_OPTION_LENGTH_SACK_BLOCK));
+}
+
+/**
+ * @brief Calculate the window scale shift count needed to announce a window.
+ *
+ * @param[in] wnd   Largest window that should be announced.
+ *
+ * @returns   Smallest shift count that fits @p wnd into the 16-bit window field.
+ */
+static inline uint8_t _gnrc_tcp_option_calc_wscale(uint32_t wnd)
+{
+    uint8_t shift = 0;
+
+    while ((wnd >> shift) > UINT16_MAX && shift < TCP_OPTION_WS_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -59,6 +121,9 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
+ * Window scale and SACK permitted options are only evaluated on the SYN that
+ * opens a connection, SACK options only on connections that negotiated SACK.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     hdr   TCP header to be parsed.
  *
@@ -12,7 +12,7 @@
  * @{
  *
  * @file
- * @brief       Functions for allocating and freeing the receive buffer.
+ * @brief       Functions for allocating, freeing and filling the receive buffer.
  *
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
@@ -20,6 +20,8 @@
 #ifndef GNRC_TCP_RCVBUF_H
 #define GNRC_TCP_RCVBUF_H
 
+#include <stddef.h>
+#include <stdint.h>
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -48,6 +50,25 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Store received payload in the receive buffer.
+ *
+ * Payload starting at tcb->rcv_nxt is made available for reading, together
+ * with previously received out of order data it connects to. tcb->rcv_nxt is
+ * advanced accordingly. Payload beyond tcb->rcv_nxt is stored as well and
+ * recorded in tcb->rcv_sack (see RFC 2018). Payload that does not fit into
+ * the free space of the receive buffer is discarded.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     seq    Sequence number of the first byte in @p data.
+ * @param[in]     data   Payload to store.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Number of bytes that became available for reading.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const uint8_t *data,
+                            size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,6 +48,15 @@ static char _stack[GNRC_UDP_STACK_SIZE + THREAD_EXTRA_STACKSIZE_PRINTF];
 static char _stack[GNRC_UDP_STACK_SIZE];
 #endif
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+/**
+ * @brief   Payloads of a received train for the same port, only used while
+ *          handling the train
+ */
+static gnrc_netapi_rx_train_t _rx_train;
+static bool _rx_train_active;
+#endif
+
 /**
  * @brief   Calculate the UDP checksum dependent on the network protocol
  *
@@ -155,6 +164,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
     /* get port (netreg demux context) */
     port = (uint32_t)byteorder_ntohs(hdr->dst_port);
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    if (_rx_train_active && (gnrc_netreg_num(GNRC_NETTYPE_UDP, port) > 0)) {
+        /* pass the payloads of a train on to the receivers as a train */
+        gnrc_netapi_rx_train_add(&_rx_train, GNRC_NETTYPE_UDP, port, pkt);
+        return;
+    }
+#endif
     /* send payload to receivers */
     if (!gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, port, pkt)) {
         DEBUG("udp: unable to forward packet as no one is interested in it\n");
@@ -164,18 +180,19 @@ static void _receive(gnrc_pktsnip_t *pkt)
     }
 }
 
-static void _send(gnrc_pktsnip_t *pkt)
+static gnrc_pktsnip_t *_prepare(gnrc_pktsnip_t *pkt,
+                                 gnrc_nettype_t *target_type)
 {
     udp_hdr_t *hdr;
     gnrc_pktsnip_t *udp_snip, *tmp;
-    gnrc_nettype_t target_type = pkt->type;
 
+    *target_type = pkt->type;
     /* write protect first header */
     tmp = gnrc_pktbuf_start_write(pkt);
     if (tmp == NULL) {
         DEBUG("udp: cannot send packet: unable to allocate packet\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return NULL;
     }
     pkt = tmp;
     udp_snip = tmp->next;
@@ -186,7 +203,7 @@ static void _send(gnrc_pktsnip_t *pkt)
         if (udp_snip == NULL) {
             DEBUG("udp: cannot send packet: unable to allocate packet\n");
             gnrc_pktbuf_release(pkt);
-            return;
+            return NULL;
         }
         tmp->next = udp_snip;
         tmp = udp_snip;
@@ -200,7 +217,7 @@ static void _send(gnrc_pktsnip_t *pkt)
     if (udp_snip == NULL) {
         DEBUG("udp: cannot send packet: unable to allocate packet\n");
         gnrc_pktbuf_release(pkt);
-        return;
+        return NULL;
     }
     tmp->next = udp_snip;
     hdr = (udp_hdr_t *)udp_snip->data;
@@ -208,10 +225,19 @@ static void _send(gnrc_pktsnip_t *pkt)
     hdr->length = byteorder_htons(gnrc_pkt_len(udp_snip));
 
     /* set to IPv6, if first header is netif header */
-    if (target_type == GNRC_NETTYPE_NETIF) {
-        target_type = pkt->next->type;
+    if (*target_type == GNRC_NETTYPE_NETIF) {
+        *target_type = pkt->next->type;
     }
+    return pkt;
+}
+
+static void _send(gnrc_pktsnip_t *pkt)
+{
+    gnrc_nettype_t target_type;
 
+    if ((pkt = _prepare(pkt, &target_type)) == NULL) {
+        return;
+    }
     /* and forward packet to the network layer */
     if (!gnrc_netapi_dispatch_send(target_type, GNRC_NETREG_DEMUX_CTX_ALL,
                                    pkt)) {
@@ -220,6 +246,58 @@ static void _send(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+static void _forward_train(gnrc_nettype_t target_type,
+                           gnrc_pktsnip_t *const *pkts, unsigned numof)
+{
+    if ((numof > 0) &&
+        !gnrc_netapi_dispatch_send_train(target_type, GNRC_NETREG_DEMUX_CTX_ALL,
+                                         pkts, numof)) {
+        DEBUG("udp: cannot send train: network layer not found\n");
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+    }
+}
+
+static void _send_train(gnrc_pktsnip_t *train)
+{
+    gnrc_pktsnip_t *tmp = gnrc_pktbuf_start_write(train);
+    gnrc_pktsnip_t **pkts;
+    gnrc_nettype_t run_type = GNRC_NETTYPE_UNDEF;
+    unsigned start = 0, numof = 0;
+
+    if (tmp == NULL) {
+        DEBUG("udp: unable to write protect train, sending single packets\n");
+        for (unsigned i = 0; i < gnrc_netapi_train_len(train); i++) {
+            _send(gnrc_netapi_train_pkt(train, i));
+        }
+        gnrc_pktbuf_release(train);
+        return;
+    }
+    train = tmp;
+    pkts = train->data;
+    /* prepare the packets in place, dropping those that failed, and forward
+     * every run of packets for the same network layer as one train */
+    for (unsigned i = 0; i < gnrc_netapi_train_len(train); i++) {
+        gnrc_nettype_t target_type;
+        gnrc_pktsnip_t *pkt = _prepare(pkts[i], &target_type);
+
+        if (pkt == NULL) {
+            continue;
+        }
+        if ((numof > start) && (target_type != run_type)) {
+            _forward_train(run_type, &pkts[start], numof - start);
+            start = numof;
+        }
+        run_type = target_type;
+        pkts[numof++] = pkt;
+    }
+    _forward_train(run_type, &pkts[start], numof - start);
+    gnrc_pktbuf_release(train);
+}
+#endif
+
 static void *_event_loop(void *arg)
 {
     (void)arg;
@@ -232,6 +310,9 @@ static void *_event_loop(void *arg)
     reply.content.value = (uint32_t)-ENOTSUP;
     /* initialize message queue */
     msg_init_queue(msg_queue, GNRC_UDP_MSG_QUEUE_SIZE);
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+    netreg.train = true;
+#endif
     /* register UPD at netreg */
     gnrc_netreg_register(GNRC_NETTYPE_UDP, &netreg);
 
@@ -247,6 +328,24 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
                 break;
+#ifdef MODULE_GNRC_NETAPI_TRAIN
+            case GNRC_NETAPI_MSG_TYPE_RCV_TRAIN:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_TRAIN\n");
+                _rx_train_active = true;
+                for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+                    _receive(gnrc_netapi_train_pkt(msg.content.ptr, i));
+                }
+                _rx_train_active = false;
+                gnrc_pktbuf_release(msg.content.ptr);
+                if (_rx_train.numof > 0) {
+                    gnrc_netapi_rx_train_flush(&_rx_train);
+                }
+                break;
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND_TRAIN\n");
+                _send_train(msg.content.ptr);
+                break;
+#endif
             case GNRC_NETAPI_MSG_TYPE_SET:
             case GNRC_NETAPI_MSG_TYPE_GET:
                 msg_reply(&msg, &reply);
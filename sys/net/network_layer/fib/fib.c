@@ -19,11 +19,13 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
 #include <errno.h>
+#include "kernel_defines.h"
 #include "thread.h"
 #include "mutex.h"
 #include "msg.h"
@@ -65,6 +67,105 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+static int fib_remove_from_table(fib_table_t *table, fib_entry_t *entry);
+
+#ifdef MODULE_FIB_RADIX
+static_assert(UNIVERSAL_ADDRESS_SIZE <= CONFIG_PREFIX_TRIE_KEY_SIZE_MAX,
+              "UNIVERSAL_ADDRESS_SIZE too large for radix tree");
+
+/**
+ * @brief checks if the lifetime of an entry expired
+ * @param[in] entry    the entry to check
+ * @param[in] now      the current point in time
+ */
+static inline bool fib_is_expired(const fib_entry_t *entry, uint64_t now)
+{
+    return (entry->lifetime != FIB_LIFETIME_NO_EXPIRE) && (entry->lifetime < now);
+}
+
+/* the radix tree is keyed by the destination address of the entries */
+static const uint8_t *_radix_key(const prefix_trie_t *trie, unsigned idx,
+                                 size_t *size)
+{
+    const fib_table_t *table = container_of(trie, fib_table_t, radix_trie);
+    const universal_address_container_t *global = table->data.entries[idx].global;
+
+    *size = global->address_size;
+    return global->address;
+}
+
+/* prefix length of an entry: an all-zero address is a default route and
+ * entries without a prefix length only match their exact address */
+static unsigned _radix_len(const fib_entry_t *entry)
+{
+    unsigned bits = entry->global->address_size << 3;
+    unsigned len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                   >> FIB_FLAG_NET_PREFIX_SHIFT;
+    bool is_all_zeros_addr = true;
+
+    for (size_t i = 0; i < entry->global->address_size; i++) {
+        if (entry->global->address[i] != 0) {
+            is_all_zeros_addr = false;
+            break;
+        }
+    }
+    if (is_all_zeros_addr) {
+        return 0;
+    }
+    return ((len == 0) || (len > bits)) ? bits : len;
+}
+
+/**
+ * @brief walks the radix tree along the destination address
+ *
+ * @param[in] table     the FIB table to search in
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[in] now       the current point in time
+ * @param[out] res      the entry found
+ * @param[out] expired  an expired entry on the path or NULL. The result is
+ *                      invalid if an expired entry was found.
+ *
+ * @return 1 if we found the exact address
+ *         0 if we found a prefix
+ *         -EHOSTUNREACH if no fitting entry is available
+ */
+static int _radix_lookup(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                         uint64_t now, fib_entry_t **res, fib_entry_t **expired)
+{
+    prefix_trie_iter_t iter;
+    int ret = -EHOSTUNREACH;
+    int idx, len = -1;
+
+    *expired = NULL;
+    prefix_trie_match_init(&table->radix_trie, &iter);
+    while ((idx = prefix_trie_match(&table->radix_trie, dst, dst_size,
+                                    &iter)) >= 0) {
+        fib_entry_t *entry = &table->data.entries[idx];
+
+        if (fib_is_expired(entry, now)) {
+            *expired = entry;
+            return -EHOSTUNREACH;
+        }
+        if (entry->global->address_size != dst_size) {
+            continue;
+        }
+        if (memcmp(entry->global->address, dst, dst_size) == 0) {
+            /* we will not find a better one so we return */
+            *res = entry;
+            return 1;
+        }
+        if ((int)prefix_trie_len(&table->radix_trie, idx) > len) {
+            /* the longest prefix so far */
+            len = prefix_trie_len(&table->radix_trie, idx);
+            *res = entry;
+            ret = 0;
+        }
+    }
+    return ret;
+}
+#endif /* MODULE_FIB_RADIX */
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -83,6 +184,21 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
     uint64_t now = xtimer_now_usec64();
 
+#ifdef MODULE_FIB_RADIX
+    fib_entry_t *expired;
+    int ret;
+
+    do {
+        ret = _radix_lookup(table, dst, dst_size, now, &entry_arr[0], &expired);
+        if (expired != NULL) {
+            /* remove this entry since its lifetime expired and look again */
+            fib_remove_from_table(table, expired);
+        }
+    } while (expired != NULL);
+
+    *entry_arr_size = (ret >= 0) ? 1 : 0;
+    return ret;
+#else /* MODULE_FIB_RADIX */
     size_t count = 0;
     size_t prefix_size = 0;
     size_t match_size = dst_size << 3;
@@ -187,6 +303,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 
     *entry_arr_size = count;
     return ret;
+#endif /* MODULE_FIB_RADIX */
 }
 
 /**
@@ -246,7 +363,18 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+#ifdef MODULE_FIB_RADIX
+    uint64_t now = xtimer_now_usec64();
+#endif
+
     for (size_t i = 0; i < table->size; ++i) {
+#ifdef MODULE_FIB_RADIX
+        /* lookups only remove the expired entries they come across */
+        if ((table->data.entries[i].global != NULL) &&
+            fib_is_expired(&table->data.entries[i], now)) {
+            fib_remove_from_table(table, &table->data.entries[i]);
+        }
+#endif
         if (table->data.entries[i].lifetime == 0) {
 
             table->data.entries[i].global = universal_address_add(dst, dst_size);
@@ -267,6 +395,10 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                 else {
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
+#ifdef MODULE_FIB_RADIX
+                prefix_trie_add(&table->radix_trie, i,
+                                _radix_len(&table->data.entries[i]));
+#endif
 
                 return 0;
             }
@@ -304,6 +436,26 @@ static int fib_remove(fib_entry_t *entry)
     return 0;
 }
 
+/**
+ * @brief removes the given entry of a table, also from its radix tree
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry to be removed
+ *
+ * @return 0 on success
+ */
+static int fib_remove_from_table(fib_table_t *table, fib_entry_t *entry)
+{
+#ifdef MODULE_FIB_RADIX
+    if (entry->global != NULL) {
+        prefix_trie_remove(&table->radix_trie, entry - table->data.entries);
+    }
+#else
+    (void)table;
+#endif
+    return fib_remove(entry);
+}
+
 /**
  * @brief signals (sends a message to) all registered routing protocols
  *        registered with a matching prefix (usually this should be only one).
@@ -457,7 +609,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove_from_table(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +629,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove_from_table(table, &table->data.entries[i]);
         }
     }
 
@@ -538,6 +690,98 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
     return 0;
 }
 
+/**
+ * @brief adds the destination of an entry to a destination set if it
+ *        matches the given prefix
+ *
+ * @param[in] entry         the entry
+ * @param[in] prefix        the prefix to match
+ * @param[in] prefix_size   the prefix size in bytes
+ * @param[out] dst_set      the destination set, may be NULL
+ * @param[in] dst_set_size  the number of elements in dst_set
+ * @param[in] found_entries the number of matching entries found so far
+ *
+ * @return true if the entry matches the prefix
+ */
+static bool fib_add_destination(fib_entry_t *entry, uint8_t *prefix,
+                                size_t prefix_size,
+                                fib_destination_set_entry_t *dst_set,
+                                size_t dst_set_size, size_t found_entries)
+{
+    if ((entry->global == NULL) ||
+        (universal_address_compare_prefix(entry->global, prefix, prefix_size<<3) < UNIVERSAL_ADDRESS_EQUAL)) {
+        return false;
+    }
+    if ((dst_set != NULL) && (found_entries < dst_set_size)) {
+        /* set the size to full byte usage */
+        dst_set[found_entries].dest_size = sizeof(dst_set[found_entries].dest);
+        universal_address_get_address(entry->global,
+                                      dst_set[found_entries].dest,
+                                      &dst_set[found_entries].dest_size);
+    }
+    return true;
+}
+
+#ifdef MODULE_FIB_RADIX
+typedef struct {
+    fib_table_t *table;
+    uint8_t *prefix;
+    size_t prefix_size;
+    fib_destination_set_entry_t *dst_set;
+    size_t dst_set_size;
+    size_t found_entries;
+} _radix_destination_set_t;
+
+static void _radix_add_destination(unsigned idx, void *arg)
+{
+    _radix_destination_set_t *set = arg;
+
+    if (fib_add_destination(&set->table->data.entries[idx], set->prefix,
+                            set->prefix_size, set->dst_set, set->dst_set_size,
+                            set->found_entries)) {
+        set->found_entries++;
+    }
+}
+
+/**
+ * @brief collects the destinations of all entries matching the given prefix
+ *        from the radix tree
+ *
+ * @return the number of matching entries
+ */
+static size_t _radix_destination_set(fib_table_t *table, uint8_t *prefix,
+                                     size_t prefix_size,
+                                     fib_destination_set_entry_t *dst_set,
+                                     size_t dst_set_size)
+{
+    _radix_destination_set_t set = {
+        .table = table,
+        .prefix = prefix,
+        .prefix_size = prefix_size,
+        .dst_set = dst_set,
+        .dst_set_size = dst_set_size,
+    };
+    unsigned pfx_len = 0;
+
+    if (prefix_size > UNIVERSAL_ADDRESS_SIZE) {
+        return 0;
+    }
+    /* the prefix length is given by its last bit set */
+    for (int i = prefix_size - 1; i >= 0; i--) {
+        if (prefix[i] != 0) {
+            pfx_len = (i << 3) + 8;
+            for (uint8_t b = prefix[i]; !(b & 0x01); b >>= 1) {
+                pfx_len--;
+            }
+            break;
+        }
+    }
+    prefix_trie_foreach(&table->radix_trie, prefix, prefix_size, pfx_len,
+                        _radix_add_destination, &set);
+    return set.found_entries;
+}
+#endif /* MODULE_FIB_RADIX */
+
 int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
                             size_t prefix_size,
                             fib_destination_set_entry_t *dst_set,
@@ -547,19 +791,17 @@ int fib_get_destination_set(fib_table_t *table, uint8_t *prefix,
     int ret = -EHOSTUNREACH;
     size_t found_entries = 0;
 
+#ifdef MODULE_FIB_RADIX
+    found_entries = _radix_destination_set(table, prefix, prefix_size,
+                                           dst_set, *dst_set_size);
+#else
     for (size_t i = 0; i < table->size; ++i) {
-        if ((table->data.entries[i].global != NULL) &&
-            (universal_address_compare_prefix(table->data.entries[i].global, prefix, prefix_size<<3) >= UNIVERSAL_ADDRESS_EQUAL)) {
-            if( (dst_set != NULL) && (found_entries < *dst_set_size) ) {
-            /* set the size to full byte usage */
-            dst_set[found_entries].dest_size = sizeof(dst_set[found_entries].dest);
-            universal_address_get_address(table->data.entries[i].global,
-                                          dst_set[found_entries].dest,
-                                          &dst_set[found_entries].dest_size);
-            }
+        if (fib_add_destination(&table->data.entries[i], prefix, prefix_size,
+                                dst_set, *dst_set_size, found_entries)) {
             found_entries++;
         }
     }
+#endif
 
     if (found_entries > *dst_set_size) {
         ret = -ENOBUFS;
@@ -596,6 +838,10 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_RADIX
+        prefix_trie_init(&table->radix_trie, table->radix, table->size,
+                         _radix_key);
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -621,6 +867,10 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_RADIX
+        prefix_trie_init(&table->radix_trie, table->radix, table->size,
+                         _radix_key);
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
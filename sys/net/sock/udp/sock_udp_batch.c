@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_udp
+ * @{
+ *
+ * @file
+ * @brief       Stack independent implementation of sock_udp_recv_batch()
+ *
+ * @author      agent <agent@local>
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include "net/sock/udp.h"
+
+int sock_udp_recv_batch(sock_udp_t *sock, sock_udp_dgram_t *dgrams,
+                        unsigned dgrams_numof, uint32_t timeout)
+{
+    unsigned numof = 0;
+
+    assert((sock != NULL) && (dgrams != NULL) && (dgrams_numof > 0));
+    while (numof < dgrams_numof) {
+        sock_udp_dgram_t *dgram = &dgrams[numof];
+        /* only wait for the first datagram, take the others as long as they
+         * are already queued */
+        ssize_t res = sock_udp_recv(sock, dgram->data, dgram->len,
+                                    (numof == 0) ? timeout : 0, dgram->remote);
+
+        if (res >= 0) {
+            dgram->len = res;
+            numof++;
+        }
+        else if (numof == 0) {
+            return res;
+        }
+        else if ((res != -ENOBUFS) && (res != -EPROTO)) {
+            break;
+        }
+        /* else: the datagram was dropped, try the next one */
+    }
+    return numof;
+}
@@ -0,0 +1,333 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_prefix_trie
+ * @{
+ *
+ * @file
+ * @brief       Prefix trie implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "prefix_trie.h"
+
+static_assert((CONFIG_PREFIX_TRIE_KEY_SIZE_MAX << 3) <= UINT8_MAX,
+              "CONFIG_PREFIX_TRIE_KEY_SIZE_MAX too large for prefix lengths");
+
+static inline prefix_trie_node_t *_node(const prefix_trie_t *trie,
+                                        uint16_t ref)
+{
+    return &trie->nodes[ref - 1];
+}
+
+static inline bool _is_entry(const prefix_trie_t *trie, uint16_t ref)
+{
+    return (ref <= trie->numof);
+}
+
+static inline unsigned _bit(const uint8_t *key, size_t size, unsigned pos)
+{
+    if ((pos >> 3) >= size) {
+        return 0;
+    }
+    return (key[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/* number of leading bits a and b have in common, but at most max */
+static unsigned _match_bits(const uint8_t *a, size_t a_size,
+                            const uint8_t *b, size_t b_size, unsigned max)
+{
+    size_t size = (a_size < b_size) ? a_size : b_size;
+    unsigned bits = 0;
+
+    for (size_t i = 0; (i < size) && (bits < max); i++) {
+        uint8_t xor = a[i] ^ b[i];
+
+        if (xor != 0) {
+            while (!(xor & 0x80)) {
+                xor <<= 1;
+                bits++;
+            }
+            break;
+        }
+        bits += 8;
+    }
+    return (bits > max) ? max : bits;
+}
+
+/* every sub-trie ends in entries, so any one of them carries the prefix of
+ * the sub-trie's root */
+static const uint8_t *_key(const prefix_trie_t *trie, uint16_t ref,
+                           size_t *size)
+{
+    while (!_is_entry(trie, ref)) {
+        ref = _node(trie, ref)->child[0];
+    }
+    return trie->key(trie, ref - 1, size);
+}
+
+static unsigned _match_key(const prefix_trie_t *trie, uint16_t ref,
+                           const uint8_t *key, size_t size, unsigned max)
+{
+    size_t ref_size;
+    const uint8_t *ref_key = _key(trie, ref, &ref_size);
+
+    return _match_bits(ref_key, ref_size, key, size, max);
+}
+
+static uint16_t _branch_alloc(prefix_trie_t *trie)
+{
+    /* branching nodes always have two children, so an unused one is
+     * recognized by its lack of them */
+    for (unsigned i = trie->numof; i < PREFIX_TRIE_NODES_NUMOF(trie->numof);
+         i++) {
+        if (trie->nodes[i].child[0] == 0) {
+            return i + 1;
+        }
+    }
+    /* there are always less branching nodes than entries */
+    assert(false);
+    return 0;
+}
+
+void prefix_trie_init(prefix_trie_t *trie, prefix_trie_node_t *nodes,
+                      unsigned numof, prefix_trie_key_t key)
+{
+    assert(PREFIX_TRIE_NODES_NUMOF(numof) < UINT16_MAX);
+    memset(nodes, 0, PREFIX_TRIE_NODES_NUMOF(numof) * sizeof(*nodes));
+    trie->nodes = nodes;
+    trie->key = key;
+    trie->numof = numof;
+    trie->root = 0;
+}
+
+void prefix_trie_add(prefix_trie_t *trie, unsigned idx, unsigned len)
+{
+    const uint16_t ref = idx + 1;
+    prefix_trie_node_t *node = _node(trie, ref), *tmp_node = NULL;
+    uint16_t *slot = &trie->root;
+    uint16_t tmp = trie->root;
+    size_t size;
+    const uint8_t *key = trie->key(trie, idx, &size);
+    unsigned common;
+
+    assert(len <= UINT8_MAX);
+    memset(node, 0, sizeof(*node));
+    node->len = len;
+    if (tmp == 0) {
+        trie->root = ref;
+        return;
+    }
+    /* find the length of the common prefix with the trie along the path of
+     * key */
+    while ((_node(trie, tmp)->len < len) &&
+           (_node(trie, tmp)->child[_bit(key, size, _node(trie, tmp)->len)] != 0)) {
+        tmp = _node(trie, tmp)->child[_bit(key, size, _node(trie, tmp)->len)];
+    }
+    common = _match_key(trie, tmp, key, size, len);
+    common = (common > _node(trie, tmp)->len) ? _node(trie, tmp)->len : common;
+    /* descend to where key belongs */
+    while ((tmp = *slot) != 0) {
+        tmp_node = _node(trie, tmp);
+        if ((tmp_node->len >= len) || (tmp_node->len > common)) {
+            break;
+        }
+        slot = &tmp_node->child[_bit(key, size, tmp_node->len)];
+    }
+    if (tmp == 0) {
+        *slot = ref;
+    }
+    else if ((common >= len) && (tmp_node->len == len) &&
+             _is_entry(trie, tmp)) {
+        /* same prefix: keep entries ordered by index, the first one is in
+         * the trie */
+        uint16_t *pos = slot;
+
+        while ((*pos != 0) && (*pos < ref)) {
+            pos = &_node(trie, *pos)->dup;
+        }
+        if (pos == slot) {
+            memcpy(node->child, tmp_node->child, sizeof(node->child));
+            memset(tmp_node->child, 0, sizeof(tmp_node->child));
+        }
+        node->dup = *pos;
+        *pos = ref;
+    }
+    else if ((common >= len) && (tmp_node->len == len)) {
+        /* replace branching node with the same prefix */
+        memcpy(node->child, tmp_node->child, sizeof(node->child));
+        memset(tmp_node, 0, sizeof(*tmp_node));
+        *slot = ref;
+    }
+    else if (common >= len) {
+        /* key is a prefix of the sub-trie */
+        size_t tmp_size;
+        const uint8_t *tmp_key = _key(trie, tmp, &tmp_size);
+
+        node->child[_bit(tmp_key, tmp_size, len)] = tmp;
+        *slot = ref;
+    }
+    else {
+        /* key and the sub-trie differ after common bits */
+        uint16_t branch = _branch_alloc(trie);
+        prefix_trie_node_t *branch_node = _node(trie, branch);
+        unsigned bit = _bit(key, size, common);
+
+        branch_node->len = common;
+        branch_node->child[bit] = ref;
+        branch_node->child[!bit] = tmp;
+        *slot = branch;
+    }
+}
+
+void prefix_trie_remove(prefix_trie_t *trie, unsigned idx)
+{
+    const uint16_t ref = idx + 1;
+    prefix_trie_node_t *node = _node(trie, ref);
+    uint16_t *slot = &trie->root, *parent = NULL, *pos;
+    uint16_t tmp;
+    size_t size;
+    const uint8_t *key = trie->key(trie, idx, &size);
+
+    while (((tmp = *slot) != 0) && (_node(trie, tmp)->len < node->len)) {
+        parent = slot;
+        slot = &_node(trie, tmp)->child[_bit(key, size, _node(trie, tmp)->len)];
+    }
+    for (pos = slot; (*pos != 0) && (*pos != ref);
+         pos = &_node(trie, *pos)->dup) {}
+    if (*pos == 0) {
+        /* entry is not in the trie */
+        return;
+    }
+    if (pos != slot) {
+        *pos = node->dup;
+    }
+    else if (node->dup != 0) {
+        /* next entry with the same prefix takes over */
+        memcpy(_node(trie, node->dup)->child, node->child,
+               sizeof(node->child));
+        *slot = node->dup;
+    }
+    else if ((node->child[0] != 0) && (node->child[1] != 0)) {
+        uint16_t branch = _branch_alloc(trie);
+
+        memcpy(_node(trie, branch)->child, node->child, sizeof(node->child));
+        _node(trie, branch)->len = node->len;
+        *slot = branch;
+    }
+    else if ((node->child[0] != 0) || (node->child[1] != 0)) {
+        *slot = node->child[0] | node->child[1];
+    }
+    else {
+        *slot = 0;
+        if ((parent != NULL) && !_is_entry(trie, *parent)) {
+            /* branching node is left with one child, so it is not needed
+             * anymore */
+            prefix_trie_node_t *parent_node = _node(trie, *parent);
+
+            *parent = parent_node->child[0] | parent_node->child[1];
+            memset(parent_node, 0, sizeof(*parent_node));
+        }
+    }
+    memset(node, 0, sizeof(*node));
+}
+
+int prefix_trie_match(const prefix_trie_t *trie, const uint8_t *key,
+                      size_t size, prefix_trie_iter_t *iter)
+{
+    const unsigned bits = size << 3;
+    uint16_t ref;
+
+    if (iter->dup != 0) {
+        ref = iter->dup;
+        iter->dup = _node(trie, ref)->dup;
+        return ref - 1;
+    }
+    while ((ref = iter->next) != 0) {
+        const prefix_trie_node_t *node = _node(trie, ref);
+
+        if (node->len > bits) {
+            break;
+        }
+        iter->next = (node->len < bits) ? node->child[_bit(key, size, node->len)]
+                                        : 0;
+        if (_is_entry(trie, ref)) {
+            if (_match_key(trie, ref, key, size, node->len) < node->len) {
+                /* nothing further down matches either */
+                break;
+            }
+            iter->dup = node->dup;
+            return ref - 1;
+        }
+    }
+    iter->next = 0;
+    return -1;
+}
+
+static void _foreach_dup(const prefix_trie_t *trie, uint16_t ref,
+                         prefix_trie_cb_t cb, void *arg)
+{
+    for (; ref != 0; ref = _node(trie, ref)->dup) {
+        cb(ref - 1, arg);
+    }
+}
+
+void prefix_trie_foreach(const prefix_trie_t *trie, const uint8_t *key,
+                         size_t size, unsigned len, prefix_trie_cb_t cb,
+                         void *arg)
+{
+    /* pending sub-tries, at most one per bit of the key on the path */
+    uint16_t stack[(CONFIG_PREFIX_TRIE_KEY_SIZE_MAX << 3) + 2];
+    unsigned stack_len = 0;
+    uint16_t ref = trie->root;
+
+    assert(size <= CONFIG_PREFIX_TRIE_KEY_SIZE_MAX);
+    /* entries with a shorter prefix may still have a matching key */
+    while ((ref != 0) && (_node(trie, ref)->len < len)) {
+        if (_is_entry(trie, ref)) {
+            for (uint16_t d = ref; d != 0; d = _node(trie, d)->dup) {
+                size_t d_size;
+                const uint8_t *d_key = trie->key(trie, d - 1, &d_size);
+
+                if (_match_bits(d_key, d_size, key, size, len) >= len) {
+                    cb(d - 1, arg);
+                }
+            }
+        }
+        ref = _node(trie, ref)->child[_bit(key, size, _node(trie, ref)->len)];
+    }
+    if ((ref == 0) || (_match_key(trie, ref, key, size, len) < len)) {
+        return;
+    }
+    /* all entries in this sub-trie start with the prefix */
+    stack[stack_len++] = ref;
+    while (stack_len > 0) {
+        const prefix_trie_node_t *node;
+
+        ref = stack[--stack_len];
+        node = _node(trie, ref);
+        if (_is_entry(trie, ref)) {
+            _foreach_dup(trie, ref, cb, arg);
+        }
+        for (int i = 1; i >= 0; i--) {
+            if (node->child[i] != 0) {
+                assert(stack_len < ARRAY_SIZE(stack));
+                stack[stack_len++] = node->child[i];
+            }
+        }
+    }
+}
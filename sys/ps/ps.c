@@ -16,6 +16,7 @@
  */
 
 #include <stdio.h>
+#include <inttypes.h>
 #include <assert.h>
 
 #include "thread.h"
@@ -90,7 +91,11 @@ void ps(void)
            "| stack  ( used) ( free) | base addr  | current     "
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
-           "| runtime  | switches"
+           "| runtime  | switches | vol/invol         "
+           "| max slice  | max lat    "
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+           "| irq off | max irq off"
 #endif
            "\n",
 #ifdef CONFIG_THREAD_NAMES
@@ -142,6 +147,13 @@ void ps(void)
             unsigned runtime_major = runtime_ticks / rt_sum;
             unsigned runtime_minor = ((runtime_ticks % rt_sum) * 1000) / rt_sum;
             unsigned switches = sched_pidlist[i].schedules;
+            schedstat_t stat;
+            schedstatistics_get(i, &stat);
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+            uint64_t irq_off_ticks = stat.irq_off_ticks * 100;
+            unsigned irq_off_major = irq_off_ticks / rt_sum;
+            unsigned irq_off_minor = ((irq_off_ticks % rt_sum) * 1000) / rt_sum;
 #endif
             printf("\t%3" PRIkernel_pid
 #ifdef CONFIG_THREAD_NAMES
@@ -152,7 +164,11 @@ void ps(void)
                    " | %6i (%5i) (%5i) | %10p | %10p "
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
-                   " | %2d.%03d%% |  %8u"
+                   " | %2d.%03d%% |  %8u | %8u/%-8u"
+                   " | %10" PRIu32 " | %10" PRIu32
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+                   " | %2u.%03u%% | %10" PRIu32
 #endif
                    "\n",
                    p->pid,
@@ -165,7 +181,12 @@ void ps(void)
                    (void *)p->stack_start, (void *)p->sp
 #endif
 #ifdef MODULE_SCHEDSTATISTICS
-                   , runtime_major, runtime_minor, switches
+                   , runtime_major, runtime_minor, switches,
+                   stat.voluntary, stat.involuntary,
+                   stat.max_slice, stat.max_latency
+#endif
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+                   , irq_off_major, irq_off_minor, stat.max_irq_off
 #endif
                   );
         }
@@ -183,3 +204,32 @@ void ps(void)
 #   endif
 #endif
 }
+
+#ifdef MODULE_SCHEDSTATISTICS
+void ps_latency(void)
+{
+    printf("\tpid | latency histogram (ticks)\n");
+
+    for (kernel_pid_t i = KERNEL_PID_FIRST; i <= KERNEL_PID_LAST; i++) {
+        if (thread_get(i) == NULL) {
+            continue;
+        }
+
+        schedstat_t stat;
+        schedstatistics_get(i, &stat);
+
+        printf("\t%3" PRIkernel_pid " |", i);
+        for (unsigned b = 0; b < CONFIG_SCHEDSTATISTICS_HIST_NUMOF; b++) {
+            uint32_t limit = schedstatistics_hist_limit(b);
+            if (limit == UINT32_MAX) {
+                printf(" >=%" PRIu32 ": %" PRIu32, schedstatistics_hist_limit(b - 1),
+                       stat.latency_hist[b]);
+            }
+            else {
+                printf(" <%" PRIu32 ": %" PRIu32, limit, stat.latency_hist[b]);
+            }
+        }
+        puts("");
+    }
+}
+#endif
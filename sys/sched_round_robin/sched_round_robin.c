@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling implementation
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+
+#include "irq.h"
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define RR_PRIO_NONE    (0xff)
+
+static void _rr_timeout(void *arg);
+
+static ztimer_t _rr_timer = { .callback = _rr_timeout };
+
+/* priority the slice timer is currently armed for */
+static uint8_t _rr_prio = RR_PRIO_NONE;
+
+/* the runqueues change before ztimer is initialized during boot */
+static bool _rr_initialized;
+
+static inline int _rr_enabled(uint8_t prio)
+{
+    return (prio < SCHED_PRIO_LEVELS) && (SCHED_RR_MASK & (1UL << prio));
+}
+
+/* must be called with interrupts disabled */
+static void _rr_update(void)
+{
+    uint8_t prio = sched_runq_highest_prio();
+
+    if (_rr_enabled(prio) && sched_runq_more_than_one(prio)) {
+        /* keep a running slice, only (re-)arm on priority changes */
+        if (_rr_prio != prio) {
+            DEBUG("sched_rr: slicing priority %u\n", (unsigned)prio);
+            _rr_prio = prio;
+            ztimer_set(SCHED_RR_TIMERBASE, &_rr_timer, SCHED_RR_TIMEOUT);
+        }
+    }
+    else if (_rr_prio != RR_PRIO_NONE) {
+        DEBUG("sched_rr: stop slicing\n");
+        _rr_prio = RR_PRIO_NONE;
+        ztimer_remove(SCHED_RR_TIMERBASE, &_rr_timer);
+    }
+}
+
+static void _rr_timeout(void *arg)
+{
+    (void)arg;
+
+    unsigned state = irq_disable();
+    uint8_t prio = _rr_prio;
+
+    if (prio == RR_PRIO_NONE) {
+        irq_restore(state);
+        return;
+    }
+
+    sched_runq_advance(prio);
+    ztimer_set(SCHED_RR_TIMERBASE, &_rr_timer, SCHED_RR_TIMEOUT);
+    irq_restore(state);
+
+    thread_yield_higher();
+}
+
+void sched_runq_callback(uint8_t prio)
+{
+    if (!_rr_initialized) {
+        return;
+    }
+    /* changes below the sliced priority can't affect slicing */
+    if ((_rr_prio != RR_PRIO_NONE) && (prio > _rr_prio)) {
+        return;
+    }
+    _rr_update();
+}
+
+void sched_round_robin_init(void)
+{
+    unsigned state = irq_disable();
+    _rr_initialized = true;
+    _rr_update();
+    irq_restore(state);
+}
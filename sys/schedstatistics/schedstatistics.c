@@ -21,6 +21,10 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <string.h>
+
+#include "irq.h"
 #include "sched.h"
 #include "schedstatistics.h"
 #include "thread.h"
@@ -28,6 +32,19 @@
 
 schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
 
+static void _record_latency(schedstat_t *stat, uint32_t latency)
+{
+    unsigned bucket = 0;
+
+    while (latency >= schedstatistics_hist_limit(bucket)) {
+        bucket++;
+    }
+    stat->latency_hist[bucket]++;
+    if (latency > stat->max_latency) {
+        stat->max_latency = latency;
+    }
+}
+
 void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
 {
     uint32_t now = xtimer_now().ticks32;
@@ -35,7 +52,22 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
     /* Update active thread stats */
     if (active_thread != KERNEL_PID_UNDEF) {
         schedstat_t *active_stat = &sched_pidlist[active_thread];
-        active_stat->runtime_ticks += now - active_stat->laststart;
+        thread_t *thread = thread_get(active_thread);
+        uint32_t slice = now - active_stat->laststart;
+
+        active_stat->runtime_ticks += slice;
+        if (slice > active_stat->max_slice) {
+            active_stat->max_slice = slice;
+        }
+        /* the thread is still runnable if it was preempted or yielded */
+        if (thread && (thread->status >= STATUS_ON_RUNQUEUE)) {
+            active_stat->involuntary++;
+        }
+        else {
+            active_stat->voluntary++;
+        }
+        /* a wakeup seen while still running doesn't start a latency period */
+        active_stat->woken = 0;
     }
 
     /* Update next_thread stats */
@@ -43,8 +75,127 @@ void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread)
         schedstat_t *next_stat = &sched_pidlist[next_thread];
         next_stat->laststart = now;
         next_stat->schedules++;
+        if (next_stat->woken) {
+            next_stat->woken = 0;
+            _record_latency(next_stat, now - next_stat->lastwakeup);
+        }
+    }
+}
+
+static void _wakeup_cb(kernel_pid_t pid)
+{
+    schedstat_t *stat = &sched_pidlist[pid];
+
+    stat->lastwakeup = xtimer_now().ticks32;
+    stat->woken = 1;
+}
+
+void schedstatistics_get(kernel_pid_t pid, schedstat_t *stat)
+{
+    unsigned state = irq_disable();
+    *stat = sched_pidlist[pid];
+    irq_restore(state);
+}
+
+void schedstatistics_reset_max(kernel_pid_t pid)
+{
+    schedstat_t *stat = &sched_pidlist[pid];
+    unsigned state = irq_disable();
+
+    stat->max_slice = 0;
+    stat->max_latency = 0;
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+    stat->max_irq_off = 0;
+#endif
+    memset(stat->latency_hist, 0, sizeof(stat->latency_hist));
+    irq_restore(state);
+}
+
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+static bool _irq_init;
+/* thread that disabled interrupts, KERNEL_PID_UNDEF if they are enabled (or
+ * disabled in an ISR) */
+static kernel_pid_t _irq_pid = KERNEL_PID_UNDEF;
+/* state that enables interrupts again when restored */
+static unsigned _irq_state;
+static uint32_t _irq_since;
+
+/* xtimer_now() may disable interrupts itself, these nested calls are told
+ * apart by their state as long as _irq_pid is set */
+
+void irq_hook_disabled(unsigned state)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    if (!_irq_init || irq_is_in() || (pid == KERNEL_PID_UNDEF)) {
+        return;
     }
+    /* if already accounting, interrupts were only enabled again in between
+     * if the previous state is the one that enables them, e.g. when switching
+     * to a thread that was preempted. As it is unknown when that happened,
+     * that period is dropped. */
+    if ((_irq_pid != KERNEL_PID_UNDEF) && (state != _irq_state)) {
+        return;
+    }
+    _irq_pid = pid;
+    _irq_state = state;
+    _irq_since = xtimer_now().ticks32;
+}
+
+static void _irq_account(void)
+{
+    uint32_t off = xtimer_now().ticks32 - _irq_since;
+    schedstat_t *stat = &sched_pidlist[_irq_pid];
+
+    _irq_pid = KERNEL_PID_UNDEF;
+    stat->irq_off_ticks += off;
+    if (off > stat->max_irq_off) {
+        stat->max_irq_off = off;
+    }
+}
+
+void irq_hook_restore(unsigned state)
+{
+    if ((_irq_pid != KERNEL_PID_UNDEF) && (state == _irq_state) &&
+        !irq_is_in()) {
+        _irq_account();
+    }
+}
+
+void irq_hook_enable(void)
+{
+    if ((_irq_pid != KERNEL_PID_UNDEF) && !irq_is_in()) {
+        _irq_account();
+    }
+}
+
+#ifndef IRQ_API_INLINED
+/* the architecture's functions are wrapped using the linker */
+unsigned __real_irq_disable(void);
+unsigned __real_irq_enable(void);
+void __real_irq_restore(unsigned state);
+
+unsigned __wrap_irq_disable(void)
+{
+    unsigned state = __real_irq_disable();
+
+    irq_hook_disabled(state);
+    return state;
+}
+
+unsigned __wrap_irq_enable(void)
+{
+    irq_hook_enable();
+    return __real_irq_enable();
+}
+
+void __wrap_irq_restore(unsigned state)
+{
+    irq_hook_restore(state);
+    __real_irq_restore(state);
 }
+#endif /* IRQ_API_INLINED */
+#endif /* MODULE_SCHEDSTATISTICS_IRQ */
 
 void init_schedstatistics(void)
 {
@@ -53,5 +204,9 @@ void init_schedstatistics(void)
     schedstat_t *active_stat = &sched_pidlist[thread_getpid()];
     active_stat->laststart = xtimer_now().ticks32;
     active_stat->schedules = 1;
+    sched_register_wakeup_cb(_wakeup_cb);
     sched_register_cb(sched_statistics_cb);
+#ifdef MODULE_SCHEDSTATISTICS_IRQ
+    _irq_init = true;
+#endif
 }
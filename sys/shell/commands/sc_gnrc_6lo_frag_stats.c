@@ -15,6 +15,7 @@
 
 #include <stdio.h>
 
+#include "net/gnrc/sixlowpan/config.h"
 #include "net/gnrc/sixlowpan/frag/stats.h"
 
 int _gnrc_6lo_frag_stats(int argc, char **argv)
@@ -24,12 +25,22 @@ int _gnrc_6lo_frag_stats(int argc, char **argv)
     (void)argc;
     (void)argv;
     printf("rbuf full: %u\n", stats->rbuf_full);
+    printf("rbuf ints full: %u\n", stats->rbuf_ints_full);
+    printf("rbuf max used: %u/%u\n", stats->rbuf_max_used,
+           CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
     printf("frag full: %u\n", stats->frag_full);
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     printf("VRB full: %u\n", stats->vrb_full);
 #endif
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
+    printf("SFR frag resends (NACK): %u\n", stats->sfr_resends_nack);
+    printf("SFR frag resends (timeout): %u\n", stats->sfr_resends_timeout);
+    printf("SFR dg resends: %u\n", stats->sfr_dg_resends);
+    printf("SFR aborts: %u\n", stats->sfr_aborts);
+    printf("SFR ACKs: %u\n", stats->sfr_acks);
+#endif
     return 0;
 }
 
@@ -24,6 +24,9 @@ int _gnrc_ipv6_frag_stats(int argc, char **argv)
         gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
 
         printf("rbuf full: %u\n", stats->rbuf_full);
+        printf("rbuf max used: %u/%u\n", stats->rbuf_max_used,
+               CONFIG_GNRC_IPV6_EXT_FRAG_RBUF_SIZE);
+        printf("limits full: %u\n", stats->limits_full);
         printf("frag full: %u\n", stats->frag_full);
         printf("frags complete: %u\n", stats->fragments);
         printf("dgs complete: %u\n", stats->datagrams);
@@ -18,12 +18,22 @@
  * @}
  */
 
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
 #include "ps.h"
 
 int _ps_handler(int argc, char **argv)
 {
-    (void) argc;
-    (void) argv;
+    if ((argc > 1) && (strcmp(argv[1], "-l") == 0)) {
+        if (IS_USED(MODULE_SCHEDSTATISTICS)) {
+            ps_latency();
+            return 0;
+        }
+        puts("ps: -l requires module schedstatistics");
+        return 1;
+    }
 
     ps();
 
@@ -20,45 +20,155 @@
  * @}
  */
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "irq.h"
+#include "thread.h"
+#include "trace.h"
 #include "xtimer.h"
 
 #ifndef CONFIG_TRACE_BUFSIZE
 #define CONFIG_TRACE_BUFSIZE 512
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+/* type of an entry that is still being written */
+#define TRACE_EVENT_PENDING     (UINT8_MAX)
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+static trace_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
+static uint32_t tracebuf_pos;
+static bool _clock_ready;
+
+static const char *_type_names[TRACE_EVENT_NUMOF] = {
+    [TRACE_EVENT_USER] = "user",
+    [TRACE_EVENT_SWITCH] = "switch",
+    [TRACE_EVENT_ISR_ENTER] = "isr_enter",
+    [TRACE_EVENT_ISR_EXIT] = "isr_exit",
+    [TRACE_EVENT_MSG_SEND] = "msg_send",
+    [TRACE_EVENT_MSG_RECV] = "msg_recv",
+    [TRACE_EVENT_MUTEX_BLOCK] = "mutex_block",
+    [TRACE_EVENT_MUTEX_UNBLOCK] = "mutex_unblock",
+    [TRACE_EVENT_FLAGS_WAKE] = "flags_wake",
+};
+
+void trace_init(void)
+{
+    _clock_ready = true;
+}
+
+void trace_event(trace_event_type_t type, uint16_t arg, uint32_t val)
+{
+    /* reserve a slot without locking, a preempting ISR just takes the next */
+    uint32_t pos = __atomic_fetch_add(&tracebuf_pos, 1, __ATOMIC_RELAXED);
+    trace_entry_t *entry = &tracebuf[pos % CONFIG_TRACE_BUFSIZE];
+
+    /* the type is written last and marks the entry as complete, so readers
+     * can skip entries of writers they preempted */
+    entry->type = TRACE_EVENT_PENDING;
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    /* kernel tracepoints are hit before the timers are initialized */
+    entry->time = _clock_ready ? xtimer_now_usec() : 0;
+    entry->val = val;
+    entry->arg = arg;
+    entry->pid = thread_getpid();
+    __atomic_signal_fence(__ATOMIC_RELEASE);
+    entry->type = type;
+}
 
 void trace(uint32_t val)
 {
+    trace_event(TRACE_EVENT_USER, 0, val);
+}
+
+/* copies an entry, returns false if it is still being written */
+static bool _read_entry(unsigned idx, trace_entry_t *entry)
+{
+    /* writers only run in ISRs or in threads preempting this one, so with
+     * interrupts disabled the entry can't change while it is copied */
     unsigned state = irq_disable();
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = xtimer_now_usec(), .val = val };
-    tracebuf_pos++;
+    *entry = tracebuf[idx % CONFIG_TRACE_BUFSIZE];
     irq_restore(state);
+    return entry->type != TRACE_EVENT_PENDING;
+}
+
+/* index of the oldest entry and number of entries */
+static unsigned _get_range(unsigned *first)
+{
+    uint32_t pos = __atomic_load_n(&tracebuf_pos, __ATOMIC_RELAXED);
+
+    if (pos > CONFIG_TRACE_BUFSIZE) {
+        *first = pos % CONFIG_TRACE_BUFSIZE;
+        return CONFIG_TRACE_BUFSIZE;
+    }
+    *first = 0;
+    return pos;
 }
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
+    unsigned first;
+    size_t n = _get_range(&first);
     uint32_t t_last = 0;
 
     for (size_t i = 0; i < n; i++) {
-        printf("n=%4lu t=%s%8" PRIu32 " v=0x%08lx\n", (unsigned long)i,
+        trace_entry_t entry;
+
+        if (!_read_entry(first + i, &entry)) {
+            continue;
+        }
+        printf("n=%4lu t=%s%8" PRIu32 " v=0x%08lx", (unsigned long)i,
                i ? "+" : " ",
-               tracebuf[i].time - t_last, (unsigned long)tracebuf[i].val);
-        t_last = tracebuf[i].time;
+               entry.time - t_last, (unsigned long)entry.val);
+        if (entry.type != TRACE_EVENT_USER) {
+            printf(" %s arg=%u pid=%u",
+                   (entry.type < TRACE_EVENT_NUMOF)
+                   ? _type_names[entry.type] : "unknown",
+                   (unsigned)entry.arg, (unsigned)entry.pid);
+        }
+        puts("");
+        t_last = entry.time;
+    }
+}
+
+void trace_dump_binary(void)
+{
+    unsigned first;
+    size_t n = _get_range(&first);
+
+    printf("trace: begin %u\n", (unsigned)n);
+    for (size_t i = 0; i < n; i++) {
+        trace_entry_t entry;
+
+        /* entries still being written are dumped with their type set to
+         * 0xff, which the converter ignores */
+        _read_entry(first + i, &entry);
+        printf("%08" PRIx32 "%08" PRIx32 "%04x%02x%02x\n",
+               entry.time, entry.val, (unsigned)entry.arg,
+               (unsigned)entry.type, (unsigned)entry.pid);
+    }
+    puts("trace: end");
+}
+
+size_t trace_get(trace_entry_t *buf, size_t numof)
+{
+    unsigned first;
+    size_t n = _get_range(&first);
+
+    if (n > numof) {
+        /* keep the most recent entries */
+        first += n - numof;
+        n = numof;
+    }
+    size_t res = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (_read_entry(first + i, &buf[res])) {
+            res++;
+        }
     }
+    return res;
 }
 
 void trace_reset(void)
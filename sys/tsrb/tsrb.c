@@ -17,6 +17,9 @@
  * @}
  */
 
+#include <stdatomic.h>
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -30,6 +33,31 @@ static uint8_t _pop(tsrb_t *rb)
     return rb->buf[rb->reads++ & (rb->size - 1)];
 }
 
+static inline size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/* copy n bytes out of the buffer starting at position pos, using at most two
+ * memcpy() calls for the segments before and after the wrap-around */
+static void _copy_out(const tsrb_t *rb, unsigned pos, uint8_t *dst, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = _min(n, rb->size - idx);
+
+    memcpy(dst, &rb->buf[idx], first);
+    memcpy(dst + first, rb->buf, n - first);
+}
+
+static void _copy_in(tsrb_t *rb, unsigned pos, const uint8_t *src, size_t n)
+{
+    unsigned idx = pos & (rb->size - 1);
+    size_t first = _min(n, rb->size - idx);
+
+    memcpy(&rb->buf[idx], src, first);
+    memcpy(rb->buf, src + first, n - first);
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -43,26 +71,21 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
+    n = _min(n, rb->writes - rb->reads);
+    _copy_out(rb, rb->reads, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
+    n = _min(n, rb->writes - rb->reads);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -79,12 +102,60 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
-    }
+    n = _min(n, rb->size - (rb->writes - rb->reads));
+    _copy_in(rb, rb->writes, src, n);
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
+}
+
+/* The functions below are lock-free for a single producer and a single
+ * consumer. The index owned by the other side is loaded with acquire
+ * semantics, the own index is published with release semantics, so the
+ * buffer contents are visible before the index update is.
+ *
+ * The indices are plain `unsigned` in tsrb_t, as the functions above access
+ * them with interrupts disabled, so they are accessed as atomics here. */
+
+static inline unsigned _load_acquire(unsigned *idx)
+{
+    return atomic_load_explicit((_Atomic unsigned *)idx, memory_order_acquire);
+}
+
+static inline void _store_release(unsigned *idx, unsigned val)
+{
+    atomic_store_explicit((_Atomic unsigned *)idx, val, memory_order_release);
+}
+
+size_t tsrb_peek_contiguous(tsrb_t *rb, uint8_t **data)
+{
+    unsigned writes = _load_acquire(&rb->writes);
+    unsigned reads = rb->reads;
+    unsigned idx = reads & (rb->size - 1);
+
+    *data = &rb->buf[idx];
+    return _min(writes - reads, rb->size - idx);
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= (unsigned)(_load_acquire(&rb->writes) - rb->reads));
+    _store_release(&rb->reads, rb->reads + n);
+}
+
+size_t tsrb_reserve_contiguous(tsrb_t *rb, uint8_t **data)
+{
+    unsigned reads = _load_acquire(&rb->reads);
+    unsigned writes = rb->writes;
+    unsigned idx = writes & (rb->size - 1);
+
+    *data = &rb->buf[idx];
+    return _min(rb->size - (writes - reads), rb->size - idx);
+}
+
+void tsrb_publish(tsrb_t *rb, size_t n)
+{
+    assert(n <= (rb->size - (rb->writes - _load_acquire(&rb->reads))));
+    _store_release(&rb->writes, rb->writes + n);
 }
@@ -47,14 +47,124 @@ static inline uint32_t _min_u32(uint32_t a, uint32_t b)
 }
 #endif
 
+#ifdef MODULE_ZTIMER_HEAP
+/* Pairing heap helpers. The heap root is stored in clock->list.next, its
+ * offset is kept relative to the clock's base (clock->list.offset) just like
+ * the head of the sorted list. */
+
+static ztimer_base_t *_heap_meld(ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (b->target < a->target) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    /* make b the first child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    a->next = NULL;
+    a->prev = NULL;
+
+    return a;
+}
+
+static ztimer_base_t *_heap_merge_pairs(ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+
+    /* first pass: meld siblings pairwise from left to right, collecting the
+     * results in reverse order */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        first = b ? b->next : NULL;
+        a->next = NULL;
+        if (b) {
+            b->next = NULL;
+        }
+        a = _heap_meld(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+
+    /* second pass: meld the results from right to left */
+    ztimer_base_t *root = NULL;
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+        pairs->next = NULL;
+        root = _heap_meld(root, pairs);
+        pairs = next;
+    }
+
+    return root;
+}
+
+static void _heap_update_head(ztimer_clock_t *clock)
+{
+    ztimer_base_t *root = clock->list.next;
+
+    if (root) {
+        root->offset = (root->target > clock->heap_base)
+                       ? (uint32_t)(root->target - clock->heap_base)
+                       : 0;
+    }
+}
+
+static void _heap_remove(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *subtree = _heap_merge_pairs(entry->child);
+
+    if (entry == clock->list.next) {
+        clock->list.next = subtree;
+        if (subtree) {
+            subtree->prev = NULL;
+        }
+    }
+    else {
+        /* unlink entry from its parent or left sibling */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        clock->list.next = _heap_meld(clock->list.next, subtree);
+    }
+
+    /* reset the entry's pointers so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+
+    _heap_update_head(clock);
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
         return 0;
     }
-    else {
-        return (t->base.next || &t->base == clock->last);
-    }
+#ifdef MODULE_ZTIMER_HEAP
+    return (t->base.prev || &t->base == clock->list.next);
+#else
+    return (t->base.next || &t->base == clock->last);
+#endif
 }
 
 void ztimer_remove(ztimer_clock_t *clock, ztimer_t *timer)
@@ -120,6 +230,18 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#ifdef MODULE_ZTIMER_HEAP
+    entry->target = clock->heap_base + entry->offset;
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+    list->next = _heap_meld(list->next, entry);
+    _heap_update_head(clock);
+    DEBUG("_add_entry_to_list() %p target %" PRIu32 "\n", (void *)entry,
+          (uint32_t)entry->target);
+    return;
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -179,6 +301,13 @@ void ztimer_update_head_offset(ztimer_clock_t *clock)
     uint32_t now = ztimer_now(clock);
     uint32_t diff = now - old_base;
 
+#ifdef MODULE_ZTIMER_HEAP
+    clock->heap_base += diff;
+    clock->list.offset = now;
+    _heap_update_head(clock);
+    return;
+#endif
+
     ztimer_base_t *entry = clock->list.next;
 
     DEBUG(
@@ -222,6 +351,10 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
+#ifdef MODULE_ZTIMER_HEAP
+    (void)list;
+    _heap_remove(clock, entry);
+#else
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
@@ -243,6 +376,7 @@ static void _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         }
         list = list->next;
     }
+#endif
 
 #ifdef MODULE_PM_LAYERED
     /* The last timer just got removed from the clock's linked list */
@@ -258,8 +392,13 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
     ztimer_base_t *entry = clock->list.next;
 
     if (entry && (entry->offset == 0)) {
+#ifdef MODULE_ZTIMER_HEAP
+        _heap_remove(clock, entry);
+        if (!clock->list.next) {
+#else
         clock->list.next = entry->next;
         if (!entry->next) {
+#endif
             /* The last timer just got removed from the clock's linked list */
             clock->last = NULL;
 #ifdef MODULE_PM_LAYERED
@@ -346,6 +485,9 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     clock->list.offset += clock->list.next->offset;
+#ifdef MODULE_ZTIMER_HEAP
+    clock->heap_base += clock->list.next->offset;
+#endif
     clock->list.next->offset = 0;
 
     ztimer_t *entry = _now_next(clock);
@@ -375,6 +517,15 @@ void ztimer_handler(ztimer_clock_t *clock)
 
 static void _ztimer_print(const ztimer_clock_t *clock)
 {
+#ifdef MODULE_ZTIMER_HEAP
+    const ztimer_base_t *root = clock->list.next;
+
+    printf("heap base %" PRIu32 ", head %p:%" PRIu32 "\n",
+           (uint32_t)clock->heap_base, (void *)root,
+           root ? root->offset : 0);
+    return;
+#endif
+
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       FIB next hop lookup benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/fib.h"
+#include "net/fib/table.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ROUTES_MAX
+#define ROUTES_MAX      (256U)
+#endif
+
+#ifndef LOOKUPS
+#define LOOKUPS         (10000U)
+#endif
+
+#define ADDR_SIZE       (16U)
+#define NEIGHBORS       (8U)
+#define IFACE           (6)
+
+static fib_entry_t _entries[ROUTES_MAX + 1];
+#ifdef MODULE_FIB_RADIX
+static fib_radix_node_t _radix[FIB_RADIX_NODES_NUMOF(ROUTES_MAX + 1)];
+#endif
+static fib_table_t _table = {
+    .data.entries = _entries,
+    .table_type = FIB_TABLE_TYPE_SH,
+    .size = ROUTES_MAX + 1,
+#ifdef MODULE_FIB_RADIX
+    .radix = _radix,
+#endif
+};
+
+static const unsigned _routes[] = { 16, 64, ROUTES_MAX };
+
+/* 2001:db8::<node> with an EUI-64 based interface identifier */
+static void _node_addr(uint8_t *addr, unsigned node)
+{
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0x20;
+    addr[1] = 0x01;
+    addr[2] = 0x0d;
+    addr[3] = 0xb8;
+    addr[8] = 0x02;
+    addr[11] = 0xff;
+    addr[12] = 0xfe;
+    addr[14] = node >> 8;
+    addr[15] = node;
+}
+
+/* fe80::<neighbor> */
+static void _neighbor_addr(uint8_t *addr, unsigned neighbor)
+{
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0xfe;
+    addr[1] = 0x80;
+    addr[15] = neighbor + 1;
+}
+
+static int _add_route(uint8_t *dst, unsigned prefix_len, unsigned neighbor)
+{
+    uint8_t next_hop[ADDR_SIZE];
+
+    _neighbor_addr(next_hop, neighbor);
+    return fib_add_entry(&_table, IFACE, dst, ADDR_SIZE,
+                         (prefix_len << FIB_FLAG_NET_PREFIX_SHIFT) | FIB_FLAG_RPL_ROUTE,
+                         next_hop, ADDR_SIZE, FIB_FLAG_RPL_ROUTE,
+                         (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+}
+
+int main(void)
+{
+    uint8_t addr[ADDR_SIZE];
+    unsigned added = 0;
+
+    fib_init(&_table);
+    random_init(0x5eed);
+
+    /* default route */
+    memset(addr, 0, sizeof(addr));
+    if (_add_route(addr, 0, 0) < 0) {
+        puts("error: unable to add default route");
+        return 1;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes); i++) {
+        unsigned routes = _routes[i];
+        unsigned found = 0;
+        uint32_t start, diff;
+
+        if (routes <= added) {
+            continue;
+        }
+        for (; added < routes; added++) {
+            _node_addr(addr, added);
+            if (_add_route(addr, 128, added % NEIGHBORS) < 0) {
+                printf("error: unable to add route %u\n", added);
+                return 1;
+            }
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < LOOKUPS; j++) {
+            uint8_t next_hop[ADDR_SIZE];
+            size_t next_hop_size = sizeof(next_hop);
+            uint32_t next_hop_flags;
+            kernel_pid_t iface;
+
+            if (random_uint32_range(0, 10) > 0) {
+                _node_addr(addr, random_uint32_range(0, routes));
+            }
+            else {
+                /* outside of the DODAG */
+                _node_addr(addr, random_uint32_range(0, UINT16_MAX));
+                addr[4] = 0xff;
+            }
+            if (fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                                 &next_hop_flags, addr, ADDR_SIZE, 0) == 0) {
+                found++;
+            }
+        }
+        diff = ztimer_now(ZTIMER_USEC) - start;
+
+        if (found != LOOKUPS) {
+            printf("error: found %u next hops for %u lookups\n", found, LOOKUPS);
+            return 1;
+        }
+        printf("{ \"radix\" : %u, \"routes\" : %u, \"lookup_ns\" : %" PRIu32 " }\n",
+               IS_USED(MODULE_FIB_RADIX), routes,
+               (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+    }
+
+    puts("done");
+
+    return 0;
+}
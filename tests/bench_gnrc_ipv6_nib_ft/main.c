@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       NIB forwarding table lookup benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef ROUTES_MAX
+#define ROUTES_MAX      (1024U)
+#endif
+
+#ifndef LOOKUPS
+#define LOOKUPS         (10000U)
+#endif
+
+#define NEXT_HOPS       (4U)
+#define IFACE           (6U)
+
+static const unsigned _routes[] = { 16, 128, ROUTES_MAX };
+
+/* 2001:db8:<route>::/<48 + (route % 17)> */
+static void _route_pfx(ipv6_addr_t *pfx, unsigned route)
+{
+    memset(pfx, 0, sizeof(*pfx));
+    pfx->u16[0] = byteorder_htons(0x2001);
+    pfx->u16[1] = byteorder_htons(0x0db8);
+    pfx->u16[2] = byteorder_htons(route);
+}
+
+static unsigned _route_pfx_len(unsigned route)
+{
+    return 48 + (route % 17);
+}
+
+static int _add_route(unsigned route)
+{
+    ipv6_addr_t pfx;
+    ipv6_addr_t next_hop = IPV6_ADDR_UNSPECIFIED;
+
+    _route_pfx(&pfx, route);
+    next_hop.u16[0] = byteorder_htons(0xfe80);
+    next_hop.u16[7] = byteorder_htons(1 + (route % NEXT_HOPS));
+    return gnrc_ipv6_nib_ft_add(&pfx, _route_pfx_len(route), &next_hop,
+                                IFACE, 0);
+}
+
+int main(void)
+{
+    unsigned added = 0;
+
+    gnrc_ipv6_nib_init();
+    random_init(0x5eed);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_routes); i++) {
+        unsigned routes = _routes[i];
+        unsigned found = 0;
+        uint32_t start, diff;
+
+        if (routes <= added) {
+            continue;
+        }
+        for (; added < routes; added++) {
+            if (_add_route(added) < 0) {
+                printf("error: unable to add route %u\n", added);
+                return 1;
+            }
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned j = 0; j < LOOKUPS; j++) {
+            gnrc_ipv6_nib_ft_t fte;
+            ipv6_addr_t dst;
+            unsigned route = random_uint32_range(0, routes);
+
+            _route_pfx(&dst, route);
+            dst.u32[2].u32 = random_uint32();
+            dst.u32[3].u32 = random_uint32();
+            if ((gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0) &&
+                (fte.dst_len == _route_pfx_len(route))) {
+                found++;
+            }
+        }
+        diff = ztimer_now(ZTIMER_USEC) - start;
+
+        if (found != LOOKUPS) {
+            printf("error: found %u routes for %u lookups\n", found, LOOKUPS);
+            return 1;
+        }
+        printf("{ \"trie\" : %u, \"routes\" : %u, \"lookup_ns\" : %" PRIu32 " }\n",
+               IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE), routes,
+               (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+    }
+
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    res = child.expect([r"error: [^\n]*",
+                        r"{ \"trie\" : [01], \"routes\" : 16, "
+                        r"\"lookup_ns\" : \d+ }"])
+    assert res == 1, child.after
+    res = child.expect([r"error: [^\n]*", "done"])
+    assert res == 1, child.after
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Network protocol registry lookup benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "random.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ENTRIES_MAX
+#define ENTRIES_MAX     (64U)
+#endif
+
+#ifndef LOOKUPS
+#define LOOKUPS         (10000U)
+#endif
+
+#define PORT_BASE       (49152U)
+
+static msg_t _msg_queue[4];
+static gnrc_netreg_entry_t _entries[ENTRIES_MAX];
+
+static unsigned _dispatch(uint32_t port)
+{
+    gnrc_netreg_entry_t *entry = gnrc_netreg_lookup(GNRC_NETTYPE_UDP, port);
+    unsigned numof = 0;
+
+    while (entry) {
+        numof++;
+        entry = gnrc_netreg_getnext(entry);
+    }
+    return numof;
+}
+
+int main(void)
+{
+    unsigned registered = 0;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    gnrc_netreg_init();
+    random_init(0x5eed);
+
+    for (unsigned entries = 1; entries <= ENTRIES_MAX; entries *= 2) {
+        unsigned found = 0;
+        uint32_t start, diff;
+
+        for (; registered < entries; registered++) {
+            gnrc_netreg_entry_init_pid(&_entries[registered],
+                                       PORT_BASE + registered, thread_getpid());
+            gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[registered]);
+        }
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned i = 0; i < LOOKUPS; i++) {
+            found += _dispatch(PORT_BASE + random_uint32_range(0, entries));
+        }
+        diff = ztimer_now(ZTIMER_USEC) - start;
+
+        if (found != LOOKUPS) {
+            printf("error: found %u receivers for %u lookups\n", found, LOOKUPS);
+            return 1;
+        }
+        printf("{ \"hash\" : %u, \"entries\" : %u, \"lookup_ns\" : %" PRIu32 " }\n",
+               IS_USED(MODULE_GNRC_NETREG_HASH), entries,
+               (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+    }
+
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    entries = 1
+    while entries <= 64:
+        res = child.expect([r"error: [^\n]*",
+                            r"{{ \"hash\" : [01], \"entries\" : {}, "
+                            r"\"lookup_ns\" : \d+ }}".format(entries)])
+        assert res == 1, child.after
+        entries *= 2
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Packet buffer stress benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/gnrc/pktbuf.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+#include "net/gnrc/pktbuf_slab.h"
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (10000U)
+#endif
+
+#ifndef LIVE_NUMOF
+#define LIVE_NUMOF      (4U)
+#endif
+
+#ifndef PAYLOAD_MAX
+#define PAYLOAD_MAX     (1200U)
+#endif
+
+#define SMALL_MAX       (64U)
+#define HDR_LEN         (40U)   /**< e.g. an IPv6 header */
+#define SUBHDR_LEN      (8U)    /**< e.g. a UDP header */
+
+#if defined(MODULE_GNRC_PKTBUF_SLAB)
+#define IMPL            "slab"
+#elif defined(MODULE_GNRC_PKTBUF_MALLOC)
+#define IMPL            "malloc"
+#else
+#define IMPL            "static"
+#endif
+
+static gnrc_pktsnip_t *_live[LIVE_NUMOF];
+
+static gnrc_pktsnip_t *_rx(size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_UNDEF);
+
+    if ((pkt != NULL) && (size > (HDR_LEN + SUBHDR_LEN))) {
+        /* parse headers like the receive path of the network stack does */
+        if ((gnrc_pktbuf_mark(pkt, HDR_LEN, GNRC_NETTYPE_UNDEF) == NULL) ||
+            (gnrc_pktbuf_mark(pkt, SUBHDR_LEN, GNRC_NETTYPE_UNDEF) == NULL)) {
+            gnrc_pktbuf_release(pkt);
+            return NULL;
+        }
+    }
+    return pkt;
+}
+
+int main(void)
+{
+    unsigned failed = 0;
+    uint32_t total = 0, max = 0;
+
+    gnrc_pktbuf_init();
+    random_init(0x5eed);
+
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        unsigned slot = random_uint32_range(0, LIVE_NUMOF);
+        size_t size = (random_uint32() & 1)
+                    ? random_uint32_range(1, SMALL_MAX + 1)
+                    : random_uint32_range(SMALL_MAX + 1, PAYLOAD_MAX + 1);
+        uint32_t start, diff;
+
+        /* release a random packet to make room, so allocations happen
+         * out of order */
+        gnrc_pktbuf_release(_live[slot]);
+        start = ztimer_now(ZTIMER_USEC);
+        _live[slot] = _rx(size);
+        diff = ztimer_now(ZTIMER_USEC) - start;
+        total += diff;
+        if (diff > max) {
+            max = diff;
+        }
+        if (_live[slot] == NULL) {
+            failed++;
+        }
+    }
+
+    printf("{ \"impl\" : \"%s\", \"rounds\" : %u, \"failed\" : %u, "
+           "\"add_ns\" : %" PRIu32 ", \"add_max_us\" : %" PRIu32 " }\n",
+           IMPL, ROUNDS, failed,
+           (uint32_t)(((uint64_t)total * 1000) / ROUNDS), max);
+
+    for (unsigned i = 0; i < LIVE_NUMOF; i++) {
+        gnrc_pktbuf_release(_live[i]);
+    }
+
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+    puts("class  size  numof  max used  failed");
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        gnrc_pktbuf_slab_stats_t stats;
+
+        gnrc_pktbuf_slab_get_stats(i, &stats);
+        printf("%5u  %4u  %5u  %8u  %6u\n", i, stats.size, stats.numof,
+               stats.max_used, stats.failed);
+    }
+#endif
+
+    puts("done");
+
+    return 0;
+}
@@ -29,8 +29,14 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef TEST_BULK_MAX
+#define TEST_BULK_MAX       (16U)
+#endif
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _bulk_stack[THREAD_STACKSIZE_MAIN];
+static const unsigned _batch_sizes[] = { 1, 4, 16 };
 
 static void _timer_callback(void*arg)
 {
@@ -51,6 +57,40 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_bulk_thread(void *arg)
+{
+    (void)arg;
+    msg_t queue[TEST_BULK_MAX];
+    msg_t test[TEST_BULK_MAX];
+
+    msg_init_queue(queue, TEST_BULK_MAX);
+
+    while(1) {
+        msg_receive_bulk(test, TEST_BULK_MAX);
+    }
+
+    return NULL;
+}
+
+static void _bench_bulk(kernel_pid_t other, unsigned batch)
+{
+    xtimer_t timer;
+    timer.callback = _timer_callback;
+
+    msg_t test[TEST_BULK_MAX];
+
+    uint32_t n = 0;
+
+    _flag = 0;
+    xtimer_set(&timer, TEST_DURATION);
+    while(!_flag) {
+        n += msg_send_bulk(test, batch, other);
+    }
+
+    printf("{ \"batch\" : %u, \"msgs_per_sec\" : %"PRIu32" }\n", batch,
+           (uint32_t)(((uint64_t)n * US_PER_SEC) / TEST_DURATION));
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -83,5 +123,19 @@ int main(void)
 #endif
     puts(" }");
 
+    kernel_pid_t bulk = thread_create(_bulk_stack,
+                                      sizeof(_bulk_stack),
+                                      (THREAD_PRIORITY_MAIN - 1),
+                                      THREAD_CREATE_STACKTEST,
+                                      _bulk_thread,
+                                      NULL,
+                                      "bulk_thread");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_batch_sizes); i++) {
+        if (_batch_sizes[i] <= TEST_BULK_MAX) {
+            _bench_bulk(bulk, _batch_sizes[i]);
+        }
+    }
+
     return 0;
 }
@@ -13,6 +13,8 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    for batch in (1, 4, 16):
+        child.expect(r"{ \"batch\" : %d, \"msgs_per_sec\" : \d+ }" % batch)
 
 
 if __name__ == "__main__":
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Mutex priority inversion benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "mutex.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_ITERATIONS
+#define TEST_ITERATIONS     (1000U)
+#endif
+
+#ifndef SPIN_US
+#define SPIN_US             (1000U)
+#endif
+
+enum {
+    PRIO_HIGH   = THREAD_PRIORITY_MAIN - 3,
+    PRIO_MEDIUM = THREAD_PRIORITY_MAIN - 2,
+    PRIO_LOW    = THREAD_PRIORITY_MAIN - 1,
+};
+
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+static char _stack_medium[THREAD_STACKSIZE_DEFAULT];
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+
+static kernel_pid_t _pid_high;
+static kernel_pid_t _pid_medium;
+static kernel_pid_t _pid_low;
+
+static mutex_t _mutex = MUTEX_INIT;
+
+static uint32_t _latency_sum;
+static uint32_t _latency_max;
+
+static void *_high(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        mutex_lock(&_mutex);
+        uint32_t latency = ztimer_now(ZTIMER_USEC) - start;
+        mutex_unlock(&_mutex);
+
+        _latency_sum += latency;
+        if (latency > _latency_max) {
+            _latency_max = latency;
+        }
+    }
+
+    return NULL;
+}
+
+static void *_medium(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        /* busy wait to keep the CPU from lower priority threads */
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        while ((ztimer_now(ZTIMER_USEC) - start) < SPIN_US) {}
+    }
+
+    return NULL;
+}
+
+static void *_low(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        mutex_lock(&_mutex);
+        /* high priority thread preempts us and blocks on the mutex */
+        thread_wakeup(_pid_high);
+        /* medium priority thread preempts us, unless we inherited the
+         * priority of the high priority thread */
+        thread_wakeup(_pid_medium);
+        mutex_unlock(&_mutex);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    printf("spin_us : %u\n", (unsigned)SPIN_US);
+
+    _pid_high = thread_create(_stack_high, sizeof(_stack_high), PRIO_HIGH,
+                              THREAD_CREATE_STACKTEST, _high, NULL, "high");
+    _pid_medium = thread_create(_stack_medium, sizeof(_stack_medium),
+                                PRIO_MEDIUM, THREAD_CREATE_STACKTEST,
+                                _medium, NULL, "medium");
+    _pid_low = thread_create(_stack_low, sizeof(_stack_low), PRIO_LOW,
+                             THREAD_CREATE_STACKTEST, _low, NULL, "low");
+
+    for (unsigned i = 0; i < TEST_ITERATIONS; i++) {
+        /* all other threads have higher priority, so this returns only after
+         * the iteration has been completed */
+        thread_wakeup(_pid_low);
+    }
+
+    printf("{ \"inheritance\" : %u, \"iterations\" : %u, \"avg_us\" : %"
+           PRIu32 ", \"max_us\" : %" PRIu32 " }\n",
+           (unsigned)IS_USED(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE),
+           (unsigned)TEST_ITERATIONS, _latency_sum / TEST_ITERATIONS,
+           _latency_max);
+
+    return 0;
+}
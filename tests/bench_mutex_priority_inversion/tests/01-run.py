@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"spin_us : (\d+)")
+    spin_us = int(child.match.group(1))
+    child.expect(r"{ \"inheritance\" : (\d), \"iterations\" : \d+, "
+                 r"\"avg_us\" : \d+, \"max_us\" : (\d+) }")
+    inheritance = int(child.match.group(1))
+    max_us = int(child.match.group(2))
+    if inheritance:
+        assert max_us < spin_us, "priority inversion not bounded"
+    else:
+        assert max_us >= spin_us, "expected priority inversion"
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
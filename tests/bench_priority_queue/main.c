@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       priority_queue_t benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "priority_queue.h"
+#include "random.h"
+#include "ztimer.h"
+
+#ifndef TEST_MAX_NODES
+#ifdef BOARD_NATIVE
+#define TEST_MAX_NODES      (4000U)
+#else
+#define TEST_MAX_NODES      (1000U)
+#endif
+#endif
+
+#ifndef TEST_PRIO_RANGE
+#define TEST_PRIO_RANGE     (1000000UL)
+#endif
+
+static const unsigned _numof[] = { 10, 100, 1000, 4000 };
+
+static priority_queue_t _queue = PRIORITY_QUEUE_INIT;
+static priority_queue_node_t _nodes[TEST_MAX_NODES];
+
+static uint32_t _ns_per_node(uint32_t start, unsigned numof)
+{
+    return ((ztimer_now(ZTIMER_USEC) - start) * 1000LU) / numof;
+}
+
+static void _add_all(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        priority_queue_add(&_queue, &_nodes[i]);
+    }
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t add_ns, remove_ns, remove_head_ns;
+    uint32_t start;
+
+    for (unsigned i = 0; i < numof; i++) {
+        priority_queue_node_init(&_nodes[i]);
+        _nodes[i].priority = random_uint32_range(0, TEST_PRIO_RANGE);
+        _nodes[i].data = i;
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    _add_all(numof);
+    add_ns = _ns_per_node(start, numof);
+
+    /* remove in an order unrelated to the priority order */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < numof; i++) {
+        priority_queue_remove(&_queue, &_nodes[(i * 7) % numof]);
+    }
+    remove_ns = _ns_per_node(start, numof);
+
+    _add_all(numof);
+    unsigned removed = 0;
+    priority_queue_node_t *node, *last = NULL;
+    start = ztimer_now(ZTIMER_USEC);
+    while ((node = priority_queue_remove_head(&_queue))) {
+        /* nodes were added by index, so ties must leave in that order */
+        if (last && ((node->priority < last->priority) ||
+                     ((node->priority == last->priority) &&
+                      (node->data < last->data)))) {
+            puts("error: nodes not removed in order");
+        }
+        last = node;
+        removed++;
+    }
+    remove_head_ns = _ns_per_node(start, numof);
+
+    if (removed != numof) {
+        printf("error: %u of %u nodes removed\n", removed, numof);
+    }
+
+    printf("{ \"nodes\" : %u, \"add_ns\" : %" PRIu32 ", \"remove_ns\" : %"
+           PRIu32 ", \"remove_head_ns\" : %" PRIu32 " }\n",
+           numof, add_ns, remove_ns, remove_head_ns);
+}
+
+int main(void)
+{
+    printf("priority_queue backend: %s\n",
+           IS_USED(MODULE_CORE_PRIORITY_QUEUE_HEAP) ? "heap" : "list");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        if (_numof[i] <= TEST_MAX_NODES) {
+            _bench(_numof[i]);
+        }
+    }
+
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Reader-writer lock and sequence lock benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "pthread.h"
+#include "rwlock.h"
+#include "seqlock.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TEST_DURATION
+#define TEST_DURATION       (1000000UL)
+#endif
+
+#ifndef TEST_WRITE_INTERVAL
+#define TEST_WRITE_INTERVAL (10000UL)
+#endif
+
+#define DATA_WORDS          (4U)
+
+typedef struct {
+    const char *name;
+    void (*read)(uint32_t *dst);
+    void (*write)(void);
+} variant_t;
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static uint32_t _data[DATA_WORDS];
+
+static mutex_t _mutex = MUTEX_INIT;
+static pthread_rwlock_t _pthread_rwlock;
+static rwlock_t _rwlock = RWLOCK_INIT;
+static seqlock_t _seqlock = SEQLOCK_INIT;
+
+static const variant_t *_variant;
+static volatile bool _done;
+static unsigned _writes;
+
+static void _copy(uint32_t *dst)
+{
+    for (unsigned i = 0; i < DATA_WORDS; i++) {
+        dst[i] = _data[i];
+    }
+}
+
+static void _update(void)
+{
+    for (unsigned i = 0; i < DATA_WORDS; i++) {
+        _data[i]++;
+    }
+}
+
+static void _mutex_read(uint32_t *dst)
+{
+    mutex_lock(&_mutex);
+    _copy(dst);
+    mutex_unlock(&_mutex);
+}
+
+static void _mutex_write(void)
+{
+    mutex_lock(&_mutex);
+    _update();
+    mutex_unlock(&_mutex);
+}
+
+static void _pthread_rwlock_read(uint32_t *dst)
+{
+    pthread_rwlock_rdlock(&_pthread_rwlock);
+    _copy(dst);
+    pthread_rwlock_unlock(&_pthread_rwlock);
+}
+
+static void _pthread_rwlock_write(void)
+{
+    pthread_rwlock_wrlock(&_pthread_rwlock);
+    _update();
+    pthread_rwlock_unlock(&_pthread_rwlock);
+}
+
+static void _rwlock_read(uint32_t *dst)
+{
+    rwlock_read_lock(&_rwlock);
+    _copy(dst);
+    rwlock_read_unlock(&_rwlock);
+}
+
+static void _rwlock_write(void)
+{
+    rwlock_write_lock(&_rwlock);
+    _update();
+    rwlock_write_unlock(&_rwlock);
+}
+
+static void _seqlock_read(uint32_t *dst)
+{
+    unsigned seq;
+
+    do {
+        seq = seqlock_read_begin(&_seqlock);
+        _copy(dst);
+    } while (seqlock_read_retry(&_seqlock, seq));
+}
+
+static void _seqlock_write(void)
+{
+    unsigned state = seqlock_write_begin(&_seqlock);
+    _update();
+    seqlock_write_end(&_seqlock, state);
+}
+
+static const variant_t _variants[] = {
+    { "mutex", _mutex_read, _mutex_write },
+    { "pthread_rwlock", _pthread_rwlock_read, _pthread_rwlock_write },
+    { "rwlock", _rwlock_read, _rwlock_write },
+    { "seqlock", _seqlock_read, _seqlock_write },
+};
+
+static void *_writer(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        ztimer_sleep(ZTIMER_USEC, TEST_WRITE_INTERVAL);
+        if (_variant) {
+            _variant->write();
+            _writes++;
+        }
+    }
+
+    return NULL;
+}
+
+static void _timeout(void *arg)
+{
+    (void)arg;
+    _done = true;
+}
+
+static void _bench(const variant_t *variant)
+{
+    ztimer_t timer = { .callback = _timeout };
+    uint32_t reads = 0;
+    unsigned errors = 0;
+
+    _done = false;
+    _writes = 0;
+    _variant = variant;
+    ztimer_set(ZTIMER_USEC, &timer, TEST_DURATION);
+
+    while (!_done) {
+        uint32_t copy[DATA_WORDS];
+        variant->read(copy);
+        for (unsigned i = 1; i < DATA_WORDS; i++) {
+            if (copy[i] != copy[0]) {
+                errors++;
+                break;
+            }
+        }
+        reads++;
+    }
+    _variant = NULL;
+
+    printf("{ \"lock\" : \"%s\", \"reads\" : %" PRIu32 ", \"writes\" : %u, "
+           "\"errors\" : %u }\n", variant->name, reads, _writes, errors);
+}
+
+int main(void)
+{
+    pthread_rwlock_init(&_pthread_rwlock, NULL);
+
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _writer, NULL, "writer");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_variants); i++) {
+        _bench(&_variants[i]);
+    }
+
+    puts("done");
+
+    return 0;
+}
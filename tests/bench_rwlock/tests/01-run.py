@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for lock in ("mutex", "pthread_rwlock", "rwlock", "seqlock"):
+        child.expect(r"{ \"lock\" : \"%s\", \"reads\" : \d+, "
+                     r"\"writes\" : \d+, \"errors\" : 0 }" % lock)
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
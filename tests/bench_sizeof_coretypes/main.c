@@ -33,6 +33,8 @@
 #include "priority_queue.h"
 #include "ringbuffer.h"
 #include "rmutex.h"
+#include "rwlock.h"
+#include "seqlock.h"
 #ifdef MODULE_CORE_THREAD_FLAGS
 #include "thread_flags.h"
 #endif
@@ -77,6 +79,10 @@ int main(void)
            (unsigned)sizeof(ringbuffer_t));
     printf("sizeof(rmutex_t):               %3u\n",
            (unsigned)sizeof(rmutex_t));
+    printf("sizeof(rwlock_t):               %3u\n",
+           (unsigned)sizeof(rwlock_t));
+    printf("sizeof(seqlock_t):              %3u\n",
+           (unsigned)sizeof(seqlock_t));
 #ifdef MODULE_CORE_THREAD_FLAGS
     printf("sizeof(thread_flags_t):         %3u\n",
            (unsigned)sizeof(thread_flags_t));
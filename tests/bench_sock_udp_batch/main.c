@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for single and batched UDP sock operations
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "timex.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (1000U)
+#endif
+
+#ifndef BATCH_SIZE
+#define BATCH_SIZE      (8U)
+#endif
+
+#ifndef PAYLOAD_LEN
+#define PAYLOAD_LEN     (64U)
+#endif
+
+#define PORT            (5683U)
+
+static sock_udp_t _rx_sock, _tx_sock;
+static uint8_t _tx_buf[BATCH_SIZE][PAYLOAD_LEN];
+static uint8_t _rx_buf[BATCH_SIZE][PAYLOAD_LEN];
+static sock_udp_dgram_t _tx_dgrams[BATCH_SIZE];
+static sock_udp_dgram_t _rx_dgrams[BATCH_SIZE];
+static sock_udp_ep_t _remote = { .family = AF_INET6, .port = PORT };
+
+static unsigned _single(void)
+{
+    unsigned received = 0;
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (sock_udp_send(&_tx_sock, _tx_buf[i], PAYLOAD_LEN, &_remote) < 0) {
+            break;
+        }
+    }
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        if (sock_udp_recv(&_rx_sock, _rx_buf[i], PAYLOAD_LEN, 0, NULL) < 0) {
+            break;
+        }
+        received++;
+    }
+    return received;
+}
+
+static unsigned _batch(void)
+{
+    int res;
+
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        _rx_dgrams[i].data = _rx_buf[i];
+        _rx_dgrams[i].len = PAYLOAD_LEN;
+    }
+    sock_udp_send_batch(&_tx_sock, _tx_dgrams, BATCH_SIZE);
+    res = sock_udp_recv_batch(&_rx_sock, _rx_dgrams, BATCH_SIZE, 0);
+    return (res < 0) ? 0 : (unsigned)res;
+}
+
+static void _run(const char *mode, unsigned (*round)(void))
+{
+    unsigned received = 0;
+    uint32_t start, duration;
+
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < ROUNDS; i++) {
+        received += round();
+    }
+    duration = ztimer_now(ZTIMER_USEC) - start;
+    if (duration == 0) {
+        duration = 1;
+    }
+    printf("{ \"mode\" : \"%s\", \"datagrams\" : %u, \"lost\" : %u, "
+           "\"pps\" : %" PRIu32 " }\n", mode, ROUNDS * BATCH_SIZE,
+           (ROUNDS * BATCH_SIZE) - received,
+           (uint32_t)(((uint64_t)received * US_PER_SEC) / duration));
+}
+
+int main(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6, .port = PORT };
+
+    ipv6_addr_set_loopback((ipv6_addr_t *)&_remote.addr.ipv6);
+    for (unsigned i = 0; i < BATCH_SIZE; i++) {
+        memset(_tx_buf[i], i, PAYLOAD_LEN);
+        _tx_dgrams[i].data = _tx_buf[i];
+        _tx_dgrams[i].len = PAYLOAD_LEN;
+        _tx_dgrams[i].remote = &_remote;
+    }
+    if ((sock_udp_create(&_rx_sock, &local, NULL, 0) < 0) ||
+        (sock_udp_create(&_tx_sock, NULL, NULL, 0) < 0)) {
+        puts("Error creating socks");
+        return 1;
+    }
+
+    _run("single", _single);
+    _run("batch", _batch);
+
+    sock_udp_close(&_tx_sock);
+    sock_udp_close(&_rx_sock);
+
+    puts("done");
+
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Thread safe ringbuffer throughput benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tsrb.h"
+#include "ztimer.h"
+
+#ifndef TEST_BYTES
+#define TEST_BYTES          (256U * 1024U)
+#endif
+
+#ifndef TEST_RB_SIZE
+#define TEST_RB_SIZE        (256U)
+#endif
+
+#ifndef TEST_CHUNK
+#define TEST_CHUNK          (64U)
+#endif
+
+static uint8_t _rb_buf[TEST_RB_SIZE];
+static tsrb_t _rb = TSRB_INIT(_rb_buf);
+static uint8_t _src[TEST_CHUNK];
+static uint8_t _dst[TEST_CHUNK];
+
+static void _byte(void)
+{
+    for (unsigned i = 0; i < TEST_CHUNK; i++) {
+        tsrb_add_one(&_rb, _src[i]);
+    }
+    for (unsigned i = 0; i < TEST_CHUNK; i++) {
+        _dst[i] = tsrb_get_one(&_rb);
+    }
+}
+
+static void _bulk(void)
+{
+    tsrb_add(&_rb, _src, TEST_CHUNK);
+    tsrb_get(&_rb, _dst, TEST_CHUNK);
+}
+
+static void _zerocopy(void)
+{
+    unsigned pos = 0;
+    uint8_t *data;
+    size_t len;
+
+    while (pos < TEST_CHUNK) {
+        len = tsrb_reserve_contiguous(&_rb, &data);
+        len = (len < (TEST_CHUNK - pos)) ? len : (TEST_CHUNK - pos);
+        memcpy(data, &_src[pos], len);
+        tsrb_publish(&_rb, len);
+        pos += len;
+    }
+    pos = 0;
+    while ((len = tsrb_peek_contiguous(&_rb, &data))) {
+        memcpy(&_dst[pos], data, len);
+        tsrb_commit(&_rb, len);
+        pos += len;
+    }
+}
+
+static void _bench(const char *mode, void (*func)(void))
+{
+    memset(_dst, 0, sizeof(_dst));
+    tsrb_init(&_rb, _rb_buf, sizeof(_rb_buf));
+    /* don't start at a chunk aligned position, so wrap-arounds happen */
+    tsrb_add_one(&_rb, 0);
+    tsrb_get_one(&_rb);
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < (TEST_BYTES / TEST_CHUNK); i++) {
+        func();
+    }
+    uint32_t duration = ztimer_now(ZTIMER_USEC) - start;
+
+    if (memcmp(_src, _dst, TEST_CHUNK)) {
+        printf("error: data mismatch in mode %s\n", mode);
+    }
+
+    /* bytes per ms == kbytes per second */
+    printf("{ \"mode\" : \"%s\", \"kbytes_per_sec\" : %" PRIu32 " }\n", mode,
+           (uint32_t)(((uint64_t)TEST_BYTES * 1000) / (duration ? duration : 1)));
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < TEST_CHUNK; i++) {
+        _src[i] = i;
+    }
+
+    _bench("byte", _byte);
+    _bench("bulk", _bulk);
+    _bench("zerocopy", _zerocopy);
+
+    puts("done");
+
+    return 0;
+}
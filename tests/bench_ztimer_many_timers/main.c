@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       ztimer scalability benchmark
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "random.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+
+#ifndef TEST_MAX_TIMERS
+#define TEST_MAX_TIMERS     (1000U)
+#endif
+
+#ifndef TEST_RANGE
+#define TEST_RANGE          (1000000UL)
+#endif
+
+static const unsigned _numof[] = { 10, 100, 1000 };
+
+static ztimer_t _timers[TEST_MAX_TIMERS];
+static uint32_t _offsets[TEST_MAX_TIMERS];
+static unsigned _fired;
+
+static ztimer_mock_t _zmock;
+
+static void _callback(void *arg)
+{
+    (void)arg;
+    _fired++;
+}
+
+static uint32_t _ns_per_timer(uint32_t start, unsigned numof)
+{
+    return ((ztimer_now(ZTIMER_USEC) - start) * 1000LU) / numof;
+}
+
+static void _set_all(unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_set(&_zmock.super, &_timers[i], _offsets[i]);
+    }
+}
+
+static void _bench(unsigned numof)
+{
+    uint32_t set_ns, remove_ns, fire_ns;
+    uint32_t start;
+
+    for (unsigned i = 0; i < numof; i++) {
+        _offsets[i] = random_uint32_range(1, TEST_RANGE);
+    }
+
+    start = ztimer_now(ZTIMER_USEC);
+    _set_all(numof);
+    set_ns = _ns_per_timer(start, numof);
+
+    /* remove in an order unrelated to the trigger order */
+    start = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < numof; i++) {
+        ztimer_remove(&_zmock.super, &_timers[(i * 7) % numof]);
+    }
+    remove_ns = _ns_per_timer(start, numof);
+
+    _set_all(numof);
+    _fired = 0;
+    start = ztimer_now(ZTIMER_USEC);
+    ztimer_mock_advance(&_zmock, TEST_RANGE);
+    fire_ns = _ns_per_timer(start, numof);
+
+    if (_fired != numof) {
+        printf("error: %u of %u timers triggered\n", _fired, numof);
+    }
+
+    printf("{ \"timers\" : %u, \"set_ns\" : %" PRIu32 ", \"remove_ns\" : %"
+           PRIu32 ", \"fire_ns\" : %" PRIu32 " }\n",
+           numof, set_ns, remove_ns, fire_ns);
+}
+
+int main(void)
+{
+    printf("ztimer backend: %s\n",
+           IS_USED(MODULE_ZTIMER_HEAP) ? "heap" : "list");
+
+    ztimer_mock_init(&_zmock, 32);
+    for (unsigned i = 0; i < TEST_MAX_TIMERS; i++) {
+        _timers[i].callback = _callback;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof); i++) {
+        if (_numof[i] <= TEST_MAX_TIMERS) {
+            _bench(_numof[i]);
+        }
+    }
+
+    puts("done");
+
+    return 0;
+}
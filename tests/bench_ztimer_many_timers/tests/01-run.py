@@ -0,0 +1,25 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"ztimer backend: (heap|list)")
+    for timers in (10, 100, 1000):
+        res = child.expect([r"error: [^\n]*",
+                            r"{ \"timers\" : %d, \"set_ns\" : \d+, "
+                            r"\"remove_ns\" : \d+, \"fire_ns\" : \d+ }"
+                            % timers])
+        assert res == 1, child.after
+    child.expect_exact("done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for event multi-queues and deadlines
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "event.h"
+#include "event/deadline.h"
+#include "event/mqueue.h"
+#include "test_utils/expect.h"
+
+#define QUEUES_NUMOF    (8U)
+
+static event_queue_t _queues[QUEUES_NUMOF];
+static event_mqueue_t _mqueue;
+
+static unsigned _handled;
+
+static void _handler(event_t *event)
+{
+    (void)event;
+    _handled++;
+}
+
+static event_t _ev_low = { .handler = _handler };
+static event_t _ev_mid = { .handler = _handler };
+static event_t _ev_high = { .handler = _handler };
+static event_t _ev_high2 = { .handler = _handler };
+static event_deadline_t _ev_dl[4] = {
+    { .super.handler = _handler }, { .super.handler = _handler },
+    { .super.handler = _handler }, { .super.handler = _handler },
+};
+
+static void _test_prio(void)
+{
+    event_mqueue_post(&_mqueue, 7, &_ev_low);
+    event_mqueue_post(&_mqueue, 3, &_ev_mid);
+    event_mqueue_post(&_mqueue, 0, &_ev_high);
+    event_mqueue_post(&_mqueue, 0, &_ev_high2);
+    /* reposting a queued event has no effect */
+    event_mqueue_post(&_mqueue, 0, &_ev_high);
+
+    expect(event_mqueue_get(&_mqueue) == &_ev_high);
+    expect(event_mqueue_get(&_mqueue) == &_ev_high2);
+    expect(event_mqueue_get(&_mqueue) == &_ev_mid);
+    expect(event_mqueue_get(&_mqueue) == &_ev_low);
+    expect(event_mqueue_get(&_mqueue) == NULL);
+    puts("prio: OK");
+}
+
+static void _test_cancel(void)
+{
+    event_mqueue_post(&_mqueue, 1, &_ev_high);
+    event_mqueue_post(&_mqueue, 5, &_ev_low);
+    event_cancel(&_queues[1], &_ev_high);
+
+    expect(event_mqueue_get(&_mqueue) == &_ev_low);
+    expect(event_mqueue_get(&_mqueue) == NULL);
+    expect(_mqueue.pending == 0);
+    puts("cancel: OK");
+}
+
+static void _test_deadline(void)
+{
+    /* deadlines around the wrap around of the 32 bit time base */
+    event_mqueue_post_deadline(&_mqueue, 2, &_ev_dl[0], 0x00000010);
+    event_mqueue_post_deadline(&_mqueue, 2, &_ev_dl[1], 0xfffffff0);
+    event_mqueue_post_deadline(&_mqueue, 2, &_ev_dl[2], 0x00000010);
+    event_mqueue_post_deadline(&_mqueue, 2, &_ev_dl[3], 0xffffff00);
+    event_mqueue_post(&_mqueue, 4, &_ev_low);
+
+    expect(event_mqueue_get(&_mqueue) == &_ev_dl[3].super);
+    expect(event_mqueue_get(&_mqueue) == &_ev_dl[1].super);
+    /* same deadline: FIFO */
+    expect(event_mqueue_get(&_mqueue) == &_ev_dl[0].super);
+    expect(event_mqueue_get(&_mqueue) == &_ev_dl[2].super);
+    expect(event_mqueue_get(&_mqueue) == &_ev_low);
+    expect(event_mqueue_get(&_mqueue) == NULL);
+    puts("deadline: OK");
+}
+
+static void _test_wait(void)
+{
+    event_mqueue_post(&_mqueue, 6, &_ev_low);
+    event_post_deadline(&_queues[0], &_ev_dl[0], 100);
+    /* not posted through the multi-queue, so only seen after the bit of
+     * queue 0 gets set again */
+    event_mqueue_post_deadline(&_mqueue, 0, &_ev_dl[1], 50);
+
+    event_t *event = event_mqueue_wait(&_mqueue);
+    expect(event == &_ev_dl[1].super);
+    event->handler(event);
+    event = event_mqueue_wait(&_mqueue);
+    expect(event == &_ev_dl[0].super);
+    event->handler(event);
+    event = event_mqueue_wait(&_mqueue);
+    expect(event == &_ev_low);
+    event->handler(event);
+    expect(_handled == 3);
+    puts("wait: OK");
+}
+
+int main(void)
+{
+    event_mqueue_init(&_mqueue, _queues, QUEUES_NUMOF);
+
+    _test_prio();
+    _test_cancel();
+    _test_deadline();
+    _test_wait();
+
+    puts("SUCCESS");
+
+    return 0;
+}
@@ -135,7 +135,7 @@ static void test_ipv6_ext_frag_rbuf_free(void)
     rbuf->pkt = pkt;
     gnrc_ipv6_ext_frag_rbuf_free(rbuf);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits_numof);
     TEST_ASSERT_EQUAL_INT(1, pkt->users);
     gnrc_pktbuf_release(pkt);
     TEST_ASSERT(gnrc_pktbuf_is_sane());
@@ -155,7 +155,7 @@ static void test_ipv6_ext_frag_rbuf_del(void)
     gnrc_ipv6_ext_frag_rbuf_del(rbuf);
     TEST_ASSERT_NULL(rbuf->pkt);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits_numof);
     TEST_ASSERT(gnrc_pktbuf_is_sane());
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
@@ -178,7 +178,7 @@ static void test_ipv6_ext_frag_rbuf_gc(void)
     gnrc_ipv6_ext_frag_rbuf_gc();
     TEST_ASSERT_NULL(rbuf->pkt);
     TEST_ASSERT_NULL(rbuf->ipv6);
-    TEST_ASSERT_NULL(rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits_numof);
 }
 
 static void test_ipv6_ext_frag_reass_in_order(void)
@@ -190,7 +190,6 @@ static void test_ipv6_ext_frag_reass_in_order(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
 
     ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
     ipv6->hl = TEST_HL;
@@ -210,13 +209,9 @@ static void test_ipv6_ext_frag_reass_in_order(void)
     TEST_ASSERT_MESSAGE(ipv6 == rbuf->ipv6, "IPv6 header is not the same");
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(!rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits_numof);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, rbuf->limits[0].end);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
 
     /* prepare 2nd fragment */
@@ -244,18 +239,10 @@ static void test_ipv6_ext_frag_reass_in_order(void)
                           rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(!rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    /* adjacent fragments are merged */
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits_numof);
+    TEST_ASSERT_EQUAL_INT(0, rbuf->limits[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, rbuf->limits[0].end);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
 
     /* prepare 3rd fragment */
@@ -300,7 +287,6 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
 
 
     ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
@@ -318,13 +304,9 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(TEST_ID, rbuf->id);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits_numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, rbuf->limits[0].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, rbuf->limits[0].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
                        rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
@@ -351,18 +333,10 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_NOT_NULL(rbuf->pkt);
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    /* adjacent fragments are merged */
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits_numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, rbuf->limits[0].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, rbuf->limits[0].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG2_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG2_OFFSET,
                        rbuf->pkt->size - TEST_FRAG2_OFFSET) == 0);
@@ -409,7 +383,6 @@ static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
     ipv6_hdr_t *ipv6 = ipv6_snip->data;
     ipv6_ext_frag_t *frag = pkt->data;
     gnrc_ipv6_ext_frag_rbuf_t *rbuf;
-    gnrc_ipv6_ext_frag_limits_t *ptr;
     static const uint32_t foreign_id = TEST_ID + 44U;
 
 
@@ -431,13 +404,9 @@ static void test_ipv6_ext_frag_reass_out_of_order_rbuf_full(void)
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), rbuf->pkt->size);
     TEST_ASSERT_EQUAL_INT(foreign_id, rbuf->id);
     TEST_ASSERT(rbuf->last);
-    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(1, rbuf->limits_numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, rbuf->limits[0].start);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, rbuf->limits[0].end);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG3_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG3_OFFSET,
                        rbuf->pkt->size - TEST_FRAG3_OFFSET) == 0);
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the NIB unittests with @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+#include "test_utils/interactive_sync.h"
+#include "xtimer.h"
+
+void tests_gnrc_ipv6_nib(void);
+
+int main(void)
+{
+    /* auto_init is disabled as for the unittests */
+    test_utils_interactive_sync();
+#ifdef MODULE_XTIMER
+    xtimer_init();
+#endif
+
+    TESTS_START();
+    tests_gnrc_ipv6_nib();
+    TESTS_END();
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for dispatching packet trains
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/udp.h"
+#include "thread.h"
+
+#define TRAIN_LEN       (8U)
+#define DEMUX_CTX       (1234U)
+
+typedef struct {
+    gnrc_netreg_entry_t reg;
+    msg_t msg_queue[TRAIN_LEN];
+    gnrc_nettype_t type;
+    uint32_t demux_ctx;
+    bool train;
+    unsigned msgs;
+    unsigned pkts;
+} subscriber_t;
+
+static subscriber_t _train_sub;
+static subscriber_t _single_sub;
+static subscriber_t _ipv6_sub;
+static char _train_stack[THREAD_STACKSIZE_DEFAULT];
+static char _single_stack[THREAD_STACKSIZE_DEFAULT];
+static char _ipv6_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void *_subscriber(void *arg)
+{
+    subscriber_t *sub = arg;
+    msg_t msg;
+
+    msg_init_queue(sub->msg_queue, ARRAY_SIZE(sub->msg_queue));
+    gnrc_netreg_entry_init_pid(&sub->reg, sub->demux_ctx, thread_getpid());
+    sub->reg.train = sub->train;
+    gnrc_netreg_register(sub->type, &sub->reg);
+    while (1) {
+        msg_receive(&msg);
+        switch (msg.type) {
+            case GNRC_NETAPI_MSG_TYPE_SND:
+                sub->msgs++;
+                sub->pkts++;
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+            case GNRC_NETAPI_MSG_TYPE_SND_TRAIN:
+                sub->msgs++;
+                for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+                    sub->pkts++;
+                    gnrc_pktbuf_release(gnrc_netapi_train_pkt(msg.content.ptr, i));
+                }
+                gnrc_pktbuf_release(msg.content.ptr);
+                break;
+            default:
+                puts("unexpected message");
+                break;
+        }
+    }
+    return NULL;
+}
+
+static void _create(subscriber_t *sub, char *stack, size_t stack_size,
+                    gnrc_nettype_t type, uint32_t demux_ctx, bool train,
+                    const char *name)
+{
+    sub->type = type;
+    sub->demux_ctx = demux_ctx;
+    sub->train = train;
+    /* subscribers have a higher priority, so they are registered when created
+     * and are done when dispatching returns */
+    thread_create(stack, stack_size, THREAD_PRIORITY_MAIN - 1, 0, _subscriber,
+                  sub, name);
+}
+
+int main(void)
+{
+    static const ipv6_addr_t dst = IPV6_ADDR_ALL_NODES_LINK_LOCAL;
+    gnrc_pktsnip_t *pkts[TRAIN_LEN];
+    gnrc_netapi_train_stats_t stats;
+
+    _create(&_train_sub, _train_stack, sizeof(_train_stack), GNRC_NETTYPE_UDP,
+            DEMUX_CTX, true, "train");
+    _create(&_single_sub, _single_stack, sizeof(_single_stack),
+            GNRC_NETTYPE_UDP, DEMUX_CTX, false, "single");
+    _create(&_ipv6_sub, _ipv6_stack, sizeof(_ipv6_stack), GNRC_NETTYPE_IPV6,
+            GNRC_NETREG_DEMUX_CTX_ALL, true, "ipv6");
+
+    for (unsigned i = 0; i < TRAIN_LEN; i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, NULL, 16, GNRC_NETTYPE_UDP);
+        if (pkts[i] == NULL) {
+            puts("FAILED: unable to allocate packet");
+            return 1;
+        }
+    }
+    if (gnrc_netapi_dispatch_send_train(GNRC_NETTYPE_UDP, DEMUX_CTX, pkts,
+                                        TRAIN_LEN) != 2) {
+        puts("FAILED: unexpected number of subscribers");
+        return 1;
+    }
+
+    gnrc_netapi_train_stats(&stats);
+    printf("train: %u messages, %u packets\n", _train_sub.msgs, _train_sub.pkts);
+    printf("single: %u messages, %u packets\n", _single_sub.msgs, _single_sub.pkts);
+    printf("dispatch: %u messages, %u packets\n", (unsigned)stats.msgs,
+           (unsigned)stats.pkts);
+
+    /* UDP has to hand a train on to the network layer as a train */
+    for (unsigned i = 0; i < TRAIN_LEN; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, 16,
+                                              GNRC_NETTYPE_UNDEF);
+
+        if ((pkt == NULL) ||
+            ((pkt = gnrc_udp_hdr_build(pkt, DEMUX_CTX, DEMUX_CTX)) == NULL) ||
+            ((pkt = gnrc_ipv6_hdr_build(pkt, NULL, &dst)) == NULL)) {
+            puts("FAILED: unable to allocate packet");
+            return 1;
+        }
+        pkts[i] = pkt;
+    }
+    if (gnrc_netapi_dispatch_send_train(GNRC_NETTYPE_UDP,
+                                        GNRC_NETREG_DEMUX_CTX_ALL, pkts,
+                                        TRAIN_LEN) != 1) {
+        puts("FAILED: UDP not registered");
+        return 1;
+    }
+    printf("ipv6: %u messages, %u packets\n", _ipv6_sub.msgs, _ipv6_sub.pkts);
+
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("FAILED: packet buffer not empty");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
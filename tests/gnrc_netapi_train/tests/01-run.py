@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"train: (\d+) messages?, (\d+) packets")
+    assert int(child.match.group(1)) == 1
+    train_pkts = int(child.match.group(2))
+    child.expect(r"single: (\d+) messages?, (\d+) packets")
+    assert int(child.match.group(1)) == train_pkts
+    assert int(child.match.group(2)) == train_pkts
+    child.expect(r"dispatch: (\d+) messages?, (\d+) packets")
+    assert int(child.match.group(1)) == train_pkts + 1
+    assert int(child.match.group(2)) == 2 * train_pkts
+    child.expect(r"ipv6: (\d+) messages?, (\d+) packets")
+    assert int(child.match.group(1)) == 1
+    assert int(child.match.group(2)) == train_pkts
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,329 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests priority classes and CoDel of the GNRC send queue
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc/netif.h"
+#include "net/gnrc/netif/conf.h"
+#include "net/gnrc/netif/hdr.h"
+#include "net/gnrc/netif/pktq.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "test_utils/expect.h"
+#include "xtimer.h"
+
+#define TEST_PAYLOAD_SIZE   (8U)
+#define TEST_DSCP_EF        (0x2e)
+#define TEST_DSCP_CS6       (0x30)
+/* sojourn time of packets that stood in the queue for too long */
+#define TEST_ABOVE_TARGET   (2U * CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US)
+/* time for the sojourn time to stay above target for a whole interval */
+#define TEST_INTERVAL_PASSED    (CONFIG_GNRC_NETIF_PKTQ_CODEL_INTERVAL_US + \
+                                 CONFIG_GNRC_NETIF_PKTQ_CODEL_TARGET_US)
+
+static gnrc_netif_t _netif;
+
+static void set_up(void)
+{
+    memset(&_netif, 0, sizeof(_netif));
+}
+
+static void tear_down(void)
+{
+    gnrc_pktsnip_t *pkt;
+
+    while ((pkt = gnrc_netif_pktq_get(&_netif))) {
+        gnrc_pktbuf_release(pkt);
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static gnrc_pktsnip_t *_netif_hdr(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *netif_hdr = gnrc_pktbuf_add(pkt, NULL,
+                                                sizeof(gnrc_netif_hdr_t),
+                                                GNRC_NETTYPE_NETIF);
+
+    expect(netif_hdr != NULL);
+    memset(netif_hdr->data, 0, netif_hdr->size);
+    return netif_hdr;
+}
+
+static gnrc_pktsnip_t *_ipv6_pkt(uint8_t dscp, uint8_t nh)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, TEST_PAYLOAD_SIZE,
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *hdr;
+
+    expect(pkt != NULL);
+    pkt = gnrc_pktbuf_add(pkt, NULL, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    expect(pkt != NULL);
+    hdr = pkt->data;
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    ipv6_hdr_set_tc_dscp(hdr, dscp);
+    hdr->nh = nh;
+    return _netif_hdr(pkt);
+}
+
+static gnrc_pktsnip_t *_sixlo_pkt(const uint8_t *data, size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, data, size,
+                                          GNRC_NETTYPE_SIXLOWPAN);
+
+    expect(pkt != NULL);
+    return _netif_hdr(pkt);
+}
+
+static void _put_n(gnrc_pktsnip_t **pkts, unsigned n, uint8_t dscp)
+{
+    for (unsigned i = 0; i < n; i++) {
+        pkts[i] = _ipv6_pkt(dscp, PROTNUM_UDP);
+        expect(gnrc_netif_pktq_put(&_netif, pkts[i]) == 0);
+    }
+}
+
+static void _get_expect(gnrc_pktsnip_t *exp)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_pktq_get(&_netif);
+
+    expect(pkt == exp);
+    gnrc_pktbuf_release(pkt);
+}
+
+static void _test_prio_class(gnrc_pktsnip_t *pkt, unsigned exp)
+{
+    TEST_ASSERT_EQUAL_INT(exp, gnrc_netif_pktq_prio_class(pkt));
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_prio_class__ipv6(void)
+{
+    _test_prio_class(_ipv6_pkt(0, PROTNUM_ICMPV6),
+                     GNRC_NETIF_PKTQ_PRIO_CONTROL);
+    _test_prio_class(_ipv6_pkt(TEST_DSCP_CS6, PROTNUM_UDP),
+                     GNRC_NETIF_PKTQ_PRIO_CONTROL);
+    _test_prio_class(_ipv6_pkt(TEST_DSCP_EF, PROTNUM_UDP),
+                     GNRC_NETIF_PKTQ_PRIO_EXPEDITED);
+    _test_prio_class(_ipv6_pkt(0, PROTNUM_UDP),
+                     GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT);
+}
+
+static void test_prio_class__sixlowpan(void)
+{
+    /* IPHC, TF elided, next header inline */
+    static const uint8_t iphc_icmpv6[] = { 0x7a, 0x33, PROTNUM_ICMPV6 };
+    /* IPHC, ECN + DSCP inline, next header inline */
+    static const uint8_t iphc_ef[] = { 0x72, 0x33, TEST_DSCP_EF, PROTNUM_UDP };
+    /* first fragment of the above */
+    static const uint8_t frag1_ef[] = { 0xc0, 0x50, 0x00, 0x01,
+                                        0x72, 0x33, TEST_DSCP_EF, PROTNUM_UDP };
+    /* IPHC, TF elided, next header compressed via NHC */
+    static const uint8_t iphc_nhc[] = { 0x7e, 0x33, 0xf0, 0x00, 0x00 };
+    /* subsequent fragment */
+    static const uint8_t fragn[] = { 0xe0, 0x50, 0x00, 0x01, 0x05, 0x00 };
+
+    _test_prio_class(_sixlo_pkt(iphc_icmpv6, sizeof(iphc_icmpv6)),
+                     GNRC_NETIF_PKTQ_PRIO_CONTROL);
+    _test_prio_class(_sixlo_pkt(iphc_ef, sizeof(iphc_ef)),
+                     GNRC_NETIF_PKTQ_PRIO_EXPEDITED);
+    _test_prio_class(_sixlo_pkt(frag1_ef, sizeof(frag1_ef)),
+                     GNRC_NETIF_PKTQ_PRIO_EXPEDITED);
+    _test_prio_class(_sixlo_pkt(iphc_nhc, sizeof(iphc_nhc)),
+                     GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT);
+    _test_prio_class(_sixlo_pkt(fragn, sizeof(fragn)),
+                     GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT);
+}
+
+static void test_prio__order(void)
+{
+    gnrc_pktsnip_t *be, *ef, *ctrl;
+    const gnrc_netif_pktq_stats_t *stats = _netif.send_queue.stats;
+
+    _put_n(&be, 1, 0);
+    _put_n(&ef, 1, TEST_DSCP_EF);
+    _put_n(&ctrl, 1, TEST_DSCP_CS6);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_CONTROL].len);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_EXPEDITED].len);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].len);
+    _get_expect(ctrl);
+    _get_expect(ef);
+    _get_expect(be);
+    TEST_ASSERT(gnrc_netif_pktq_empty(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].len);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].max_len);
+}
+
+static void test_prio__push_back(void)
+{
+    gnrc_pktsnip_t *be[2], *ef;
+
+    _put_n(be, 2, 0);
+    TEST_ASSERT(be[0] == gnrc_netif_pktq_get(&_netif));
+    _put_n(&ef, 1, TEST_DSCP_EF);
+    /* a pushed back packet is still sent after higher classes */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, be[0]));
+    _get_expect(ef);
+    _get_expect(be[0]);
+    _get_expect(be[1]);
+}
+
+static void test_prio__evict(void)
+{
+    gnrc_pktsnip_t *be[CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE], *ctrl, *pkt;
+    const gnrc_netif_pktq_stats_t *stats = _netif.send_queue.stats;
+
+    _put_n(be, CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE, 0);
+    /* the last best effort packet makes room for the control packet */
+    _put_n(&ctrl, 1, TEST_DSCP_CS6);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].evicted);
+    /* but a best effort packet is not queued */
+    pkt = _ipv6_pkt(0, PROTNUM_UDP);
+    TEST_ASSERT_EQUAL_INT(-1, gnrc_netif_pktq_put(&_netif, pkt));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].full);
+    _get_expect(ctrl);
+    for (unsigned i = 0; i < (CONFIG_GNRC_NETIF_PKTQ_POOL_SIZE - 1); i++) {
+        _get_expect(be[i]);
+    }
+    TEST_ASSERT_NULL(gnrc_netif_pktq_get(&_netif));
+}
+
+static void test_codel__below_target(void)
+{
+    gnrc_pktsnip_t *be[3];
+    const gnrc_netif_pktq_stats_t *stats = _netif.send_queue.stats;
+
+    _put_n(be, 3, 0);
+    for (unsigned i = 0; i < 3; i++) {
+        _get_expect(be[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].aqm_drops);
+}
+
+static void test_codel__congestion(void)
+{
+    gnrc_pktsnip_t *be[4];
+    const gnrc_netif_pktq_stats_t *stats = _netif.send_queue.stats;
+
+    _put_n(be, 4, 0);
+    xtimer_usleep(TEST_ABOVE_TARGET);
+    /* sojourn time is above target, but not yet for a whole interval */
+    _get_expect(be[0]);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].aqm_drops);
+    xtimer_usleep(TEST_INTERVAL_PASSED);
+    /* it now is, so CoDel starts dropping */
+    _get_expect(be[2]);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].aqm_drops);
+    TEST_ASSERT(_netif.send_queue.codel[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].dropping);
+    /* the last packet in the queue is never dropped */
+    _get_expect(be[3]);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].aqm_drops);
+    TEST_ASSERT(!_netif.send_queue.codel[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT].dropping);
+}
+
+static void test_codel__count_saturates(void)
+{
+    gnrc_pktsnip_t *be[6], *pkt;
+    gnrc_netif_pktq_codel_t *codel =
+        &_netif.send_queue.codel[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT];
+
+    _put_n(be, 6, 0);
+    xtimer_usleep(TEST_ABOVE_TARGET);
+    _get_expect(be[0]);
+    xtimer_usleep(TEST_INTERVAL_PASSED);
+    _get_expect(be[2]);
+    TEST_ASSERT(codel->dropping);
+    /* pretend CoDel was dropping for a very long time */
+    codel->count = UINT32_MAX;
+    codel->drop_next = xtimer_now_usec();
+    pkt = gnrc_netif_pktq_get(&_netif);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(codel->count == UINT32_MAX);
+}
+
+static void test_codel__per_class(void)
+{
+    gnrc_pktsnip_t *be[2], *ef[2];
+    const gnrc_netif_pktq_stats_t *stats = _netif.send_queue.stats;
+
+    _put_n(be, 2, 0);
+    xtimer_usleep(TEST_ABOVE_TARGET);
+    _get_expect(be[0]);
+    xtimer_usleep(TEST_INTERVAL_PASSED);
+    /* the fresh expedited packets do not suffer from the standing best
+     * effort queue */
+    _put_n(ef, 2, TEST_DSCP_EF);
+    _get_expect(ef[0]);
+    _get_expect(ef[1]);
+    _get_expect(be[1]);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_NETIF_PKTQ_PRIO_EXPEDITED].aqm_drops);
+}
+
+static void test_codel__push_back(void)
+{
+    gnrc_pktsnip_t *be[3];
+    gnrc_netif_pktq_codel_t *codel =
+        &_netif.send_queue.codel[GNRC_NETIF_PKTQ_PRIO_BEST_EFFORT];
+
+    _put_n(be, 3, 0);
+    xtimer_usleep(TEST_ABOVE_TARGET);
+    _get_expect(be[0]);
+    TEST_ASSERT(codel->first_above_time != 0);
+    /* the device is busy, so the packet is pushed back */
+    TEST_ASSERT(be[1] == gnrc_netif_pktq_get(&_netif));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netif_pktq_push_back(&_netif, be[1]));
+    /* it keeps its sojourn time, which is still above target */
+    _get_expect(be[1]);
+    TEST_ASSERT(codel->first_above_time != 0);
+    _get_expect(be[2]);
+}
+
+static Test *tests_gnrc_netif_pktq_aqm(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_prio_class__ipv6),
+        new_TestFixture(test_prio_class__sixlowpan),
+        new_TestFixture(test_prio__order),
+        new_TestFixture(test_prio__push_back),
+        new_TestFixture(test_prio__evict),
+        new_TestFixture(test_codel__below_target),
+        new_TestFixture(test_codel__congestion),
+        new_TestFixture(test_codel__count_saturates),
+        new_TestFixture(test_codel__per_class),
+        new_TestFixture(test_codel__push_back),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_netif_pktq_aqm());
+    TESTS_END();
+    return 0;
+}
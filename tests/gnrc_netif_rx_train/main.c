@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for passing a burst of received frames up the stack as
+ *              packet trains
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/ethernet.h"
+#include "net/ethertype.h"
+#include "net/gnrc.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define FRAMES_NUMOF        (6U)
+#define PORT_A              (0x2c94)
+#define PORT_B              (0xa615)
+#define TIMEOUT             (1000000U)
+
+typedef struct __attribute__((packed)) {
+    ethernet_hdr_t eth;
+    ipv6_hdr_t ipv6;
+    udp_hdr_t udp;
+    uint8_t payload;
+} frame_t;
+
+static const uint8_t _addr[] = { 0xce, 0xab, 0xfe, 0xad, 0xf7, 0x26 };
+static const uint8_t _nbr_addr[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+static const uint8_t _all_nodes_addr[] = { 0x33, 0x33, 0x00, 0x00, 0x00, 0x01 };
+static const ipv6_addr_t _nbr_link_local = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00
+    } };
+
+static frame_t _frames[FRAMES_NUMOF];
+static unsigned _rx_next = FRAMES_NUMOF;
+static gnrc_netif_t _netif;
+static netdev_test_t _netdev;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static void _build_frame(frame_t *frame, uint16_t port, uint8_t payload)
+{
+    const uint16_t len = sizeof(frame->udp) + sizeof(frame->payload);
+    uint16_t csum;
+
+    memset(frame, 0, sizeof(*frame));
+    memcpy(frame->eth.dst, _all_nodes_addr, sizeof(frame->eth.dst));
+    memcpy(frame->eth.src, _nbr_addr, sizeof(frame->eth.src));
+    frame->eth.type = byteorder_htons(ETHERTYPE_IPV6);
+    ipv6_hdr_set_version(&frame->ipv6);
+    frame->ipv6.len = byteorder_htons(len);
+    frame->ipv6.nh = PROTNUM_UDP;
+    frame->ipv6.hl = 64;
+    frame->ipv6.src = _nbr_link_local;
+    frame->ipv6.dst = ipv6_addr_all_nodes_link_local;
+    frame->udp.src_port = byteorder_htons(PORT_A);
+    frame->udp.dst_port = byteorder_htons(port);
+    frame->udp.length = byteorder_htons(len);
+    frame->payload = payload;
+    csum = ipv6_hdr_inet_csum(0, &frame->ipv6, PROTNUM_UDP, len);
+    csum = ~inet_csum(csum, (uint8_t *)&frame->udp, len);
+    frame->udp.checksum = byteorder_htons((csum == 0) ? 0xffff : csum);
+}
+
+static int _netdev_recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (_rx_next >= FRAMES_NUMOF) {
+        return 0;
+    }
+    if (buf == NULL) {
+        if (len > 0) {
+            /* drop frame */
+            _rx_next++;
+        }
+        return sizeof(frame_t);
+    }
+    if ((unsigned)len < sizeof(frame_t)) {
+        return -ENOBUFS;
+    }
+    memcpy(buf, &_frames[_rx_next++], sizeof(frame_t));
+    return sizeof(frame_t);
+}
+
+static void _netdev_isr(netdev_t *dev)
+{
+    /* the whole burst is ready with one interrupt, as with a device that
+     * buffers multiple frames */
+    while (_rx_next < FRAMES_NUMOF) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_addr));
+    memcpy(value, _addr, sizeof(_addr));
+    return sizeof(_addr);
+}
+
+static bool _recv(sock_udp_t *sock, uint16_t port, uint8_t first)
+{
+    uint8_t data[FRAMES_NUMOF];
+    sock_udp_ep_t remote[FRAMES_NUMOF];
+    sock_udp_dgram_t dgrams[FRAMES_NUMOF];
+    int res;
+
+    for (unsigned i = 0; i < FRAMES_NUMOF; i++) {
+        dgrams[i] = (sock_udp_dgram_t){ .data = &data[i], .len = 1,
+                                        .remote = &remote[i] };
+    }
+    res = sock_udp_recv_batch(sock, dgrams, FRAMES_NUMOF, TIMEOUT);
+    printf("port 0x%04x: %d datagrams\n", port, res);
+    for (int i = 0; i < res; i++) {
+        if ((dgrams[i].len != 1) || (data[i] != first + i) ||
+            !ipv6_addr_equal((ipv6_addr_t *)&remote[i].addr,
+                             &_nbr_link_local) ||
+            (remote[i].port != PORT_A)) {
+            printf("FAILED: unexpected datagram %d\n", i);
+            return false;
+        }
+    }
+    return res > 0;
+}
+
+int main(void)
+{
+    const sock_udp_ep_t local_a = { .family = AF_INET6, .port = PORT_A };
+    const sock_udp_ep_t local_b = { .family = AF_INET6, .port = PORT_B };
+    gnrc_netapi_train_stats_t before, after;
+    sock_udp_t sock_a, sock_b;
+
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_recv_cb(&_netdev, _netdev_recv);
+    netdev_test_set_isr_cb(&_netdev, _netdev_isr);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack,
+                                      sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                      "mock_eth", &_netdev.netdev) == 0);
+    expect(sock_udp_create(&sock_a, &local_a, NULL, 0) == 0);
+    expect(sock_udp_create(&sock_b, &local_b, NULL, 0) == 0);
+
+    /* the first half of the burst goes to port A, the second to port B */
+    for (unsigned i = 0; i < FRAMES_NUMOF; i++) {
+        _build_frame(&_frames[i], (i < (FRAMES_NUMOF / 2)) ? PORT_A : PORT_B,
+                     i);
+    }
+    gnrc_netapi_train_stats(&before);
+    _rx_next = 0;
+    netdev_trigger_event_isr(&_netdev.netdev);
+
+    if (!_recv(&sock_a, PORT_A, 0) ||
+        !_recv(&sock_b, PORT_B, FRAMES_NUMOF / 2)) {
+        return 1;
+    }
+    gnrc_netapi_train_stats(&after);
+    printf("dispatch: %u messages, %u packets\n",
+           (unsigned)(after.msgs - before.msgs),
+           (unsigned)(after.pkts - before.pkts));
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("FAILED: packet buffer not empty");
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
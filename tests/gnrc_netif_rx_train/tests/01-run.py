@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("port 0x2c94: 3 datagrams")
+    child.expect_exact("port 0xa615: 3 datagrams")
+    child.expect(r"dispatch: (\d+) messages?, (\d+) packets")
+    # netif -> IPv6, IPv6 -> UDP and UDP -> one per socket
+    assert int(child.match.group(1)) == 4
+    assert int(child.match.group(2)) == 3 * 6
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the netreg unittests with module `gnrc_netreg_hash`
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+#include "test_utils/interactive_sync.h"
+
+void tests_netreg(void);
+
+int main(void)
+{
+    /* auto_init is disabled as for the unittests */
+    test_utils_interactive_sync();
+
+    TESTS_START();
+    tests_netreg();
+    TESTS_END();
+
+    return 0;
+}
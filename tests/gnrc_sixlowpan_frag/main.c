@@ -235,10 +235,9 @@ static void _test_entry(const gnrc_sixlowpan_frag_rb_t *entry,
                         "entry->super.dst != TEST_NETIF_HDR_DST");
     TEST_ASSERT_EQUAL_INT(TEST_TAG, entry->super.tag);
     TEST_ASSERT_EQUAL_INT(exp_current_size, entry->super.current_size);
-    TEST_ASSERT_NOT_NULL(entry->super.ints);
-    TEST_ASSERT_NULL(entry->super.ints->next);
-    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->super.ints->start);
-    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->super.ints->end);
+    TEST_ASSERT_EQUAL_INT(1, entry->ints_numof);
+    TEST_ASSERT_EQUAL_INT(exp_int_start, entry->ints[0].start);
+    TEST_ASSERT_EQUAL_INT(exp_int_end, entry->ints[0].end);
 }
 
 static void _check_pktbuf(const gnrc_sixlowpan_frag_rb_t *entry)
@@ -383,6 +382,40 @@ static void test_rbuf_add__success_complete(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__merge_intervals(void)
+{
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, _fragment1, sizeof(_fragment1),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, _fragment2, sizeof(_fragment2),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    gnrc_pktsnip_t *pkt3 = gnrc_pktbuf_add(NULL, _fragment3, sizeof(_fragment3),
+                                           GNRC_NETTYPE_SIXLOWPAN);
+    const gnrc_sixlowpan_frag_rb_t *entry;
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt1, TEST_FRAGMENT1_OFFSET, TEST_PAGE
+        ));
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt3, TEST_FRAGMENT3_OFFSET, TEST_PAGE
+        )));
+    TEST_ASSERT_EQUAL_INT(2, entry->ints_numof);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT1_OFFSET, entry->ints[0].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT2_OFFSET - 1, entry->ints[0].end);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT3_OFFSET, entry->ints[1].start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAGMENT4_OFFSET - 1, entry->ints[1].end);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NOT_NULL((entry = gnrc_sixlowpan_frag_rb_add(
+            &_test_netif_hdr.hdr, pkt2, TEST_FRAGMENT2_OFFSET, TEST_PAGE
+        )));
+    /* fragment 2 closes the gap, so only one interval should remain */
+    _test_entry(entry, TEST_FRAGMENT4_OFFSET,
+                TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT4_OFFSET - 1);
+    TEST_ASSERT_EQUAL_INT(3, entry->frags);
+    _check_pktbuf(entry);
+}
+
 static void test_rbuf_add__full_rbuf(void)
 {
     gnrc_pktsnip_t *pkt;
@@ -627,6 +660,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_subsequent_fragment),
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
+        new_TestFixture(test_rbuf_add__merge_intervals),
         new_TestFixture(test_rbuf_add__full_rbuf),
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
@@ -0,0 +1,527 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests 6LoWPAN selective fragment recovery of gnrc stack.
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/gnrc/sixlowpan.h"
+#include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/sfr.h"
+#include "net/gnrc/sixlowpan/frag/vrb.h"
+#include "net/ieee802154.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/sixlowpan/sfr.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define TEST_OWN        { 0x5a, 0x9d, 0x93, 0x86, 0x22, 0x08, 0x65, 0x79 }
+#define TEST_PEER       { 0x2a, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+/* link-layer address of TEST_TGT_IPV6 */
+#define TEST_TGT        { 0x4a, 0x3d, 0x1d, 0x0c, 0x98, 0x31, 0x58, 0xae }
+#define TEST_TGT_IPV6   { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                          0x48, 0x3d, 0x1d, 0x0c, 0x98, 0x31, 0x58, 0xae }
+#define TEST_PEER_IPV6  { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+                          0x28, 0xab, 0xdc, 0x15, 0x54, 0x01, 0x64, 0x79 }
+#define TEST_TAG        (0x0f)
+#define TEST_MAX_PDU    (102U)
+#define TEST_FRAG_SIZE  (TEST_MAX_PDU - sizeof(sixlowpan_sfr_rfrag_t))
+#define TEST_SEND_PAYLOAD_SIZE  (300U)
+#define TEST_SEND_FRAGS (4U)
+#define TEST_RECV_PAYLOAD_SIZE  (100U)
+#define TEST_WAIT_US    (10U * US_PER_MS)
+#define TEST_FRAMES_NUMOF       (16U)
+/* first fragment of an IPHC compressed datagram of size 188 to 2001:db8::2
+ * (see tests/gnrc_sixlowpan_iphc_w_vrb) */
+#define TEST_IPHC_DATAGRAM_SIZE (188U)
+#define TEST_IPHC_1ST_FRAG { \
+        /* IPHC header: Next header: ICMPv6, Hop limit: 64 */ \
+        0x7a, 0x00, 0x3a, \
+        /* Source: 2001:db8::1 */ \
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, \
+        /* Destination: 2001:db8::2 */ \
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, \
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, \
+        /* ICMPv6 echo request */ \
+        0x80, 0x00, 0x8e, 0xa0, 0x23, 0x8f, 0x00, 0x02, \
+        0x9d, 0x4b, 0xb2, 0x1c, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+        0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, \
+    }
+
+typedef struct {
+    uint8_t data[2 * IEEE802154_FRAME_LEN_MAX];
+    size_t len;
+} _frame_t;
+
+static const uint8_t _test_own[] = TEST_OWN;
+static const uint8_t _test_peer[] = TEST_PEER;
+static const uint8_t _test_tgt[] = TEST_TGT;
+static const uint8_t _test_iphc_1st_frag[] = TEST_IPHC_1ST_FRAG;
+static const ipv6_addr_t _test_tgt_ipv6 = { .u8 = TEST_TGT_IPV6 };
+static const ipv6_addr_t _test_peer_ipv6 = { .u8 = TEST_PEER_IPV6 };
+static const uint8_t _full_bitmap[] = { 0xff, 0xff, 0xff, 0xff };
+static const uint8_t _null_bitmap[] = { 0x00, 0x00, 0x00, 0x00 };
+
+static char _mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
+static netdev_test_t _mock_dev;
+static gnrc_netif_t _netif;
+static gnrc_netif_t *_mock_netif;
+static _frame_t _frames[TEST_FRAMES_NUMOF];
+static unsigned _frames_numof;
+
+static void _set_up(void)
+{
+    _frames_numof = 0;
+}
+
+static void _tear_down(void)
+{
+    gnrc_ipv6_nib_ft_del(NULL, 0);
+    gnrc_sixlowpan_frag_rb_reset();
+    gnrc_sixlowpan_frag_vrb_reset();
+}
+
+static uint8_t *_frame_payload(unsigned idx)
+{
+    return &_frames[idx].data[ieee802154_get_frame_hdr_len(_frames[idx].data)];
+}
+
+static sixlowpan_sfr_rfrag_t *_frame_rfrag(unsigned idx)
+{
+    sixlowpan_sfr_rfrag_t *rfrag = (sixlowpan_sfr_rfrag_t *)_frame_payload(idx);
+
+    expect(sixlowpan_sfr_rfrag_is(&rfrag->base));
+    return rfrag;
+}
+
+static sixlowpan_sfr_ack_t *_frame_ack(unsigned idx)
+{
+    sixlowpan_sfr_ack_t *ack = (sixlowpan_sfr_ack_t *)_frame_payload(idx);
+
+    expect(sixlowpan_sfr_ack_is(&ack->base));
+    return ack;
+}
+
+static bool _frame_dst_is(unsigned idx, const uint8_t *addr)
+{
+    uint8_t dst[IEEE802154_LONG_ADDRESS_LEN];
+    le_uint16_t dst_pan;
+
+    return (ieee802154_get_dst(_frames[idx].data, dst, &dst_pan) ==
+            IEEE802154_LONG_ADDRESS_LEN) &&
+           (memcmp(dst, addr, sizeof(dst)) == 0);
+}
+
+static bool _rb_is_empty(void)
+{
+    const gnrc_sixlowpan_frag_rb_t *rb = gnrc_sixlowpan_frag_rb_array();
+
+    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
+        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rb[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _wait(void)
+{
+    xtimer_usleep(TEST_WAIT_US);
+}
+
+static void _send_datagram(void)
+{
+    gnrc_pktsnip_t *pkt, *ipv6;
+    ipv6_hdr_t *ipv6_hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, TEST_SEND_PAYLOAD_SIZE,
+                          GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(pkt);
+    for (unsigned i = 0; i < pkt->size; i++) {
+        ((uint8_t *)pkt->data)[i] = i & 0xff;
+    }
+    ipv6 = gnrc_ipv6_hdr_build(pkt, NULL, &_test_peer_ipv6);
+    TEST_ASSERT_NOT_NULL(ipv6);
+    ipv6_hdr = ipv6->data;
+    ipv6_hdr->len = byteorder_htons(TEST_SEND_PAYLOAD_SIZE);
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = 64;
+    pkt = gnrc_netif_hdr_build(NULL, 0, _test_peer, sizeof(_test_peer));
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_netif_hdr_set_netif(pkt->data, _mock_netif);
+    pkt = gnrc_pkt_prepend(ipv6, pkt);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_send(GNRC_NETTYPE_SIXLOWPAN,
+                                                       GNRC_NETREG_DEMUX_CTX_ALL,
+                                                       pkt));
+    _wait();
+}
+
+static void _recv(const uint8_t *src, const void *data, size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_netif_hdr_build(src, IEEE802154_LONG_ADDRESS_LEN,
+                                               _test_own, sizeof(_test_own));
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_netif_hdr_set_netif(pkt->data, _mock_netif);
+    pkt = gnrc_pktbuf_add(pkt, data, size, GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netapi_dispatch_receive(GNRC_NETTYPE_SIXLOWPAN,
+                                                          GNRC_NETREG_DEMUX_CTX_ALL,
+                                                          pkt));
+    _wait();
+}
+
+static void _recv_ack(const uint8_t *src, uint8_t tag, const uint8_t *bitmap)
+{
+    sixlowpan_sfr_ack_t ack = { .base = { .disp_ecn = 0, .tag = tag } };
+
+    sixlowpan_sfr_ack_set_disp(&ack.base);
+    memcpy(ack.bitmap, bitmap, sizeof(ack.bitmap));
+    _recv(src, &ack, sizeof(ack));
+}
+
+static void _recv_rfrag(uint8_t seq, bool ack_req, uint16_t offset,
+                        const void *data, size_t size)
+{
+    uint8_t buf[sizeof(sixlowpan_sfr_rfrag_t) + TEST_FRAG_SIZE];
+    sixlowpan_sfr_rfrag_t *rfrag = (sixlowpan_sfr_rfrag_t *)buf;
+
+    TEST_ASSERT(size <= TEST_FRAG_SIZE);
+    memset(rfrag, 0, sizeof(*rfrag));
+    sixlowpan_sfr_rfrag_set_disp(&rfrag->base);
+    rfrag->base.tag = TEST_TAG;
+    sixlowpan_sfr_rfrag_set_seq(rfrag, seq);
+    sixlowpan_sfr_rfrag_set_frag_size(rfrag, size);
+    sixlowpan_sfr_rfrag_set_offset(rfrag, offset);
+    if (ack_req) {
+        sixlowpan_sfr_rfrag_set_ack_req(rfrag);
+    }
+    memcpy(rfrag + 1, data, size);
+    _recv(_test_peer, buf, sizeof(*rfrag) + size);
+}
+
+static void _check_sent_window(uint8_t *tag)
+{
+    uint16_t compressed = 0;
+
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS, _frames_numof);
+    for (unsigned i = 0; i < TEST_SEND_FRAGS; i++) {
+        compressed += sixlowpan_sfr_rfrag_get_frag_size(_frame_rfrag(i));
+    }
+    *tag = _frame_rfrag(0)->base.tag;
+    for (unsigned i = 0, offset = 0; i < TEST_SEND_FRAGS; i++) {
+        sixlowpan_sfr_rfrag_t *rfrag = _frame_rfrag(i);
+
+        TEST_ASSERT(_frame_dst_is(i, _test_peer));
+        TEST_ASSERT_EQUAL_INT(*tag, rfrag->base.tag);
+        TEST_ASSERT_EQUAL_INT(i, sixlowpan_sfr_rfrag_get_seq(rfrag));
+        /* only the last fragment requests an acknowledgment */
+        TEST_ASSERT_EQUAL_INT(i == (TEST_SEND_FRAGS - 1),
+                              sixlowpan_sfr_rfrag_ack_req(rfrag));
+        if (i == 0) {
+            TEST_ASSERT_EQUAL_INT(sizeof(ipv6_hdr_t) + TEST_SEND_PAYLOAD_SIZE,
+                                  sixlowpan_sfr_rfrag_get_offset(rfrag));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(sizeof(ipv6_hdr_t) + TEST_SEND_PAYLOAD_SIZE -
+                                  compressed + offset,
+                                  sixlowpan_sfr_rfrag_get_offset(rfrag));
+        }
+        offset += sixlowpan_sfr_rfrag_get_frag_size(rfrag);
+    }
+}
+
+static void test_send__full_ack(void)
+{
+    uint8_t tag;
+
+    _send_datagram();
+    _check_sent_window(&tag);
+    _recv_ack(_test_peer, tag, _full_bitmap);
+    /* no fragments were resent */
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS, _frames_numof);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_send__partial_ack(void)
+{
+    /* all but fragment 1 */
+    static const uint8_t bitmap[] = { 0xb0, 0x00, 0x00, 0x00 };
+    uint8_t tag;
+
+    _send_datagram();
+    _check_sent_window(&tag);
+    _recv_ack(_test_peer, tag, bitmap);
+    /* only the missing fragment was resent, requesting an acknowledgment */
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS + 1, _frames_numof);
+    TEST_ASSERT_EQUAL_INT(1, sixlowpan_sfr_rfrag_get_seq(
+            _frame_rfrag(TEST_SEND_FRAGS)));
+    TEST_ASSERT(sixlowpan_sfr_rfrag_ack_req(_frame_rfrag(TEST_SEND_FRAGS)));
+    TEST_ASSERT(_frame_dst_is(TEST_SEND_FRAGS, _test_peer));
+    _recv_ack(_test_peer, tag, _full_bitmap);
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS + 1, _frames_numof);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_send__null_ack(void)
+{
+    uint8_t tag;
+
+    _send_datagram();
+    _check_sent_window(&tag);
+    /* receiver aborts */
+    _recv_ack(_test_peer, tag, _null_bitmap);
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS, _frames_numof);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_send__arq_timeout(void)
+{
+    uint8_t tag;
+
+    _send_datagram();
+    _check_sent_window(&tag);
+    xtimer_usleep(GNRC_SIXLOWPAN_SFR_OPT_ARQ_TIMEOUT_MS * US_PER_MS);
+    _wait();
+    /* last fragment of window was resent */
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS + 1, _frames_numof);
+    TEST_ASSERT_EQUAL_INT(TEST_SEND_FRAGS - 1, sixlowpan_sfr_rfrag_get_seq(
+            _frame_rfrag(TEST_SEND_FRAGS)));
+    TEST_ASSERT(sixlowpan_sfr_rfrag_ack_req(_frame_rfrag(TEST_SEND_FRAGS)));
+    _recv_ack(_test_peer, tag, _full_bitmap);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_recv__complete(void)
+{
+    uint8_t datagram[1 + sizeof(ipv6_hdr_t) + TEST_RECV_PAYLOAD_SIZE];
+    ipv6_hdr_t *ipv6_hdr = (ipv6_hdr_t *)&datagram[1];
+    const size_t first_size = TEST_FRAG_SIZE;
+
+    datagram[0] = SIXLOWPAN_UNCOMP;
+    memset(ipv6_hdr, 0, sizeof(*ipv6_hdr));
+    ipv6_hdr_set_version(ipv6_hdr);
+    ipv6_hdr->len = byteorder_htons(TEST_RECV_PAYLOAD_SIZE);
+    ipv6_hdr->nh = PROTNUM_IPV6_NONXT;
+    ipv6_hdr->hl = 64;
+    ipv6_hdr->src = _test_peer_ipv6;
+    ipv6_hdr->dst = _test_peer_ipv6;
+    memset(ipv6_hdr + 1, 0x53, TEST_RECV_PAYLOAD_SIZE);
+
+    _recv_rfrag(0, false, sizeof(datagram) - 1, datagram, first_size);
+    /* no acknowledgment requested yet */
+    TEST_ASSERT_EQUAL_INT(0, _frames_numof);
+    /* uncompressed dispatch is not part of the datagram */
+    _recv_rfrag(1, true, first_size - 1, &datagram[first_size],
+                sizeof(datagram) - first_size);
+    TEST_ASSERT_EQUAL_INT(1, _frames_numof);
+    TEST_ASSERT(_frame_dst_is(0, _test_peer));
+    TEST_ASSERT_EQUAL_INT(TEST_TAG, _frame_ack(0)->base.tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_frame_ack(0)->bitmap, _full_bitmap,
+                                    sizeof(_full_bitmap)));
+    TEST_ASSERT(_rb_is_empty());
+}
+
+static void test_recv__no_state(void)
+{
+    static const uint8_t payload[] = { 0x53, 0x53, 0x53, 0x53 };
+
+    _recv_rfrag(1, true, 96, payload, sizeof(payload));
+    /* datagram is aborted */
+    TEST_ASSERT_EQUAL_INT(1, _frames_numof);
+    TEST_ASSERT(_frame_dst_is(0, _test_peer));
+    TEST_ASSERT_EQUAL_INT(TEST_TAG, _frame_ack(0)->base.tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_frame_ack(0)->bitmap, _null_bitmap,
+                                    sizeof(_null_bitmap)));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_recv__abort(void)
+{
+    /* use forwarding payload, but without a route it is reassembled */
+    _recv_rfrag(0, false, TEST_IPHC_DATAGRAM_SIZE, _test_iphc_1st_frag,
+                sizeof(_test_iphc_1st_frag));
+    TEST_ASSERT(!_rb_is_empty());
+    /* abort fragment */
+    _recv_rfrag(0, false, 0, _test_iphc_1st_frag, 0);
+    TEST_ASSERT(_rb_is_empty());
+    TEST_ASSERT_EQUAL_INT(0, _frames_numof);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_forward(void)
+{
+    gnrc_sixlowpan_frag_vrb_t *vrbe;
+    sixlowpan_sfr_rfrag_t *rfrag;
+
+    /* Add default route for the VRB entry created from */
+    gnrc_ipv6_nib_ft_add(NULL, 0, &_test_tgt_ipv6, _mock_netif->pid, 0);
+    _recv_rfrag(0, true, TEST_IPHC_DATAGRAM_SIZE, _test_iphc_1st_frag,
+                sizeof(_test_iphc_1st_frag));
+    vrbe = gnrc_sixlowpan_frag_vrb_get(_test_peer, sizeof(_test_peer),
+                                       TEST_TAG);
+    TEST_ASSERT_NOT_NULL(vrbe);
+    /* fragment was forwarded with the new tag */
+    TEST_ASSERT_EQUAL_INT(1, _frames_numof);
+    TEST_ASSERT(_frame_dst_is(0, _test_tgt));
+    rfrag = _frame_rfrag(0);
+    TEST_ASSERT_EQUAL_INT(vrbe->out_tag, rfrag->base.tag);
+    TEST_ASSERT_EQUAL_INT(0, sixlowpan_sfr_rfrag_get_seq(rfrag));
+    TEST_ASSERT(sixlowpan_sfr_rfrag_ack_req(rfrag));
+    TEST_ASSERT_EQUAL_INT(TEST_IPHC_DATAGRAM_SIZE,
+                          sixlowpan_sfr_rfrag_get_offset(rfrag));
+    /* acknowledgment of next hop is relayed to the original sender */
+    _recv_ack(_test_tgt, rfrag->base.tag, _full_bitmap);
+    TEST_ASSERT_EQUAL_INT(2, _frames_numof);
+    TEST_ASSERT(_frame_dst_is(1, _test_peer));
+    TEST_ASSERT_EQUAL_INT(TEST_TAG, _frame_ack(1)->base.tag);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_frame_ack(1)->bitmap, _full_bitmap,
+                                    sizeof(_full_bitmap)));
+    /* VRB entry was removed with the complete acknowledgment */
+    TEST_ASSERT_NULL(gnrc_sixlowpan_frag_vrb_get(_test_peer, sizeof(_test_peer),
+                                                 TEST_TAG));
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void run_unittests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_send__full_ack),
+        new_TestFixture(test_send__partial_ack),
+        new_TestFixture(test_send__null_ack),
+        new_TestFixture(test_send__arq_timeout),
+        new_TestFixture(test_recv__complete),
+        new_TestFixture(test_recv__no_state),
+        new_TestFixture(test_recv__abort),
+        new_TestFixture(test_forward),
+    };
+
+    EMB_UNIT_TESTCALLER(sixlo_sfr_tests, _set_up, _tear_down, fixtures);
+    TESTS_START();
+    TESTS_RUN((Test *)&sixlo_sfr_tests);
+    TESTS_END();
+}
+
+static int _netdev_send(netdev_t *dev, const iolist_t *iolist)
+{
+    _frame_t *frame = &_frames[_frames_numof];
+    size_t hdr_len;
+
+    (void)dev;
+    if (_frames_numof >= TEST_FRAMES_NUMOF) {
+        return -ENOBUFS;
+    }
+    frame->len = 0;
+    for (; iolist != NULL; iolist = iolist->iol_next) {
+        expect((frame->len + iolist->iol_len) <= sizeof(frame->data));
+        memcpy(&frame->data[frame->len], iolist->iol_base, iolist->iol_len);
+        frame->len += iolist->iol_len;
+    }
+    hdr_len = ieee802154_get_frame_hdr_len(frame->data);
+    /* only record selective fragment recovery frames, e.g. not NDP */
+    if ((hdr_len > 0) && (frame->len > hdr_len) &&
+        sixlowpan_sfr_is((sixlowpan_sfr_t *)&frame->data[hdr_len])) {
+        _frames_numof++;
+    }
+    return frame->len;
+}
+
+static int _get_netdev_device_type(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_proto(netdev_t *netdev, void *value, size_t max_len)
+{
+    expect(max_len == sizeof(gnrc_nettype_t));
+    (void)netdev;
+
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_netdev_max_pdu_size(netdev_t *netdev, void *value,
+                                    size_t max_len)
+{
+    expect(max_len == sizeof(uint16_t));
+    (void)netdev;
+
+    *((uint16_t *)value) = TEST_MAX_PDU;
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_src_len(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = sizeof(_test_own);
+    return sizeof(uint16_t);
+}
+
+static int _get_netdev_addr_long(netdev_t *netdev, void *value, size_t max_len)
+{
+    (void)netdev;
+    expect(max_len >= sizeof(_test_own));
+    memcpy(value, _test_own, sizeof(_test_own));
+    return sizeof(_test_own);
+}
+
+static void _init_mock_netif(void)
+{
+    netdev_test_setup(&_mock_dev, NULL);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_DEVICE_TYPE,
+                           _get_netdev_device_type);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_PROTO,
+                           _get_netdev_proto);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_MAX_PDU_SIZE,
+                           _get_netdev_max_pdu_size);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_SRC_LEN,
+                           _get_netdev_src_len);
+    netdev_test_set_get_cb(&_mock_dev, NETOPT_ADDRESS_LONG,
+                           _get_netdev_addr_long);
+    netdev_test_set_send_cb(&_mock_dev, _netdev_send);
+    gnrc_netif_ieee802154_create(&_netif, _mock_netif_stack,
+                                 THREAD_STACKSIZE_DEFAULT, GNRC_NETIF_PRIO,
+                                 "mock_netif", (netdev_t *)&_mock_dev);
+    _mock_netif = &_netif;
+    thread_yield_higher();
+    gnrc_sixlowpan_frag_sfr_netif_enable(_mock_netif, true);
+}
+
+int main(void)
+{
+    _init_mock_netif();
+    run_unittests();
+    return 0;
+}
@@ -499,6 +499,29 @@ static void test_sock_ip_send__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_ip_sendv__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_ip_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                        .family = AF_INET6,
+                                        .netif = _TEST_NETIF };
+    static const sock_ip_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                         .family = AF_INET6 };
+    iolist_t trailer = { .iol_base = "CD", .iol_len = sizeof("CD") };
+    const iolist_t header = { .iol_next = &trailer, .iol_base = "AB",
+                              .iol_len = 2 };
+
+    expect(0 == sock_ip_create(&_sock, &local, &remote, _TEST_PROTO,
+                               SOCK_FLAGS_REUSE_EP));
+    expect(sizeof("ABCD") == sock_ip_sendv(&_sock, &header, _TEST_PROTO,
+                                           NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PROTO, "ABCD",
+                         sizeof("ABCD"), _TEST_NETIF));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_ip_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -662,6 +685,7 @@ int main(void)
     CALL(test_sock_ip_send__socketed_no_netif());
     CALL(test_sock_ip_send__socketed_no_local());
     CALL(test_sock_ip_send__socketed());
+    CALL(test_sock_ip_sendv__socketed());
     CALL(test_sock_ip_send__socketed_other_remote());
     CALL(test_sock_ip_send__unsocketed_no_local_no_netif());
     CALL(test_sock_ip_send__unsocketed_no_netif());
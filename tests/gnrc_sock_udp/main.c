@@ -448,6 +448,55 @@ static void test_sock_udp_recv_buf__success(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_batch__EAGAIN(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_dgram_t dgrams[] = {
+        { .data = _test_buffer, .len = sizeof(_test_buffer) },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-EAGAIN == sock_udp_recv_batch(&_sock, dgrams, ARRAY_SIZE(dgrams),
+                                          0));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_batch__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t results[3];
+    sock_udp_dgram_t dgrams[] = {
+        { .data = &_test_buffer[0], .len = 16, .remote = &results[0] },
+        { .data = &_test_buffer[16], .len = 16, .remote = &results[1] },
+        { .data = &_test_buffer[32], .len = 16, .remote = &results[2] },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE + 1,
+                          _TEST_PORT_LOCAL, "EFGHIJ", sizeof("EFGHIJ"),
+                          _TEST_NETIF));
+    /* only the waiting datagrams are received */
+    expect(2 == sock_udp_recv_batch(&_sock, dgrams, ARRAY_SIZE(dgrams),
+                                    SOCK_NO_TIMEOUT));
+    expect(sizeof("ABCD") == dgrams[0].len);
+    expect(memcmp(dgrams[0].data, "ABCD", sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == results[0].port);
+    expect(sizeof("EFGHIJ") == dgrams[1].len);
+    expect(memcmp(dgrams[1].data, "EFGHIJ", sizeof("EFGHIJ")) == 0);
+    expect(_TEST_PORT_REMOTE + 1 == results[1].port);
+    expect(AF_INET6 == results[1].family);
+    expect(memcmp(&results[1].addr, &src_addr, sizeof(results[1].addr)) == 0);
+    expect(_TEST_NETIF == results[1].netif);
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -584,6 +633,32 @@ static void test_sock_udp_send__socketed(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_sendv__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    iolist_t empty = { .iol_base = NULL, .iol_len = 0 };
+    iolist_t trailer = { .iol_next = &empty, .iol_base = "CD",
+                         .iol_len = sizeof("CD") };
+    const iolist_t header = { .iol_next = &trailer, .iol_base = "AB",
+                              .iol_len = 2 };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(sizeof("ABCD") == sock_udp_sendv(&_sock, &header, NULL));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__socketed_other_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
@@ -720,6 +795,57 @@ static void test_sock_udp_send__no_sock(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_send_batch__socketed(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t other_addr = { .u8 = _TEST_ADDR_WRONG };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+    sock_udp_ep_t other_remote = { .addr = { .ipv6 = _TEST_ADDR_WRONG },
+                                   .family = AF_INET6,
+                                   .port = _TEST_PORT_REMOTE + 1 };
+    const sock_udp_dgram_t dgrams[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+        { .data = "EFGHIJ", .len = sizeof("EFGHIJ") },
+        { .data = "KL", .len = sizeof("KL"), .remote = &other_remote },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, &remote, SOCK_FLAGS_REUSE_EP));
+    expect(3 == sock_udp_send_batch(&_sock, dgrams, ARRAY_SIZE(dgrams)));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "EFGHIJ", sizeof("EFGHIJ"),
+                         _TEST_NETIF, false));
+    expect(_check_packet(&src_addr, &other_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE + 1, "KL", sizeof("KL"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
+static void test_sock_udp_send_batch__ENOTCONN(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    const sock_udp_dgram_t dgrams[] = {
+        { .data = "ABCD", .len = sizeof("ABCD") },
+    };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(-ENOTCONN == sock_udp_send_batch(&_sock, dgrams,
+                                            ARRAY_SIZE(dgrams)));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    expect(_check_net());
+}
+
 int main(void)
 {
     _net_init();
@@ -752,6 +878,8 @@ int main(void)
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_batch__EAGAIN());
+    CALL(test_sock_udp_recv_batch__success());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -762,6 +890,7 @@ int main(void)
     CALL(test_sock_udp_send__socketed_no_netif());
     CALL(test_sock_udp_send__socketed_no_local());
     CALL(test_sock_udp_send__socketed());
+    CALL(test_sock_udp_sendv__socketed());
     CALL(test_sock_udp_send__socketed_other_remote());
     CALL(test_sock_udp_send__unsocketed_no_local_no_netif());
     CALL(test_sock_udp_send__unsocketed_no_netif());
@@ -769,6 +898,8 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+    CALL(test_sock_udp_send_batch__socketed());
+    CALL(test_sock_udp_send_batch__ENOTCONN());
 
     puts("ALL TESTS SUCCESSFUL");
 
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test for sending UDP datagrams as packet trains
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "thread.h"
+
+#define DGRAMS_NUMOF        (16U)
+#define PORT_LOCAL          (0x2c94)
+#define PORT_REMOTE         (0xa615)
+
+static gnrc_netreg_entry_t _reg;
+static msg_t _msg_queue[4];
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+/* trains the subscriber still receives before it unregisters */
+static unsigned _trains_left;
+static unsigned _trains;
+static unsigned _pkts;
+static bool _failed;
+
+static const ipv6_addr_t _remote_addr = { {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+
+static bool _check_pkt(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
+    ipv6_hdr_t *ipv6_hdr;
+    udp_hdr_t *udp_hdr;
+
+    if ((pkt->type != GNRC_NETTYPE_IPV6) || (udp == NULL) ||
+        (udp->next == NULL)) {
+        return false;
+    }
+    ipv6_hdr = pkt->data;
+    udp_hdr = udp->data;
+    /* the payload of each datagram is its index in the batch */
+    return (ipv6_addr_equal(&ipv6_hdr->dst, &_remote_addr)) &&
+           (ipv6_hdr->nh == PROTNUM_UDP) &&
+           (byteorder_ntohs(udp_hdr->src_port) == PORT_LOCAL) &&
+           (byteorder_ntohs(udp_hdr->dst_port) == PORT_REMOTE) &&
+           (udp->next->size == sizeof(uint8_t)) &&
+           (*((uint8_t *)udp->next->data) == _pkts);
+}
+
+static void *_subscriber(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type != GNRC_NETAPI_MSG_TYPE_SND_TRAIN) {
+            puts("unexpected message");
+            _failed = true;
+            gnrc_pktbuf_release(msg.content.ptr);
+            continue;
+        }
+        _trains++;
+        for (unsigned i = 0; i < gnrc_netapi_train_len(msg.content.ptr); i++) {
+            gnrc_pktsnip_t *pkt = gnrc_netapi_train_pkt(msg.content.ptr, i);
+
+            if (!_check_pkt(pkt)) {
+                printf("unexpected packet %u\n", _pkts);
+                _failed = true;
+            }
+            _pkts++;
+            gnrc_pktbuf_release(pkt);
+        }
+        gnrc_pktbuf_release(msg.content.ptr);
+        /* there is no one else registered, so the following trains of the
+         * batch fail */
+        if (--_trains_left == 0) {
+            gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_reg);
+        }
+    }
+    return NULL;
+}
+
+static bool _send(sock_udp_t *sock, unsigned numof, unsigned trains)
+{
+    static uint8_t data[DGRAMS_NUMOF];
+    sock_udp_dgram_t dgrams[DGRAMS_NUMOF];
+    int res;
+
+    for (unsigned i = 0; i < numof; i++) {
+        data[i] = i;
+        dgrams[i] = (sock_udp_dgram_t){ .data = &data[i], .len = 1 };
+    }
+    _trains_left = trains;
+    _trains = 0;
+    _pkts = 0;
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &_reg);
+    res = sock_udp_send_batch(sock, dgrams, numof);
+    if (_trains_left > 0) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &_reg);
+    }
+    printf("%d sent in %u train%s\n", res, _trains, (_trains == 1) ? "" : "s");
+    if (res != (int)_pkts) {
+        puts("FAILED: number of sent datagrams does not match received ones");
+        return false;
+    }
+    if (!gnrc_pktbuf_is_empty()) {
+        puts("FAILED: packet buffer not empty");
+        return false;
+    }
+    return !_failed;
+}
+
+int main(void)
+{
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = PORT_LOCAL };
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = PORT_REMOTE };
+    sock_udp_t sock;
+    kernel_pid_t pid;
+
+    memcpy(&remote.addr, &_remote_addr, sizeof(_remote_addr));
+    if (sock_udp_create(&sock, &local, &remote, 0) < 0) {
+        puts("FAILED: unable to create sock");
+        return 1;
+    }
+    /* the subscriber has a higher priority, so it is done with a train when
+     * dispatching it returns */
+    pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                        _subscriber, NULL, "subscriber");
+    gnrc_netreg_entry_init_pid(&_reg, GNRC_NETREG_DEMUX_CTX_ALL, pid);
+    _reg.train = true;
+
+    /* a full and a trailing train */
+    printf("send 10 datagrams: ");
+    if (!_send(&sock, 10, DGRAMS_NUMOF)) {
+        return 1;
+    }
+    /* a full train fails */
+    printf("send 16 datagrams, 1 train received: ");
+    if (!_send(&sock, 16, 1)) {
+        return 1;
+    }
+    /* the trailing train fails */
+    printf("send 10 datagrams, 1 train received: ");
+    if (!_send(&sock, 10, 1)) {
+        return 1;
+    }
+    puts("SUCCESS");
+
+    return 0;
+}
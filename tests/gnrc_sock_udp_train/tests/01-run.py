@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("send 10 datagrams: 10 sent in 2 trains")
+    child.expect_exact("send 16 datagrams, 1 train received: 8 sent in 1 train")
+    child.expect_exact("send 10 datagrams, 1 train received: 8 sent in 1 train")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
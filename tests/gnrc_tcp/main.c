@@ -16,9 +16,13 @@
 
 #define MAIN_QUEUE_SIZE (8)
 #define BUFFER_SIZE (2049)
+#define LISTEN_QUEUE_SIZE (2)
 
 static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
-static gnrc_tcp_tcb_t tcb;
+static gnrc_tcp_tcb_t single_tcb;
+static gnrc_tcp_tcb_t listen_tcbs[LISTEN_QUEUE_SIZE];
+static gnrc_tcp_tcb_queue_t listen_queue = GNRC_TCP_TCB_QUEUE_INIT;
+static gnrc_tcp_tcb_t *tcb = &single_tcb;   /* TCB used by the connection commands */
 static char buffer[BUFFER_SIZE];
 
 void dump_args(int argc, char **argv)
@@ -121,7 +125,8 @@ int gnrc_tcp_ep_from_str_cmd(int argc, char **argv)
 int gnrc_tcp_tcb_init_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
-    gnrc_tcp_tcb_init(&tcb);
+    tcb = &single_tcb;
+    gnrc_tcp_tcb_init(tcb);
     return 0;
 }
 
@@ -133,7 +138,7 @@ int gnrc_tcp_open_active_cmd(int argc, char **argv)
     gnrc_tcp_ep_from_str(&remote, argv[1]);
     uint16_t local_port = atol(argv[2]);
 
-    int err = gnrc_tcp_open_active(&tcb, &remote, local_port);
+    int err = gnrc_tcp_open_active(tcb, &remote, local_port);
     switch (err) {
         case -EAFNOSUPPORT:
             printf("%s: returns -EAFNOSUPPORT\n", argv[0]);
@@ -176,7 +181,7 @@ int gnrc_tcp_open_passive_cmd(int argc, char **argv)
     gnrc_tcp_ep_t local;
     gnrc_tcp_ep_from_str(&local, argv[1]);
 
-    int err = gnrc_tcp_open_passive(&tcb, &local);
+    int err = gnrc_tcp_open_passive(tcb, &local);
     switch (err) {
         case -EAFNOSUPPORT:
             printf("%s: returns -EAFNOSUPPORT\n", argv[0]);
@@ -200,6 +205,77 @@ int gnrc_tcp_open_passive_cmd(int argc, char **argv)
     return err;
 }
 
+int gnrc_tcp_listen_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_ep_from_str(&local, argv[1]);
+
+    int err = gnrc_tcp_listen(&listen_queue, listen_tcbs, LISTEN_QUEUE_SIZE, &local);
+    switch (err) {
+        case -EAFNOSUPPORT:
+            printf("%s: returns -EAFNOSUPPORT\n", argv[0]);
+            break;
+
+        case -EINVAL:
+            printf("%s: returns -EINVAL\n", argv[0]);
+            break;
+
+        case -EISCONN:
+            printf("%s: returns -EISCONN\n", argv[0]);
+            break;
+
+        case -ENOMEM:
+            printf("%s: returns -ENOMEM\n", argv[0]);
+            break;
+
+        default:
+            printf("%s: returns %d\n", argv[0], err);
+    }
+    return err;
+}
+
+int gnrc_tcp_accept_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+
+    gnrc_tcp_tcb_t *accepted = NULL;
+    int timeout = atol(argv[1]);
+
+    int err = gnrc_tcp_accept(&listen_queue, &accepted, timeout);
+    switch (err) {
+        case -EINVAL:
+            printf("%s: returns -EINVAL\n", argv[0]);
+            break;
+
+        case -EALREADY:
+            printf("%s: returns -EALREADY\n", argv[0]);
+            break;
+
+        case -EAGAIN:
+            printf("%s: returns -EAGAIN\n", argv[0]);
+            break;
+
+        case -ETIMEDOUT:
+            printf("%s: returns -ETIMEDOUT\n", argv[0]);
+            break;
+
+        default:
+            /* Following commands use the accepted connection */
+            tcb = accepted;
+            printf("%s: returns %d\n", argv[0], err);
+    }
+    return err;
+}
+
+int gnrc_tcp_stop_listen_cmd(int argc, char **argv)
+{
+    dump_args(argc, argv);
+    gnrc_tcp_stop_listen(&listen_queue);
+    return 0;
+}
+
 int gnrc_tcp_send_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
@@ -209,7 +285,7 @@ int gnrc_tcp_send_cmd(int argc, char **argv)
     size_t sent = 0;
 
     while (sent < to_send) {
-        int ret = gnrc_tcp_send(&tcb, buffer + sent, to_send - sent, timeout);
+        int ret = gnrc_tcp_send(tcb, buffer + sent, to_send - sent, timeout);
         switch (ret) {
             case -ENOTCONN:
                 printf("%s: returns -ENOTCONN\n", argv[0]);
@@ -243,7 +319,7 @@ int gnrc_tcp_recv_cmd(int argc, char **argv)
     size_t rcvd = 0;
 
     while (rcvd < to_receive) {
-        int ret = gnrc_tcp_recv(&tcb, buffer + rcvd, to_receive - rcvd,
+        int ret = gnrc_tcp_recv(tcb, buffer + rcvd, to_receive - rcvd,
                                 timeout);
         switch (ret) {
             case 0:
@@ -280,14 +356,14 @@ int gnrc_tcp_recv_cmd(int argc, char **argv)
 int gnrc_tcp_close_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
-    gnrc_tcp_close(&tcb);
+    gnrc_tcp_close(tcb);
     return 0;
 }
 
 int gnrc_tcp_abort_cmd(int argc, char **argv)
 {
     dump_args(argc, argv);
-    gnrc_tcp_abort(&tcb);
+    gnrc_tcp_abort(tcb);
     return 0;
 }
 
@@ -300,6 +376,12 @@ static const shell_command_t shell_commands[] = {
       gnrc_tcp_open_active_cmd },
     { "gnrc_tcp_open_passive", "gnrc_tcp: open passive connection",
       gnrc_tcp_open_passive_cmd },
+    { "gnrc_tcp_listen", "gnrc_tcp: listen for connections with a TCB queue",
+      gnrc_tcp_listen_cmd },
+    { "gnrc_tcp_accept", "gnrc_tcp: accept connection from TCB queue",
+      gnrc_tcp_accept_cmd },
+    { "gnrc_tcp_stop_listen", "gnrc_tcp: stop listening with TCB queue",
+      gnrc_tcp_stop_listen_cmd },
     { "gnrc_tcp_send", "gnrc_tcp: send data to connected peer",
       gnrc_tcp_send_cmd },
     { "gnrc_tcp_recv", "gnrc_tcp: recv data from connected peer",
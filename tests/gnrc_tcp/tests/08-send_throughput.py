@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import threading
+import time
+
+from testrunner import run
+from shared_func import TcpServer, generate_port_number, get_host_tap_device, \
+                        get_host_ll_addr, get_riot_if_id, setup_internal_buffer, \
+                        write_data_to_internal_buffer, verify_pktbuf_empty, \
+                        sudo_guard
+
+ROUNDS = 25
+
+
+def tcp_server(port, shutdown_event, expected_data):
+    with TcpServer(port, shutdown_event) as tcp_srv:
+        assert tcp_srv.recv(len(expected_data)) == expected_data
+
+
+def testfunc(child):
+    port = generate_port_number()
+    shutdown_event = threading.Event()
+
+    # Send the full internal buffer multiple times from RIOT to the Host System.
+    data_len = setup_internal_buffer(child)
+    data = ('0123456789' * (data_len // 10 + 1))[:data_len]
+
+    server_handle = threading.Thread(target=tcp_server,
+                                     args=(port, shutdown_event, data * ROUNDS))
+    server_handle.start()
+
+    target_addr = get_host_ll_addr(get_host_tap_device()) + '%' + get_riot_if_id(child)
+
+    # Setup RIOT Node to connect to host systems TCP Server
+    child.sendline('gnrc_tcp_tcb_init')
+    child.sendline('gnrc_tcp_open_active [{}]:{} 0'.format(target_addr, str(port)))
+    child.expect_exact('gnrc_tcp_open_active: returns 0')
+
+    write_data_to_internal_buffer(child, data)
+
+    # Measure the time it takes to send all data
+    start = time.monotonic()
+    for _ in range(ROUNDS):
+        child.sendline('gnrc_tcp_send 0')
+        child.expect_exact('gnrc_tcp_send: sent ' + str(data_len))
+    duration = time.monotonic() - start
+
+    # Close connection and verify that pktbuf is cleared
+    shutdown_event.set()
+    child.sendline('gnrc_tcp_close')
+    server_handle.join()
+
+    verify_pktbuf_empty(child)
+
+    print('Sent {} byte in {:.3f} s ({:.1f} kbit/s)'.format(
+        data_len * ROUNDS, duration, (data_len * ROUNDS * 8) / (duration * 1000)))
+    print(os.path.basename(sys.argv[0]) + ': success')
+
+
+if __name__ == '__main__':
+    sudo_guard()
+    sys.exit(run(testfunc, timeout=20, echo=False, traceback=True))
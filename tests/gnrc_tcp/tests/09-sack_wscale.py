@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import socket
+import sys
+import time
+
+from scapy.all import Ether, IPv6, TCP, AsyncSniffer, sendp
+from testrunner import run
+from shared_func import sudo_guard, get_host_tap_device, get_host_ll_addr, \
+                        get_riot_l2_addr, get_riot_ll_addr, generate_port_number, \
+                        read_data_from_internal_buffer, verify_pktbuf_empty
+
+
+def sniff(tap, port):
+    sniffer = AsyncSniffer(iface=tap,
+                           lfilter=lambda p: TCP in p and port in (p[TCP].sport, p[TCP].dport))
+    sniffer.start()
+    # Give the sniffer some time to come up
+    time.sleep(1)
+    return sniffer
+
+
+def option_names(pkt):
+    return [opt[0] for opt in pkt[TCP].options]
+
+
+def testfunc(child):
+    tap = get_host_tap_device()
+    host_ll = get_host_ll_addr(tap)
+    riot_ll = get_riot_ll_addr(child)
+    riot_l2 = get_riot_l2_addr(child)
+    port = generate_port_number()
+    data = '0123456789' * 2
+
+    # Setup RIOT Node wait for incoming connections from host system
+    child.sendline('gnrc_tcp_tcb_init')
+    child.sendline('gnrc_tcp_open_passive [::]:{}'.format(port))
+
+    sniffer = sniff(tap, port)
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.settimeout(child.timeout)
+        addr_info = socket.getaddrinfo(riot_ll + '%' + tap, port, type=socket.SOCK_STREAM)
+        sock.connect(addr_info[0][-1])
+        child.expect_exact('gnrc_tcp_open_passive: returns 0')
+        time.sleep(1)
+        pkts = sniffer.stop()
+
+        # Linux offers SACK and window scaling, RIOT must accept both in its SYN+ACK
+        syn_ack = [p for p in pkts if p[TCP].sport == port and p[TCP].flags == 'SA']
+        assert len(syn_ack) == 1
+        assert 'WScale' in option_names(syn_ack[0])
+        assert 'SAckOK' in option_names(syn_ack[0])
+
+        # Take sequence numbers from the last ACK of the handshake
+        ack = [p for p in pkts if p[TCP].dport == port and p[TCP].flags == 'A'][-1]
+        left = (ack[TCP].seq + 10) % 2**32
+        right = (ack[TCP].seq + 20) % 2**32
+
+        # Inject the second half of the data ahead of the host system
+        sniffer = sniff(tap, port)
+        sendp(Ether(dst=riot_l2) / IPv6(src=host_ll, dst=riot_ll) /
+              TCP(sport=ack[TCP].sport, dport=port, flags='A', seq=left,
+                  ack=ack[TCP].ack, window=ack[TCP].window) / data[10:].encode(),
+              iface=tap, verbose=0)
+        time.sleep(1)
+        pkts = sniffer.stop()
+
+        # RIOT must report the out of order data in a SACK block
+        sack = [opt[1] for p in pkts if p[TCP].sport == port
+                for opt in p[TCP].options if opt[0] == 'SAck']
+        assert (left, right) in sack
+
+        # Fill the gap, RIOT must deliver all data in order
+        sock.send(data.encode('utf-8'))
+        child.sendline('gnrc_tcp_recv 1000000 ' + str(len(data)))
+        child.expect_exact('gnrc_tcp_recv: received ' + str(len(data)))
+        assert read_data_from_internal_buffer(child, len(data)) == data
+
+    child.sendline('gnrc_tcp_close')
+    verify_pktbuf_empty(child)
+
+    print(os.path.basename(sys.argv[0]) + ': success')
+
+
+if __name__ == '__main__':
+    sudo_guard(uses_scapy=True)
+    sys.exit(run(testfunc, timeout=10, echo=False, traceback=True))
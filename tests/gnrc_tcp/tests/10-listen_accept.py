@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import sys
+import socket
+import threading
+import time
+
+from testrunner import run
+from shared_func import generate_port_number, get_host_tap_device, get_riot_ll_addr, \
+                        verify_pktbuf_empty, sudo_guard
+
+CONNECTIONS = 8
+
+
+def tcp_client(addr, port, results):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.settimeout(10)
+
+    addr_info = socket.getaddrinfo(addr + '%' + get_host_tap_device(), port, type=socket.SOCK_STREAM)
+
+    try:
+        sock.connect(addr_info[0][-1])
+        results.append(True)
+    except OSError:
+        results.append(False)
+    finally:
+        sock.close()
+
+
+def tcp_client_refused(addr, port):
+    sock = socket.socket(socket.AF_INET6, socket.SOCK_STREAM)
+    sock.settimeout(10)
+
+    addr_info = socket.getaddrinfo(addr + '%' + get_host_tap_device(), port, type=socket.SOCK_STREAM)
+
+    try:
+        sock.connect(addr_info[0][-1])
+    except ConnectionRefusedError:
+        return True
+    except OSError:
+        return False
+    finally:
+        sock.close()
+    return False
+
+
+def testfunc(child):
+    port = generate_port_number()
+    riot_addr = get_riot_ll_addr(child)
+    results = []
+
+    # Setup RIOT Node to listen for incoming connections from host system
+    child.sendline('gnrc_tcp_listen [::]:{}'.format(str(port)))
+    child.expect_exact('gnrc_tcp_listen: returns 0')
+    child.sendline('gnrc_tcp_listen [::]:{}'.format(str(port)))
+    child.expect_exact('gnrc_tcp_listen: returns -EISCONN')
+
+    # Nothing to accept yet
+    child.sendline('gnrc_tcp_accept 0')
+    child.expect_exact('gnrc_tcp_accept: returns -EAGAIN')
+
+    # Open more connections at once than TCBs are listening. Excess connection
+    # requests are dropped and succeed once the host system retries them.
+    clients = [threading.Thread(target=tcp_client, args=(riot_addr, port, results))
+               for _ in range(CONNECTIONS)]
+
+    start = time.monotonic()
+    for client in clients:
+        client.start()
+
+    for _ in range(CONNECTIONS):
+        child.sendline('gnrc_tcp_accept 10000')
+        child.expect_exact('gnrc_tcp_accept: returns 0')
+        child.sendline('gnrc_tcp_close')
+    duration = time.monotonic() - start
+
+    for client in clients:
+        client.join()
+    assert results == [True] * CONNECTIONS
+
+    # Stop listening and verify that pktbuf is cleared
+    child.sendline('gnrc_tcp_stop_listen')
+    child.sendline('gnrc_tcp_accept 0')
+    child.expect_exact('gnrc_tcp_accept: returns -EINVAL')
+
+    # A queue bound to another address must not swallow connection requests,
+    # they are answered with a reset
+    child.sendline('gnrc_tcp_listen [fe80::1]:{}'.format(str(port)))
+    child.expect_exact('gnrc_tcp_listen: returns 0')
+    assert tcp_client_refused(riot_addr, port)
+    child.sendline('gnrc_tcp_stop_listen')
+
+    verify_pktbuf_empty(child)
+
+    print('Accepted {} connections in {:.3f} s ({:.1f} connections/s)'.format(
+        CONNECTIONS, duration, CONNECTIONS / duration))
+    print(os.path.basename(sys.argv[0]) + ': success')
+
+
+if __name__ == '__main__':
+    sudo_guard()
+    sys.exit(run(testfunc, timeout=30, echo=False, traceback=True))
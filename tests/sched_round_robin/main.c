@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for round robin scheduling
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "thread.h"
+#include "ztimer.h"
+
+#define BUSY_THREADS_NUMOF  (3U)
+#define TEST_DURATION_MS    (500U)
+
+static char _stacks[BUSY_THREADS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _counters[BUSY_THREADS_NUMOF];
+
+static void *_busy_thread(void *arg)
+{
+    volatile uint32_t *counter = arg;
+
+    while (1) {
+        (*counter)++;
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    puts("sched_round_robin test");
+
+    for (unsigned i = 0; i < BUSY_THREADS_NUMOF; i++) {
+        thread_create(_stacks[i], sizeof(_stacks[i]), THREAD_PRIORITY_MAIN + 1,
+                      THREAD_CREATE_STACKTEST, _busy_thread,
+                      (void *)&_counters[i], "busy");
+    }
+
+    ztimer_sleep(ZTIMER_MSEC, TEST_DURATION_MS);
+
+    unsigned starved = 0;
+    for (unsigned i = 0; i < BUSY_THREADS_NUMOF; i++) {
+        uint32_t count = _counters[i];
+        printf("thread %u: %" PRIu32 " iterations\n", i, count);
+        if (count == 0) {
+            starved++;
+        }
+    }
+
+    puts(starved ? "[FAILED]" : "[SUCCESS]");
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Kernel tracepoints test application
+ *
+ * @author      agent <agent@local>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "thread_flags.h"
+#include "trace.h"
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _lock = MUTEX_INIT_LOCKED;
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    msg_receive(&m);
+    msg_reply(&m, &m);
+
+    mutex_lock(&_lock);
+    mutex_unlock(&_lock);
+
+    thread_flags_wait_any(0x1);
+
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t m = { .type = 0x1234 };
+    trace_entry_t boot[4];
+
+    /* the kernel already traced the switch to main during boot */
+    printf("boot events: %u\n", (unsigned)trace_get(boot, ARRAY_SIZE(boot)));
+    trace_reset();
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1,
+                                     THREAD_CREATE_STACKTEST, _thread, NULL,
+                                     "traced");
+
+    trace(0);
+    msg_send_receive(&m, &m, pid);
+    mutex_unlock(&_lock);
+    thread_flags_set(thread_get(pid), 0x1);
+    trace(1);
+
+    trace_dump_binary();
+
+    return 0;
+}
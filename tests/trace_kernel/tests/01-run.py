@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 agent <agent@local>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+TRACE_EVENT_SWITCH = 1
+TRACE_EVENT_MSG_SEND = 4
+TRACE_EVENT_MSG_RECV = 5
+TRACE_EVENT_MUTEX_BLOCK = 6
+TRACE_EVENT_MUTEX_UNBLOCK = 7
+TRACE_EVENT_FLAGS_WAKE = 8
+
+
+def testfunc(child):
+    child.expect(r"boot events: (\d+)\r\n")
+    assert int(child.match.group(1)) > 0
+    child.expect(r"trace: begin (\d+)\r\n")
+    numof = int(child.match.group(1))
+    types = set()
+    for _ in range(numof):
+        child.expect(r"([0-9a-f]{8})([0-9a-f]{8})([0-9a-f]{4})"
+                     r"([0-9a-f]{2})([0-9a-f]{2})\r\n")
+        types.add(int(child.match.group(4), 16))
+    child.expect_exact("trace: end")
+
+    for type_ in (TRACE_EVENT_SWITCH, TRACE_EVENT_MSG_SEND,
+                  TRACE_EVENT_MSG_RECV, TRACE_EVENT_MUTEX_BLOCK,
+                  TRACE_EVENT_MUTEX_UNBLOCK, TRACE_EVENT_FLAGS_WAKE):
+        assert type_ in types, "event type {} missing".format(type_)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -14,9 +14,11 @@
 #include "tests-core.h"
 
 #define Q_LEN (4)
+#define Q_LEN_MANY (8)
 
 static priority_queue_t q = PRIORITY_QUEUE_INIT;
 static priority_queue_node_t qe[Q_LEN];
+static priority_queue_node_t qe_many[Q_LEN_MANY];
 
 static void set_up(void)
 {
@@ -24,6 +26,9 @@ static void set_up(void)
     for (unsigned i = 0; i < ARRAY_SIZE(qe); ++i) {
         priority_queue_node_init(&(qe[i]));
     }
+    for (unsigned i = 0; i < ARRAY_SIZE(qe_many); ++i) {
+        priority_queue_node_init(&(qe_many[i]));
+    }
 }
 
 static void test_priority_queue_remove_head_empty(void)
@@ -137,15 +142,92 @@ static void test_priority_queue_remove_one(void)
     TEST_ASSERT_NULL(root->first->next->next);
 }
 
+static void test_priority_queue_remove_head_order(void)
+{
+    priority_queue_t *root = &q;
+    priority_queue_node_t *elem1 = &(qe[1]), *elem2 = &(qe[2]), *elem3 = &(qe[3]);
+
+    elem1->priority = 4567;
+    elem2->priority = 1234;
+    elem3->priority = 4567;
+
+    priority_queue_add(root, elem1);
+    priority_queue_add(root, elem2);
+    priority_queue_add(root, elem3);
+
+    TEST_ASSERT(priority_queue_remove_head(root) == elem2);
+    TEST_ASSERT(priority_queue_remove_head(root) == elem1);
+    TEST_ASSERT(priority_queue_remove_head(root) == elem3);
+    TEST_ASSERT_NULL(priority_queue_remove_head(root));
+}
+
+static void test_priority_queue_order_and_count(void)
+{
+    static const uint32_t prios[Q_LEN_MANY] = { 5, 3, 7, 1, 6, 2, 8, 4 };
+    static const uint32_t expected[] = { 2, 3, 4, 5, 7, 8 };
+    priority_queue_t *root = &q;
+
+    TEST_ASSERT_EQUAL_INT(0, priority_queue_count(root));
+
+    for (unsigned i = 0; i < Q_LEN_MANY; i++) {
+        qe_many[i].priority = prios[i];
+        qe_many[i].data = i;
+        priority_queue_add(root, &qe_many[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(Q_LEN_MANY, priority_queue_count(root));
+
+    /* remove an inner node and the head */
+    priority_queue_remove(root, &qe_many[4]);
+    priority_queue_remove(root, &qe_many[3]);
+    TEST_ASSERT_EQUAL_INT(Q_LEN_MANY - 2, priority_queue_count(root));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+        priority_queue_node_t *res = priority_queue_remove_head(root);
+        TEST_ASSERT_NOT_NULL(res);
+        TEST_ASSERT_EQUAL_INT(expected[i], res->priority);
+    }
+    TEST_ASSERT_NULL(priority_queue_remove_head(root));
+    TEST_ASSERT_EQUAL_INT(0, priority_queue_count(root));
+}
+
+static void test_priority_queue_fifo(void)
+{
+    static const uint32_t prios[Q_LEN_MANY] = { 2, 1, 2, 1, 2, 1, 2, 1 };
+    priority_queue_t *root = &q;
+
+    for (unsigned i = 0; i < Q_LEN_MANY; i++) {
+        qe_many[i].priority = prios[i];
+        qe_many[i].data = i;
+        priority_queue_add(root, &qe_many[i]);
+    }
+    /* removing a node must not change the order of the others */
+    priority_queue_remove(root, &qe_many[3]);
+    priority_queue_remove(root, &qe_many[4]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[1]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[5]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[7]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[0]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[2]);
+    TEST_ASSERT(priority_queue_remove_head(root) == &qe_many[6]);
+    TEST_ASSERT_NULL(priority_queue_remove_head(root));
+}
+
 Test *tests_core_priority_queue_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_priority_queue_remove_head_empty),
         new_TestFixture(test_priority_queue_remove_head_one),
         new_TestFixture(test_priority_queue_add_one),
+#ifndef MODULE_CORE_PRIORITY_QUEUE_HEAP
+        /* these walk the queue through next, which the heap does not link
+         * in order */
         new_TestFixture(test_priority_queue_add_two_equal),
         new_TestFixture(test_priority_queue_add_two_distinct),
         new_TestFixture(test_priority_queue_remove_one),
+#endif
+        new_TestFixture(test_priority_queue_remove_head_order),
+        new_TestFixture(test_priority_queue_order_and_count),
+        new_TestFixture(test_priority_queue_fifo),
     };
 
     EMB_UNIT_TESTCALLER(core_priority_queue_tests, set_up, NULL,
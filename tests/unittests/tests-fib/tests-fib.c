@@ -21,11 +21,18 @@
 
 #define TEST_FIB_TABLE_SIZE (20)
 static fib_entry_t _entries[TEST_FIB_TABLE_SIZE];
+#ifdef MODULE_FIB_RADIX
+static fib_radix_node_t _radix[FIB_RADIX_NODES_NUMOF(TEST_FIB_TABLE_SIZE)];
+#endif
 static fib_table_t test_fib_table = { .data.entries = _entries,
                                       .table_type = FIB_TABLE_TYPE_SH,
                                       .size = TEST_FIB_TABLE_SIZE,
                                       .mtx_access = MUTEX_INIT,
-                                      .notify_rp_pos = 0 };
+                                      .notify_rp_pos = 0,
+#ifdef MODULE_FIB_RADIX
+                                      .radix = _radix,
+#endif
+                                    };
 
 /*
 * @brief helper to fill FIB with unique entries
@@ -976,6 +983,83 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing the longest prefix match with nested prefixes
+* It is expected to receive the next hop of the longest prefix that matches,
+* also after removing prefixes in between
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    /* FIXME: init as enum to fix folding-constant compiler error on OS X */
+    enum { add_buf_size = 16 };
+    static const struct {
+        uint8_t prefix_len;
+        uint8_t addr[add_buf_size];
+    } prefixes[] = {
+        { 0,   { 0 } },
+        { 32,  { 0x20, 0x01, 0x0d, 0xb8 } },
+        { 48,  { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01 } },
+        { 64,  { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02 } },
+        { 48,  { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02 } },
+        { 0,   { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+                 0, 0, 0, 0, 0, 0, 0, 0x01 } },
+    };
+    /* lookup address and the index of the prefix it is expected to match */
+    static const struct {
+        uint8_t prefix;
+        uint8_t addr[add_buf_size];
+    } lookups[] = {
+        { 0, { 0x20, 0x01, 0x0d, 0xb9 } },
+        { 1, { 0x20, 0x01, 0x0d, 0xb8, 0xff } },
+        { 2, { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x03 } },
+        { 3, { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+               0, 0, 0, 0, 0, 0, 0, 0x02 } },
+        { 4, { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02, 0x00, 0x02 } },
+        { 5, { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+               0, 0, 0, 0, 0, 0, 0, 0x01 } },
+    };
+    uint8_t addr_nxt[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    size_t nxt_size;
+
+    memset(addr_nxt, 0, add_buf_size);
+    for (size_t i = 0; i < ARRAY_SIZE(prefixes); i++) {
+        addr_nxt[0] = i;
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42,
+                              (uint8_t *)prefixes[i].addr, add_buf_size,
+                              ((uint32_t)prefixes[i].prefix_len << FIB_FLAG_NET_PREFIX_SHIFT),
+                              addr_nxt, add_buf_size, 0x23, 100000));
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(lookups); i++) {
+        nxt_size = add_buf_size;
+        TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                              addr_nxt, &nxt_size, &next_hop_flags,
+                              (uint8_t *)lookups[i].addr, add_buf_size, 0x23));
+        TEST_ASSERT_EQUAL_INT(lookups[i].prefix, addr_nxt[0]);
+    }
+
+    /* remove 2001:db8:1::/48 and 2001:db8::/32 */
+    fib_remove_entry(&test_fib_table, (uint8_t *)prefixes[2].addr, add_buf_size);
+    fib_remove_entry(&test_fib_table, (uint8_t *)prefixes[1].addr, add_buf_size);
+
+    nxt_size = add_buf_size;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt, &nxt_size, &next_hop_flags,
+                          (uint8_t *)lookups[2].addr, add_buf_size, 0x23));
+    TEST_ASSERT_EQUAL_INT(0, addr_nxt[0]);
+    for (size_t i = 3; i < ARRAY_SIZE(lookups); i++) {
+        nxt_size = add_buf_size;
+        TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                              addr_nxt, &nxt_size, &next_hop_flags,
+                              (uint8_t *)lookups[i].addr, add_buf_size, 0x23));
+        TEST_ASSERT_EQUAL_INT(lookups[i].prefix, addr_nxt[0]);
+    }
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1084,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
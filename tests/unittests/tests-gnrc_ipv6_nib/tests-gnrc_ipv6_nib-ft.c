@@ -178,6 +178,74 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds nested routes, then tries to get routes to destinations within each of
+ * them, removes a route in the middle and tries again.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest matching prefix
+ */
+static void test_nib_ft_get__success_longest_match(void)
+{
+    static const struct {
+        ipv6_addr_t pfx;
+        uint8_t pfx_len;
+    } routes[] = {
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8 } }, 32 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01 } }, 48 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02 } }, 64 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02 } }, 48 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+                    0, 0, 0, 0, 0, 0, 0, 0x01 } }, 128 },
+    };
+    /* destination and the index of the route it is expected to take */
+    static const struct {
+        ipv6_addr_t addr;
+        unsigned route;
+    } dsts[] = {
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0xff } }, 0 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x03 } }, 1 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+                    0, 0, 0, 0, 0, 0, 0, 0x02 } }, 2 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x02, 0x00, 0x02 } }, 3 },
+        { { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x01, 0x00, 0x02,
+                    0, 0, 0, 0, 0, 0, 0, 0x01 } }, 4 },
+    };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    gnrc_ipv6_nib_ft_t fte;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(routes); i++) {
+        next_hop.u64[1].u64 = TEST_UINT64 + i;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&routes[i].pfx,
+                                                      routes[i].pfx_len,
+                                                      &next_hop, IFACE, 0));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(dsts); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dsts[i].addr, NULL,
+                                                      &fte));
+        TEST_ASSERT_EQUAL_INT(routes[dsts[i].route].pfx_len, fte.dst_len);
+        TEST_ASSERT_EQUAL_INT(TEST_UINT64 + dsts[i].route,
+                              fte.next_hop.u64[1].u64);
+    }
+    /* remove 2001:db8:1::/48 */
+    gnrc_ipv6_nib_ft_del(&routes[1].pfx, routes[1].pfx_len);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dsts[1].addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(routes[0].pfx_len, fte.dst_len);
+    for (unsigned i = 2; i < ARRAY_SIZE(dsts); i++) {
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dsts[i].addr, NULL,
+                                                      &fte));
+        TEST_ASSERT_EQUAL_INT(routes[dsts[i].route].pfx_len, fte.dst_len);
+    }
+    /* remove 2001:db8::/32 */
+    gnrc_ipv6_nib_ft_del(&routes[0].pfx, routes[0].pfx_len);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dsts[0].addr,
+                                                             NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dsts[1].addr,
+                                                             NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dsts[4].addr, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(routes[4].pfx_len, fte.dst_len);
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +795,7 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__success_longest_match),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -349,6 +349,51 @@ static void test_nib_get__success(void)
     TEST_ASSERT(nib_alloced == nib_got);
 }
 
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF entries with different IP addresses,
+ * removes every second one and then re-adds them.
+ * Expected result: _nib_onl_get() always returns the entries that are in the
+ * NIB and NULL for those that are not
+ */
+static void test_nib_get__success_removed_in_between(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+        addr.u64[1].u64++;
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64 += 2;
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, 0));
+        addr.u64[1].u64++;
+    }
+}
+
 /*
  * Tries to get a NIB entry that is not in the NIB.
  * Expected result: _nib_onl_get() returns NULL
@@ -2021,6 +2066,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_get__empty),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
+        new_TestFixture(test_nib_get__success_removed_in_between),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_iface),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr_iface),
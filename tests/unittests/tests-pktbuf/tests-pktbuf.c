@@ -21,6 +21,9 @@
 #include "net/gnrc/nettype.h"
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/pktbuf.h"
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+#include "net/gnrc/pktbuf_slab.h"
+#endif
 
 #include "unittests-constants.h"
 #include "tests-pktbuf.h"
@@ -245,7 +248,10 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, so no certainty here. gnrc_pktbuf_slab
+ * puts any data up to CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE into the same kind of
+ * block, so it reuses the hole on purpose */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -496,6 +502,36 @@ static void test_pktbuf_mark__success_equally_sized(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+static void test_pktbuf_mark__payload_in_place(void)
+{
+    uint8_t data[100];
+    gnrc_pktsnip_t *pkt, *hdr;
+    uint8_t *payload;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+    pkt = gnrc_pktbuf_add(NULL, data, sizeof(data), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    payload = (uint8_t *)pkt->data + 14;
+    /* e.g. an Ethernet header */
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 14, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(payload == pkt->data);
+    TEST_ASSERT_EQUAL_INT(sizeof(data) - 14, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 14, pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(14, hdr->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data, hdr->data, hdr->size));
+    /* shrinking and releasing the unaligned payload must free all of it */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 21));
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 14, pkt->data, pkt->size));
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_realloc_data__size_0(void)
 {
     gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, sizeof(TEST_STRING8), GNRC_NETTYPE_TEST);
@@ -813,7 +849,9 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+/* with gnrc_pktbuf_slab no single snip can fill up the packet buffer, as data
+ * is limited to CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -835,7 +873,7 @@ static void test_pktbuf_reverse_snips__too_full(void)
     gnrc_pktbuf_release(pkt_next);
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif /* !MODULE_GNRC_PKTBUF_MALLOC && !MODULE_GNRC_PKTBUF_SLAB */
 
 static void test_pktbuf_reverse_snips__success(void)
 {
@@ -852,6 +890,111 @@ static void test_pktbuf_reverse_snips__success(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+static void _get_stats(gnrc_pktbuf_slab_stats_t *stats)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        gnrc_pktbuf_slab_get_stats(i, &stats[i]);
+    }
+}
+
+static void test_pktbuf_slab__size_classes(void)
+{
+    gnrc_pktbuf_slab_stats_t stats[GNRC_PKTBUF_SLAB_NUMOF];
+    gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *pkt2 = gnrc_pktbuf_add(NULL, NULL,
+                                           CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE + 1,
+                                           GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE + 1,
+                                     GNRC_NETTYPE_TEST));
+    _get_stats(stats);
+    TEST_ASSERT_EQUAL_INT(2, stats[GNRC_PKTBUF_SLAB_SNIP].used);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_PKTBUF_SLAB_SMALL].used);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_PKTBUF_SLAB_LARGE].used);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt1);
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__fallback(void)
+{
+    gnrc_pktbuf_slab_stats_t stats[GNRC_PKTBUF_SLAB_NUMOF];
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    /* small headers are exhausted, so next one goes into a payload block */
+    pkt = gnrc_pktbuf_add(pkt, NULL, 1, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    _get_stats(stats);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF,
+                          stats[GNRC_PKTBUF_SLAB_SMALL].used);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_PKTBUF_SLAB_LARGE].used);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_PKTBUF_SLAB_SMALL].failed);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab__memfull_stats(void)
+{
+    gnrc_pktbuf_slab_stats_t stats[GNRC_PKTBUF_SLAB_NUMOF];
+    gnrc_pktsnip_t *pkt = NULL;
+
+    for (unsigned i = 0; i < CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF; i++) {
+        pkt = gnrc_pktbuf_add(pkt, NULL, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                              GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(pkt);
+    }
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                                     GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    _get_stats(stats);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_PKTBUF_SLAB_LARGE].used);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF,
+                          stats[GNRC_PKTBUF_SLAB_LARGE].max_used);
+    TEST_ASSERT_EQUAL_INT(1, stats[GNRC_PKTBUF_SLAB_LARGE].failed);
+    gnrc_pktbuf_slab_reset_stats();
+    _get_stats(stats);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_PKTBUF_SLAB_LARGE].max_used);
+    TEST_ASSERT_EQUAL_INT(0, stats[GNRC_PKTBUF_SLAB_LARGE].failed);
+}
+
+static void test_pktbuf_slab__mark_release(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16,
+                                          sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+    gnrc_pktsnip_t *hdr1, *hdr2;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((hdr1 = gnrc_pktbuf_mark(pkt, 4, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_NOT_NULL((hdr2 = gnrc_pktbuf_mark(pkt, pkt->size - 2,
+                                                  GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16, hdr1->data, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16 + 4, hdr2->data, hdr2->size));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING16 + sizeof(TEST_STRING16) - 2,
+                                    pkt->data, 2));
+    /* data within a block can grow up to the end of the block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr2, hdr2->size + 4));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    pkt = gnrc_pktbuf_remove_snip(pkt, hdr2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTBUF_SLAB */
+
 Test *tests_pktbuf_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -868,7 +1011,7 @@ Test *tests_pktbuf_tests(void)
 #endif
         new_TestFixture(test_pktbuf_add__success),
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -881,6 +1024,9 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_mark__success_aligned),
         new_TestFixture(test_pktbuf_mark__success_small),
         new_TestFixture(test_pktbuf_mark__success_equally_sized),
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+        new_TestFixture(test_pktbuf_mark__payload_in_place),
+#endif
         new_TestFixture(test_pktbuf_realloc_data__size_0),
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_realloc_data__memfull),
@@ -906,10 +1052,16 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SLAB)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
-#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
+#ifdef MODULE_GNRC_PKTBUF_SLAB
+        new_TestFixture(test_pktbuf_slab__size_classes),
+        new_TestFixture(test_pktbuf_slab__fallback),
+        new_TestFixture(test_pktbuf_slab__memfull_stats),
+        new_TestFixture(test_pktbuf_slab__mark_release),
+#endif
     };
 
     EMB_UNIT_TESTCALLER(gnrc_pktbuf_tests, set_up, NULL, fixtures);
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 agent <agent@local>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "kernel_defines.h"
+
+#include "prefix_trie.h"
+
+#define ENTRIES_NUMOF   (8U)
+
+static uint8_t _keys[ENTRIES_NUMOF][2];
+static prefix_trie_node_t _nodes[PREFIX_TRIE_NODES_NUMOF(ENTRIES_NUMOF)];
+static prefix_trie_t _trie;
+
+static const uint8_t *_key(const prefix_trie_t *trie, unsigned idx,
+                           size_t *size)
+{
+    (void)trie;
+    *size = sizeof(_keys[idx]);
+    return _keys[idx];
+}
+
+static void _add(unsigned idx, uint8_t b0, uint8_t b1, unsigned len)
+{
+    _keys[idx][0] = b0;
+    _keys[idx][1] = b1;
+    prefix_trie_add(&_trie, idx, len);
+}
+
+/* returns the index of the longest match or -1 */
+static int _lookup(uint8_t b0, uint8_t b1)
+{
+    const uint8_t key[] = { b0, b1 };
+    prefix_trie_iter_t iter;
+    int idx, res = -1;
+
+    prefix_trie_match_init(&_trie, &iter);
+    while ((idx = prefix_trie_match(&_trie, key, sizeof(key), &iter)) >= 0) {
+        /* entries with the same prefix come by index */
+        if ((res < 0) ||
+            (prefix_trie_len(&_trie, idx) > prefix_trie_len(&_trie, res))) {
+            res = idx;
+        }
+    }
+    return res;
+}
+
+static void _collect(unsigned idx, void *arg)
+{
+    unsigned *mask = arg;
+
+    *mask |= 1U << idx;
+}
+
+static void set_up(void)
+{
+    memset(_keys, 0, sizeof(_keys));
+    prefix_trie_init(&_trie, _nodes, ENTRIES_NUMOF, _key);
+}
+
+static void test_prefix_trie_match__empty(void)
+{
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(0x12, 0x34));
+}
+
+static void test_prefix_trie_match__longest(void)
+{
+    _add(0, 0x00, 0x00, 0);     /* default */
+    _add(1, 0x12, 0x00, 8);
+    _add(2, 0x12, 0x30, 12);
+    _add(3, 0x12, 0x34, 16);
+    _add(4, 0x80, 0x00, 1);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(0x12, 0x34));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x12, 0x35));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x12, 0x45));
+    TEST_ASSERT_EQUAL_INT(0, _lookup(0x13, 0x34));
+    TEST_ASSERT_EQUAL_INT(4, _lookup(0xff, 0xff));
+}
+
+static void test_prefix_trie_match__dup(void)
+{
+    _add(5, 0x12, 0x00, 8);
+    _add(1, 0x12, 0x00, 8);
+    _add(3, 0x12, 0x00, 8);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x12, 0x34));
+    prefix_trie_remove(&_trie, 1);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(0x12, 0x34));
+    prefix_trie_remove(&_trie, 5);
+    TEST_ASSERT_EQUAL_INT(3, _lookup(0x12, 0x34));
+    prefix_trie_remove(&_trie, 3);
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(0x12, 0x34));
+}
+
+static void test_prefix_trie_remove(void)
+{
+    _add(0, 0x12, 0x00, 8);
+    _add(1, 0x12, 0x80, 9);
+    _add(2, 0x12, 0x00, 9);
+    prefix_trie_remove(&_trie, 0);
+    TEST_ASSERT_EQUAL_INT(1, _lookup(0x12, 0xff));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x12, 0x7f));
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(0x13, 0x00));
+    prefix_trie_remove(&_trie, 1);
+    TEST_ASSERT_EQUAL_INT(-1, _lookup(0x12, 0xff));
+    /* removing again does nothing */
+    prefix_trie_remove(&_trie, 1);
+    TEST_ASSERT_EQUAL_INT(2, _lookup(0x12, 0x7f));
+    prefix_trie_remove(&_trie, 2);
+    TEST_ASSERT_EQUAL_INT(0, _trie.root);
+    /* all branching nodes are free again */
+    for (unsigned i = 0; i < ARRAY_SIZE(_nodes); i++) {
+        TEST_ASSERT_EQUAL_INT(0, _nodes[i].child[0] | _nodes[i].child[1]);
+    }
+}
+
+static void test_prefix_trie_foreach(void)
+{
+    const uint8_t pfx[] = { 0x12, 0x00 };
+    unsigned mask = 0;
+
+    _add(0, 0x00, 0x00, 0);
+    _add(1, 0x12, 0x34, 4);     /* shorter prefix, but key matches */
+    _add(2, 0x12, 0x30, 12);
+    _add(3, 0x12, 0x34, 16);
+    _add(4, 0x13, 0x00, 8);
+    _add(5, 0x12, 0xff, 16);
+    prefix_trie_foreach(&_trie, pfx, sizeof(pfx), 8, _collect, &mask);
+    TEST_ASSERT_EQUAL_INT((1U << 1) | (1U << 2) | (1U << 3) | (1U << 5), mask);
+}
+
+Test *tests_prefix_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_prefix_trie_match__empty),
+        new_TestFixture(test_prefix_trie_match__longest),
+        new_TestFixture(test_prefix_trie_match__dup),
+        new_TestFixture(test_prefix_trie_remove),
+        new_TestFixture(test_prefix_trie_foreach),
+    };
+
+    EMB_UNIT_TESTCALLER(prefix_trie_tests, set_up, NULL, fixtures);
+
+    return (Test *)&prefix_trie_tests;
+}
+
+void tests_prefix_trie(void)
+{
+    TESTS_RUN(tests_prefix_trie_tests());
+}
@@ -237,18 +237,49 @@ static void test_gnrc_priority_pktqueue_pop(void)
 
 }
 
+static void test_gnrc_priority_pktqueue_pop_order(void)
+{
+    gnrc_pktsnip_t pkt1 = PKT_INIT_ELEM_STATIC_DATA(TEST_STRING8, NULL);
+    gnrc_pktsnip_t pkt2 = PKT_INIT_ELEM_STATIC_DATA(TEST_STRING12, NULL);
+    gnrc_pktsnip_t pkt3 = PKT_INIT_ELEM_STATIC_DATA(TEST_STRING16, NULL);
+    gnrc_pktsnip_t pkt4 = PKT_INIT_ELEM_STATIC_DATA(TEST_STRING8, NULL);
+    gnrc_priority_pktqueue_node_t elem1 = PRIORITY_PKTQUEUE_NODE_INIT(2,&pkt1);
+    gnrc_priority_pktqueue_node_t elem2 = PRIORITY_PKTQUEUE_NODE_INIT(0,&pkt2);
+    gnrc_priority_pktqueue_node_t elem3 = PRIORITY_PKTQUEUE_NODE_INIT(2,&pkt3);
+    gnrc_priority_pktqueue_node_t elem4 = PRIORITY_PKTQUEUE_NODE_INIT(1,&pkt4);
+
+    gnrc_priority_pktqueue_push(&pkt_queue, &elem1);
+    gnrc_priority_pktqueue_push(&pkt_queue, &elem2);
+    gnrc_priority_pktqueue_push(&pkt_queue, &elem3);
+    gnrc_priority_pktqueue_push(&pkt_queue, &elem4);
+    TEST_ASSERT_EQUAL_INT(4, gnrc_priority_pktqueue_length(&pkt_queue));
+
+    /* packets of the same priority leave the queue in the order they came */
+    TEST_ASSERT(gnrc_priority_pktqueue_pop(&pkt_queue) == &pkt2);
+    TEST_ASSERT(gnrc_priority_pktqueue_pop(&pkt_queue) == &pkt4);
+    TEST_ASSERT(gnrc_priority_pktqueue_pop(&pkt_queue) == &pkt1);
+    TEST_ASSERT(gnrc_priority_pktqueue_pop(&pkt_queue) == &pkt3);
+    TEST_ASSERT_NULL(gnrc_priority_pktqueue_pop(&pkt_queue));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_priority_pktqueue_length(&pkt_queue));
+}
+
 Test *tests_priority_pktqueue_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_gnrc_priority_pktqueue_init),
         new_TestFixture(test_gnrc_priority_pktqueue_node_init),
         new_TestFixture(test_gnrc_priority_pktqueue_push_one),
+#ifndef MODULE_CORE_PRIORITY_QUEUE_HEAP
+        /* walks the queue through next, which the heap does not link in
+         * order */
         new_TestFixture(test_gnrc_priority_pktqueue_push_two),
+#endif
         new_TestFixture(test_gnrc_priority_pktqueue_length),
         new_TestFixture(test_gnrc_priority_pktqueue_flush),
         new_TestFixture(test_gnrc_priority_pktqueue_head),
         new_TestFixture(test_gnrc_priority_pktqueue_pop_empty),
         new_TestFixture(test_gnrc_priority_pktqueue_pop),
+        new_TestFixture(test_gnrc_priority_pktqueue_pop_order),
     };
 
     EMB_UNIT_TESTCALLER(priority_pktqueue_tests, set_up, NULL, fixtures);
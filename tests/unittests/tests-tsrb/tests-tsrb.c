@@ -162,6 +162,79 @@ static void test_add(void)
     }
 }
 
+static void test_peek_commit(void)
+{
+    uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_contiguous(&_tsrb, &data));
+
+    /* move read and write position near the end of the buffer */
+    for (int i = 0; i < (BUFFER_SIZE - TEST_DROP_NUM); i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                BUFFER_SIZE));
+
+    /* first segment up to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_peek_contiguous(&_tsrb, &data));
+    TEST_ASSERT(&_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM] == data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_buffer, data, TEST_DROP_NUM));
+    tsrb_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, tsrb_avail(&_tsrb));
+
+    /* second segment at the start of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_peek_contiguous(&_tsrb, &data));
+    TEST_ASSERT(_tsrb_buffer == data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_io_buffer[TEST_DROP_NUM], data,
+                                    BUFFER_SIZE - TEST_DROP_NUM));
+    tsrb_commit(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_contiguous(&_tsrb, &data));
+}
+
+static void test_reserve_publish(void)
+{
+    uint8_t *data;
+    size_t len;
+
+    /* move read and write position near the end of the buffer */
+    for (int i = 0; i < (BUFFER_SIZE - TEST_DROP_NUM); i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_reserve_contiguous(&_tsrb,
+                                                                 &data));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+
+    len = tsrb_reserve_contiguous(&_tsrb, &data);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, len);
+    TEST_ASSERT(&_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM] == data);
+    memset(data, TEST_INPUT, len);
+    tsrb_publish(&_tsrb, len);
+
+    len = tsrb_reserve_contiguous(&_tsrb, &data);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, len);
+    TEST_ASSERT(_tsrb_buffer == data);
+    memset(data, TEST_INPUT + 1, len);
+    tsrb_publish(&_tsrb, len);
+
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_reserve_contiguous(&_tsrb, &data));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(TEST_INPUT + (i >= (int)TEST_DROP_NUM),
+                              _io_buffer[i]);
+    }
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +247,8 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_peek_commit),
+        new_TestFixture(test_reserve_publish),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
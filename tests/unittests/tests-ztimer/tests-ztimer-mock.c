@@ -22,6 +22,7 @@
 
 #include "tests-ztimer.h"
 
+#include <limits.h>
 #include <stdio.h>
 /**
  * @brief   Simple callback for counting alarms
@@ -249,6 +250,62 @@ static void test_ztimer_mock_set16(void)
     TEST_ASSERT_EQUAL_INT(0x100207d2, now);
 }
 
+/**
+ * @brief   Callback recording the order in which timers trigger
+ */
+static void cb_record(void *arg)
+{
+    static unsigned pos;
+    unsigned *order = arg;
+
+    *order = pos++;
+}
+
+/**
+ * @brief   Testing multiple timers set out of order, some of them removed
+ */
+static void test_ztimer_mock_set_multiple(void)
+{
+    /* targets in insertion order, all distinct */
+    static const uint32_t targets[] = {
+        700, 100, 500, 900, 300, 200, 800, 400, 1000, 600, 50, 950,
+    };
+    unsigned order[ARRAY_SIZE(targets)];
+    ztimer_t alarms[ARRAY_SIZE(targets)];
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+
+    ztimer_mock_init(&zmock, 32);
+    for (unsigned i = 0; i < ARRAY_SIZE(targets); i++) {
+        order[i] = UINT_MAX;
+        alarms[i] = (ztimer_t){ .callback = cb_record, .arg = &order[i] };
+        ztimer_set(z, &alarms[i], targets[i]);
+    }
+
+    /* remove targets 500 and 50, re-set 900 to 150 */
+    ztimer_remove(z, &alarms[2]);
+    ztimer_remove(z, &alarms[10]);
+    ztimer_set(z, &alarms[3], 150);
+    /* removing a timer twice has no effect */
+    ztimer_remove(z, &alarms[10]);
+
+    ztimer_mock_advance(&zmock, 99);
+    for (unsigned i = 0; i < ARRAY_SIZE(targets); i++) {
+        TEST_ASSERT_EQUAL_INT(UINT_MAX, order[i]);
+    }
+
+    ztimer_mock_advance(&zmock, 1000);
+    TEST_ASSERT_EQUAL_INT(UINT_MAX, order[2]);
+    TEST_ASSERT_EQUAL_INT(UINT_MAX, order[10]);
+
+    /* expected trigger order: 100, 150, 200, 300, 400, 600, 700, 800, 950,
+     * 1000 */
+    static const unsigned expected[] = { 1, 3, 5, 4, 7, 9, 0, 6, 11, 8 };
+    for (unsigned i = 1; i < ARRAY_SIZE(expected); i++) {
+        TEST_ASSERT(order[expected[i - 1]] < order[expected[i]]);
+    }
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -258,6 +315,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_now3),
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
+        new_TestFixture(test_ztimer_mock_set_multiple),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);